@@ -188,9 +188,58 @@ class ColumnarAttributeRange : public std::ranges::view_interface<ColumnarAttrib
     iterator end() const { return get(size_); }
     auto operator[](Idx idx) const { return *get(idx); }
 
+    // column-wise copy of the whole range into row based structs
+    // unlike the proxies, the type of an attribute buffer is resolved once for the whole column
+    // the attributes without a buffer are left untouched in the destination
+    void gather(std::span<typename Proxy::value_type> destination) const {
+        assert(std::ssize(destination) == size_);
+        for (auto const& attribute_buffer : attribute_buffers_) {
+            for_each_column(attribute_buffer, [&destination]<typename AttributeType>(AttributeType const* column,
+                                                                                     size_t offset) {
+                auto* const rows = reinterpret_cast<char*>(destination.data()) + offset;
+                for (size_t idx = 0; idx != destination.size(); ++idx) {
+                    *reinterpret_cast<AttributeType*>(rows + idx * sizeof(typename Proxy::value_type)) = column[idx];
+                }
+            });
+        }
+    }
+
+    // column-wise copy of row based structs into the attribute buffers of the whole range
+    void scatter(std::span<typename Proxy::value_type const> source) const
+        requires is_data_mutable_v<dataset_type>
+    {
+        assert(std::ssize(source) == size_);
+        for (auto const& attribute_buffer : attribute_buffers_) {
+            for_each_column(attribute_buffer, [&source]<typename AttributeType>(AttributeType* column, size_t offset) {
+                auto const* const rows = reinterpret_cast<char const*>(source.data()) + offset;
+                for (size_t idx = 0; idx != source.size(); ++idx) {
+                    column[idx] =
+                        *reinterpret_cast<AttributeType const*>(rows + idx * sizeof(typename Proxy::value_type));
+                }
+            });
+        }
+    }
+
   private:
     iterator get(Idx idx) const { return iterator{start_ + idx, attribute_buffers_}; }
 
+    // call func with the typed column of this range in the attribute buffer and the offset of the attribute
+    template <typename Func>
+    void for_each_column(AttributeBuffer<Data> const& attribute_buffer, Func const& func) const {
+        assert(attribute_buffer.meta_attribute != nullptr);
+        auto const& meta_attribute = *attribute_buffer.meta_attribute;
+        ctype_func_selector(meta_attribute.ctype, [&attribute_buffer, &meta_attribute, &func,
+                                                   start = start_]<typename AttributeType> {
+            if constexpr (sizeof(AttributeType) <= sizeof(typename Proxy::value_type)) {
+                using ColumnType =
+                    std::conditional_t<is_data_mutable_v<dataset_type>, AttributeType, AttributeType const>;
+                func(reinterpret_cast<ColumnType*>(attribute_buffer.data) + start, meta_attribute.offset);
+            } else {
+                assert(false && "ColumnarAttributeRange::for_each_column AttributeType not equal to value_type!");
+            }
+        });
+    }
+
     Idx size_{};
     Idx start_{};
     std::span<AttributeBuffer<Data> const> attribute_buffers_;
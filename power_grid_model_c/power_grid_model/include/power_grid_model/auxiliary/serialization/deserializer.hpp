@@ -17,6 +17,8 @@
 #include <nlohmann/json_fwd.hpp>
 
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <cassert>
 #include <concepts>
 #include <cstddef>
@@ -45,6 +47,7 @@
 #include <sstream>
 #include <stack>
 #include <string_view>
+#include <thread>
 #include <utility>
 
 namespace power_grid_model::meta_data {
@@ -66,37 +69,36 @@ namespace detail {
 using nlohmann::json;
 
 // visitor for json conversion
+// the json is packed in one pass into a single msgpack buffer
+// a map/array is written with a fixed-width header (map 32/array 32) of which the size is patched when it ends,
+//    instead of packing every map/array into a temporary buffer and copying it into the parent when it ends
 struct JsonMapArrayData {
+    size_t header_offset{};
     size_t size{};
-    msgpack::sbuffer buffer;
-
-    JsonMapArrayData() = default;
-    JsonMapArrayData(JsonMapArrayData const&) = delete;
-    JsonMapArrayData& operator=(JsonMapArrayData const&) = delete;
-    JsonMapArrayData(JsonMapArrayData&&) noexcept = default;
-    JsonMapArrayData& operator=(JsonMapArrayData&&) noexcept = default;
-    ~JsonMapArrayData() = default;
 };
 
 struct JsonSAXVisitor {
     static constexpr size_t max_error_message_token_length = 100;
+    static constexpr char map_32_header = static_cast<char>(0xdf);
+    static constexpr char array_32_header = static_cast<char>(0xdd);
+    static constexpr size_t map_array_header_size = 1 + sizeof(uint32_t);
 
-    msgpack::packer<msgpack::sbuffer> top_packer() {
+    // a value is counted in the size of the map/array that contains it
+    msgpack::packer<msgpack::sbuffer> value_packer() {
         if (data_buffers.empty()) {
             throw SerializationError{"Json root should be a map!\n"};
         }
-        return {data_buffers.top().buffer};
+        ++data_buffers.top().size;
+        return {root_buffer};
     }
 
     template <class T> bool pack_data(T const& val) {
-        top_packer().pack(val);
-        ++data_buffers.top().size;
+        value_packer().pack(val);
         return true;
     }
 
     bool null() {
-        top_packer().pack_nil();
-        ++data_buffers.top().size;
+        value_packer().pack_nil();
         return true;
     }
     bool boolean(bool val) { return pack_data(val); }
@@ -113,47 +115,29 @@ struct JsonSAXVisitor {
         return pack_data(val);
     }
     bool key(json::string_t const& val) {
-        top_packer().pack(val);
+        // keys are not counted in the size of a map
+        msgpack::packer<msgpack::sbuffer>{root_buffer}.pack(val);
         return true;
     }
     static bool binary(json::binary_t const& /* val */) { return true; }
 
     bool start_object(size_t /* elements */) {
-        check_depth();
-        data_buffers.emplace();
+        start_map_array(map_32_header);
         return true;
     }
     bool end_object() {
-        JsonMapArrayData const object_data{std::move(data_buffers.top())};
-        data_buffers.pop();
-        if (!std::in_range<uint32_t>(object_data.size)) {
-            throw SerializationError{"Json map/array size exceeds the msgpack limit (2^32)!\n"};
-        }
-        if (data_buffers.empty()) {
-            msgpack::packer<msgpack::sbuffer> root_packer{root_buffer};
-            root_packer.pack_map(static_cast<uint32_t>(object_data.size));
-            root_buffer.write(object_data.buffer.data(), object_data.buffer.size());
-        } else {
-            top_packer().pack_map(static_cast<uint32_t>(object_data.size));
-            data_buffers.top().buffer.write(object_data.buffer.data(), object_data.buffer.size());
-            ++data_buffers.top().size;
-        }
+        end_map_array();
         return true;
     }
     bool start_array(size_t /* elements */) {
-        check_depth();
-        data_buffers.emplace();
+        if (data_buffers.empty()) {
+            throw SerializationError{"Json root should be a map!\n"};
+        }
+        start_map_array(array_32_header);
         return true;
     }
     bool end_array() {
-        JsonMapArrayData const array_data{std::move(data_buffers.top())};
-        data_buffers.pop();
-        if (!std::in_range<uint32_t>(array_data.size)) {
-            throw SerializationError{"Json map/array size exceeds the msgpack limit (2^32)!\n"};
-        }
-        top_packer().pack_array(static_cast<uint32_t>(array_data.size));
-        data_buffers.top().buffer.write(array_data.buffer.data(), array_data.buffer.size());
-        ++data_buffers.top().size;
+        end_map_array();
         return true;
     }
 
@@ -172,6 +156,30 @@ struct JsonSAXVisitor {
         }
     }
 
+    void start_map_array(char header) {
+        check_depth();
+        if (!data_buffers.empty()) {
+            ++data_buffers.top().size;
+        }
+        data_buffers.push({.header_offset = root_buffer.size(), .size = 0});
+        std::array<char, map_array_header_size> const placeholder{header};
+        root_buffer.write(placeholder.data(), placeholder.size());
+    }
+
+    void end_map_array() {
+        JsonMapArrayData const map_array_data = data_buffers.top();
+        data_buffers.pop();
+        if (!std::in_range<uint32_t>(map_array_data.size)) {
+            throw SerializationError{"Json map/array size exceeds the msgpack limit (2^32)!\n"};
+        }
+        // the size is big-endian after the header byte
+        auto const size = static_cast<uint32_t>(map_array_data.size);
+        char* const size_bytes = root_buffer.data() + map_array_data.header_offset + 1;
+        for (size_t byte = 0; byte != sizeof(uint32_t); ++byte) {
+            size_bytes[byte] = static_cast<char>((size >> (8 * (sizeof(uint32_t) - 1 - byte))) & 0xFFU);
+        }
+    }
+
     std::stack<JsonMapArrayData> data_buffers;
     msgpack::sbuffer root_buffer;
 };
@@ -499,7 +507,14 @@ class Deserializer {
 
     WritableDataset& get_dataset_info() { return dataset_handler_; }
 
+    // threading < 0 or 1 parses sequentially, 0 uses the hardware threads, > 1 uses that number of threads
+    void set_threading(Idx threading) { threading_ = threading; }
+
     void parse() {
+        if (Idx const n_thread = n_parse_threads(); n_thread > 1) {
+            parse_parallel(n_thread);
+            return;
+        }
         root_key_ = "data";
         try {
             for (Idx i = 0; i != dataset_handler_.n_components(); ++i) {
@@ -534,12 +549,40 @@ class Deserializer {
     std::string version_;
     bool is_batch_{};
     std::map<MetaComponent const*, std::vector<MetaAttribute const*>, std::less<>> attributes_;
+    Idx threading_{-1};
 
     // offset of the msgpack bytes, the number of elements,
     //     for the actual data, per component (outer), per batch (inner)
     // if a component has no element for a certain scenario, that offset and size will be zero.
     std::vector<std::vector<ComponentByteMeta>> msg_data_offsets_;
     WritableDataset dataset_handler_;
+    // the deserializer of which a parse worker reads the pre-parsed data, nullptr if not a parse worker
+    Deserializer const* parent_{};
+
+    struct parse_worker_t {};
+    static constexpr parse_worker_t parse_worker{};
+    static constexpr Idx tasks_per_thread = 4;
+
+    // a range of scenarios of a component, which is parsed independently of the other ranges
+    struct ParseTask {
+        Idx component_idx{};
+        Idx begin_scenario{};
+        Idx end_scenario{};
+    };
+
+    // worker for parallel parsing, which reads the data of the parent with its own position
+    // the pre-parsed data and the buffers are not copied, the worker refers to the parent for them
+    Deserializer(parse_worker_t /* tag */, Deserializer const& parent)
+        : meta_data_{parent.meta_data_},
+          data_{parent.data_},
+          size_{parent.size_},
+          is_batch_{parent.is_batch_},
+          dataset_handler_{parent.is_batch_, parent.dataset_handler_.batch_size(),
+                           parent.dataset_handler_.get_description().dataset->name, *parent.meta_data_},
+          parent_{&parent} {}
+
+    // the deserializer that owns the pre-parsed data and the buffers, read-only
+    Deserializer const& pre_parsed() const { return parent_ == nullptr ? *this : *parent_; }
 
     static msgpack::sbuffer json_to_msgpack(std::string_view json_string) {
         JsonSAXVisitor visitor{};
@@ -847,46 +890,146 @@ class Deserializer {
         return counter.front();
     }
 
+    Idx n_parse_threads() const {
+        auto const hardware_thread = static_cast<Idx>(std::jthread::hardware_concurrency());
+        if (threading_ < 0 || threading_ == 1 || (threading_ == 0 && hardware_thread < 2)) {
+            return 1; // sequential
+        }
+        return threading_ == 0 ? hardware_thread : threading_;
+    }
+
+    // the scenarios of each component are split into ranges, which are parsed in parallel into disjoint parts of the
+    //    buffers, starting from the msgpack offsets per component per scenario that are found in the pre-parsing
+    // each thread parses with its own worker, so that the position for the error report is kept per thread
+    // the error of the first failed range is reported, which is the same error as in sequential parsing
+    void parse_parallel(Idx n_thread) {
+        Idx const batch_size = dataset_handler_.batch_size();
+        Idx const scenarios_per_task = std::max(Idx{1}, batch_size / (n_thread * tasks_per_thread));
+        std::vector<ParseTask> tasks;
+        for (Idx component_idx = 0; component_idx != dataset_handler_.n_components(); ++component_idx) {
+            if (!has_buffer(component_idx)) {
+                continue;
+            }
+            // the indptr is needed by all ranges of the component
+            parse_indptr(component_idx);
+            for (Idx begin_scenario = 0; begin_scenario < batch_size; begin_scenario += scenarios_per_task) {
+                tasks.push_back({.component_idx = component_idx,
+                                 .begin_scenario = begin_scenario,
+                                 .end_scenario = std::min(begin_scenario + scenarios_per_task, batch_size)});
+            }
+        }
+        auto const n_tasks = std::ssize(tasks);
+        n_thread = std::max(Idx{1}, std::min(n_thread, n_tasks));
+
+        std::vector<Deserializer> workers;
+        workers.reserve(n_thread);
+        for (Idx thread_number = 0; thread_number != n_thread; ++thread_number) {
+            workers.push_back(Deserializer{parse_worker, *this});
+        }
+
+        std::vector<std::exception_ptr> task_exceptions(n_tasks);
+        std::atomic<Idx> next_task{0};
+        // the ranges after a failed range are not parsed anymore
+        std::atomic<Idx> first_failed_task{n_tasks};
+        auto const run_thread = [&tasks, &task_exceptions, &next_task, &first_failed_task](Deserializer& worker) {
+            for (Idx task = next_task++; task < first_failed_task; task = next_task++) {
+                try {
+                    worker.parse_task(tasks[task]);
+                } catch (...) { // NOSONAR(S2738)
+                    task_exceptions[task] = std::current_exception();
+                    Idx failed_task = first_failed_task;
+                    while (task < failed_task && !first_failed_task.compare_exchange_weak(failed_task, task)) {
+                    }
+                }
+            }
+        };
+        {
+            std::vector<std::jthread> threads;
+            threads.reserve(n_thread);
+            for (auto& worker : workers) {
+                threads.emplace_back([&run_thread, &worker] { run_thread(worker); });
+            }
+        }
+        if (Idx const failed_task = first_failed_task; failed_task != n_tasks) {
+            std::rethrow_exception(task_exceptions[failed_task]);
+        }
+    }
+
+    void parse_task(ParseTask const& task) {
+        root_key_ = "data";
+        try {
+            parse_scenarios(task.component_idx, task.begin_scenario, task.end_scenario);
+        } catch (std::exception& e) {
+            handle_error(e);
+        }
+        root_key_ = {};
+    }
+
+    bool has_buffer(Idx component_idx) const {
+        return dataset_handler_.is_row_based(component_idx) || dataset_handler_.is_columnar(component_idx, true);
+    }
+
     void parse_component(Idx component_idx) {
-        if (dataset_handler_.is_row_based(component_idx)) {
-            parse_component(row_based, component_idx);
-        } else if (dataset_handler_.is_columnar(component_idx, true)) {
-            parse_component(columnar, component_idx);
+        if (!has_buffer(component_idx)) {
+            return;
         }
+        parse_indptr(component_idx);
+        parse_scenarios(component_idx, 0, dataset_handler_.batch_size());
     }
 
-    template <detail::row_based_or_columnar_c row_or_column_t>
-    void parse_component(row_or_column_t row_or_column_tag, Idx component_idx) {
+    void parse_indptr(Idx component_idx) {
+        auto const& info = dataset_handler_.get_component_info(component_idx);
+        if (info.elements_per_scenario >= 0) {
+            return;
+        }
         auto const& buffer = dataset_handler_.get_buffer(component_idx);
+        auto const& msg_data = msg_data_offsets_[component_idx];
+        // first always zero
+        buffer.indptr.front() = 0;
+        // accumulate sum
+        std::transform_inclusive_scan(
+            msg_data.cbegin(), msg_data.cend(), buffer.indptr.begin() + 1, std::plus{},
+            [](auto const& x) { return x.size; }, Idx{});
+    }
+
+    void parse_scenarios(Idx component_idx, Idx begin_scenario, Idx end_scenario) {
+        auto const& dataset_handler = pre_parsed().dataset_handler_;
+        if (dataset_handler.is_row_based(component_idx)) {
+            parse_scenarios(row_based, component_idx, begin_scenario, end_scenario);
+        } else if (dataset_handler.is_columnar(component_idx, true)) {
+            parse_scenarios(columnar, component_idx, begin_scenario, end_scenario);
+        }
+    }
 
-        assert(dataset_handler_.is_row_based(buffer) == detail::is_row_based_v<row_or_column_t>);
-        assert(dataset_handler_.is_columnar(buffer, true) == detail::is_columnar_v<row_or_column_t>);
+    // the indptr should be set before
+    template <detail::row_based_or_columnar_c row_or_column_t>
+    void parse_scenarios(row_or_column_t row_or_column_tag, Idx component_idx, Idx begin_scenario,
+                         Idx end_scenario) {
+        auto const& dataset_handler = pre_parsed().dataset_handler_;
+        auto const& buffer = dataset_handler.get_buffer(component_idx);
+
+        assert(dataset_handler.is_row_based(buffer) == detail::is_row_based_v<row_or_column_t>);
+        assert(dataset_handler.is_columnar(buffer, true) == detail::is_columnar_v<row_or_column_t>);
         assert(is_row_based(buffer) == detail::is_row_based_v<row_or_column_t>);
         assert(is_columnar(buffer) == detail::is_columnar_v<row_or_column_t>);
 
-        auto const& info = dataset_handler_.get_component_info(component_idx);
-        auto const& msg_data = msg_data_offsets_[component_idx];
+        auto const& info = dataset_handler.get_component_info(component_idx);
+        auto const& msg_data = pre_parsed().msg_data_offsets_[component_idx];
 
-        Idx const batch_size = dataset_handler_.batch_size();
         component_key_ = info.component->name;
 
-        // set nan
-        set_nan(row_or_column_tag, buffer, info);
+        auto const scenario_offset = [&info, &buffer](Idx scenario) {
+            return info.elements_per_scenario < 0 ? buffer.indptr[scenario] : scenario * info.elements_per_scenario;
+        };
 
-        // handle indptr
-        if (info.elements_per_scenario < 0) {
-            // first always zero
-            buffer.indptr.front() = 0;
-            // accumulate sum
-            std::transform_inclusive_scan(
-                msg_data.cbegin(), msg_data.cend(), buffer.indptr.begin() + 1, std::plus{},
-                [](auto const& x) { return x.size; }, Idx{});
-        }
+        // set nan
+        set_nan(row_or_column_tag, buffer, info, scenario_offset(begin_scenario), scenario_offset(end_scenario));
 
         // attributes
         std::span<MetaAttribute const* const> const attributes = [this,
                                                                   &info]() -> std::span<MetaAttribute const* const> {
-            if (auto const it = attributes_.find(info.component); it != attributes_.cend()) {
+            auto const& predefined_attributes = pre_parsed().attributes_;
+            if (auto const it = predefined_attributes.find(info.component); it != predefined_attributes.cend()) {
                 return it->second;
             }
             return {};
@@ -908,10 +1051,8 @@ class Deserializer {
         BufferView const buffer_view{
             .buffer = &buffer, .idx = 0, .reordered_attribute_buffers = reordered_attribute_buffers};
 
-        // all scenarios
-        for (scenario_number_ = 0; scenario_number_ != batch_size; ++scenario_number_) {
-            Idx const scenario_offset = info.elements_per_scenario < 0 ? buffer_view.buffer->indptr[scenario_number_]
-                                                                       : scenario_number_ * info.elements_per_scenario;
+        // all scenarios in the range
+        for (scenario_number_ = begin_scenario; scenario_number_ != end_scenario; ++scenario_number_) {
 #ifndef NDEBUG
             if (info.elements_per_scenario < 0) {
                 assert(buffer_view.buffer->indptr[scenario_number_ + 1] -
@@ -922,7 +1063,7 @@ class Deserializer {
                 assert(info.elements_per_scenario == msg_data[scenario_number_].size);
             }
 #endif
-            BufferView const scenario = advance(buffer_view, scenario_offset);
+            BufferView const scenario = advance(buffer_view, scenario_offset(scenario_number_));
             parse_scenario(row_or_column_tag, *info.component, scenario, msg_data[scenario_number_], attributes);
         }
         scenario_number_ = -1;
@@ -1100,19 +1241,22 @@ class Deserializer {
         }
     }
 
-    static void set_nan(row_based_t /*tag*/, Buffer const& buffer, ComponentInfo const& info) {
+    // set nan for the elements [begin, end)
+    static void set_nan(row_based_t /*tag*/, Buffer const& buffer, ComponentInfo const& info, Idx begin, Idx end) {
         assert(is_row_based(buffer));
-        info.component->set_nan(buffer.data, 0, info.total_elements);
+        info.component->set_nan(buffer.data, begin, end - begin);
     }
-    static void set_nan(columnar_t /*tag*/, Buffer const& buffer, ComponentInfo const& info) {
+    static void set_nan(columnar_t /*tag*/, Buffer const& buffer, ComponentInfo const& /*info*/, Idx begin,
+                        Idx end) {
         assert(is_columnar(buffer));
         for (auto const& attribute_buffer : buffer.attributes) {
             if (attribute_buffer.meta_attribute != nullptr) {
-                ctype_func_selector(attribute_buffer.meta_attribute->ctype, [&attribute_buffer, &info]<typename T> {
-                    std::ranges::fill(std::span{reinterpret_cast<T*>(attribute_buffer.data),
-                                                narrow_cast<size_t>(info.total_elements)},
-                                      nan_value<T>());
-                });
+                ctype_func_selector(
+                    attribute_buffer.meta_attribute->ctype, [&attribute_buffer, begin, end]<typename T> {
+                        std::ranges::fill(std::span{reinterpret_cast<T*>(attribute_buffer.data) + begin,
+                                                    narrow_cast<size_t>(end - begin)},
+                                          nan_value<T>());
+                    });
             }
         }
     }
@@ -15,6 +15,7 @@
 #include "math_solver/y_bus.hpp"
 
 #include <concepts>
+#include <vector>
 
 namespace power_grid_model {
 
@@ -79,48 +80,79 @@ decltype(auto) inline calculation_type_symmetry_func_selector(CalculationType ca
 template <typename T, typename sym> struct Calculator;
 
 template <symmetry_tag sym> struct Calculator<power_flow_t, sym> {
-    template <typename State>
-    static auto preparer(State const& state, ComponentToMathCoupling& /*comp_coup*/,
+    template <typename State, typename InputCache>
+    static auto preparer(State const& state, ComponentToMathCoupling& /*comp_coup*/, InputCache& input_cache,
                          MainModelOptions const& /*options*/) {
-        return [&state](Idx n_math_solvers) { return main_core::prepare_power_flow_input<sym>(state, n_math_solvers); };
+        using ModelType = InputCache::ImplType;
+        return [&state, &input_cache](Idx n_math_solvers) -> std::vector<PowerFlowInput<sym>> const& {
+            return input_cache.template prepare<PowerFlowInput<sym>>(
+                state.math_topology,
+                [&state, n_math_solvers](std::vector<PowerFlowInput<sym>>& input) {
+                    main_core::prepare_power_flow_input<sym>(state, n_math_solvers, input);
+                },
+                [&state](typename ModelType::SequenceIdx const& updated_components,
+                         std::vector<PowerFlowInput<sym>>& input) {
+                    main_core::update_power_flow_input<sym, ModelType>(state, updated_components, input);
+                });
+        };
     }
-    static auto solver(CalculationMethod calculation_method, MainModelOptions const& options, bool cache_run,
-                       Logger& logger) {
-        return [calculation_method, err_tol = options.err_tol, max_iter = options.max_iter, &logger,
-                cache_run](MathSolverProxy<sym>& solver, YBus<sym> const& y_bus, PowerFlowInput<sym> const& input) {
-            return solver.get().run_power_flow(input, err_tol, max_iter, cache_run, logger, calculation_method, y_bus);
+    static auto solver(CalculationMethod calculation_method, MainModelOptions const& options, bool cache_run) {
+        return [calculation_method, err_tol = options.err_tol, max_iter = options.max_iter, cache_run,
+                initialization = options.pf_initialization, output_request = options.solver_output_request](
+                   MathSolverProxy<sym>& solver, YBus<sym> const& y_bus, PowerFlowInput<sym> const& input,
+                   Logger& logger) {
+            return solver.get().run_power_flow(input, err_tol, max_iter, cache_run, logger, calculation_method, y_bus,
+                                               initialization, output_request);
         };
     }
 };
 template <symmetry_tag sym> struct Calculator<state_estimation_t, sym> {
-    template <typename State>
-    static auto preparer(State const& state, ComponentToMathCoupling& /*comp_coup*/,
+    template <typename State, typename InputCache>
+    static auto preparer(State const& state, ComponentToMathCoupling& /*comp_coup*/, InputCache& input_cache,
                          MainModelOptions const& /*options*/) {
-        return [&state](Idx n_math_solvers) {
-            return main_core::prepare_state_estimation_input<sym>(state, n_math_solvers);
+        using ModelType = InputCache::ImplType;
+        return [&state, &input_cache](Idx n_math_solvers) -> std::vector<StateEstimationInput<sym>> const& {
+            return input_cache.template prepare<StateEstimationInput<sym>>(
+                state.math_topology,
+                [&state, n_math_solvers](std::vector<StateEstimationInput<sym>>& input) {
+                    main_core::prepare_state_estimation_input<sym>(state, n_math_solvers, input);
+                },
+                [&state](typename ModelType::SequenceIdx const& updated_components,
+                         std::vector<StateEstimationInput<sym>>& input) {
+                    main_core::update_state_estimation_input<sym, ModelType>(state, updated_components, input);
+                });
         };
     }
-    static auto solver(CalculationMethod calculation_method, MainModelOptions const& options, bool /*cache_run*/,
-                       Logger& logger) {
+    static auto solver(CalculationMethod calculation_method, MainModelOptions const& options, bool /*cache_run*/) {
         return [calculation_method, err_tol = options.err_tol, max_iter = options.max_iter,
-                &logger](MathSolverProxy<sym>& solver, YBus<sym> const& y_bus, StateEstimationInput<sym> const& input) {
-            return solver.get().run_state_estimation(input, err_tol, max_iter, logger, calculation_method, y_bus);
+                output_request = options.solver_output_request,
+                observability_check_only = options.observability_check_only](
+                   MathSolverProxy<sym>& solver, YBus<sym> const& y_bus, StateEstimationInput<sym> const& input,
+                   Logger& logger) {
+            if (observability_check_only) {
+                solver.get().check_observability(input, logger, y_bus);
+                return SolverOutput<sym>{};
+            }
+            return solver.get().run_state_estimation(input, err_tol, max_iter, logger, calculation_method, y_bus,
+                                                     output_request);
         };
     }
 };
 
 template <symmetry_tag sym> struct Calculator<short_circuit_t, sym> {
-    template <typename State>
-    static auto preparer(State const& state, ComponentToMathCoupling& comp_coup, MainModelOptions const& options) {
+    // the short circuit input depends on the faults and is always prepared from scratch
+    template <typename State, typename InputCache>
+    static auto preparer(State const& state, ComponentToMathCoupling& comp_coup, InputCache& /*input_cache*/,
+                         MainModelOptions const& options) {
         return [&state, &comp_coup, voltage_scaling = options.short_circuit_voltage_scaling](Idx n_math_solvers) {
             return main_core::prepare_short_circuit_input<sym>(state, comp_coup, n_math_solvers, voltage_scaling);
         };
     }
-    static auto solver(CalculationMethod calculation_method, MainModelOptions const& /*options*/, bool /*cache_run*/,
-                       Logger& logger) {
-        return [calculation_method, &logger](MathSolverProxy<sym>& solver, YBus<sym> const& y_bus,
-                                             ShortCircuitInput const& input) {
-            return solver.get().run_short_circuit(input, logger, calculation_method, y_bus);
+    static auto solver(CalculationMethod calculation_method, MainModelOptions const& options, bool /*cache_run*/) {
+        return [calculation_method, output_request = options.solver_output_request](
+                   MathSolverProxy<sym>& solver, YBus<sym> const& y_bus, ShortCircuitInput const& input,
+                   Logger& logger) {
+            return solver.get().run_short_circuit(input, logger, calculation_method, y_bus, output_request);
         };
     }
 };
@@ -335,6 +335,13 @@ static_assert(calculation_input_type<ShortCircuitInput>);
 
 struct solver_output_t {};
 
+// the flows that the solvers calculate from the bus voltages after the calculation
+// a flow that is not requested is skipped, in which case the corresponding solver output is left empty
+struct SolverOutputRequest {
+    bool branch_flow{true};
+    bool shunt_flow{true};
+};
+
 template <symmetry_tag sym_type> struct SolverOutput {
     using type = solver_output_t;
     using sym = sym_type;
@@ -7,6 +7,7 @@
 #include "calculation_parameters.hpp"
 #include "common/common.hpp"
 #include "common/counting_iterator.hpp"
+#include "common/enum.hpp"
 #include "common/exception.hpp"
 #include "component/component.hpp"
 #include "component/load_gen.hpp"
@@ -14,6 +15,7 @@
 #include "main_core/main_model_type.hpp"
 #include "main_core/math_state.hpp"
 #include "main_core/topology.hpp"
+#include "main_core/topology_snapshot.hpp"
 #include "main_core/y_bus.hpp"
 #include "math_solver/math_solver_dispatch.hpp"
 #include "supernodes.hpp"
@@ -21,13 +23,18 @@
 
 #include <algorithm>
 #include <cassert>
+#include <memory>
+#include <span>
 #include <unordered_map>
+#include <variant>
 #include <vector>
 
 namespace power_grid_model {
 struct SolverPreparationContext {
     main_core::MathState math_state;
     MathSolverDispatcher const* math_solver_dispatcher;
+    // the fill-reducing ordering used when the topology is (re)built
+    SparseOrderingMethod sparse_ordering_method{SparseOrderingMethod::minimum_degree};
 };
 
 template <class ModelType>
@@ -114,6 +121,79 @@ class SolversCacheStatus {
     }
 };
 
+// Cache of the calculation input of the previous power flow or state estimation, e.g., of the previous scenario in a
+// batch calculation. The components updated since then are recorded, and only their input is recalculated if the
+// math topology did not change. Otherwise, all input is recalculated into the existing buffers.
+template <class ModelType>
+    requires(main_core::is_main_model_type_v<ModelType>)
+class CalculationInputCache {
+  public:
+    using ImplType = ModelType;
+    using SequenceIdx = ModelType::SequenceIdx;
+    using MathTopologies = std::vector<std::shared_ptr<MathModelTopology const>>;
+
+    // record the updated components of one type
+    // if more components are updated than there are, it is cheaper to recalculate all input
+    template <size_t comp_index> void record_updated_components(std::span<Idx2D const> sequence_idx, Idx n_components) {
+        if (std::holds_alternative<std::monostate>(input_) || full_refresh_) {
+            return;
+        }
+        auto& updated = std::get<comp_index>(updated_components_indices_);
+        if (std::ssize(updated) + std::ssize(sequence_idx) > n_components) {
+            full_refresh_ = true;
+            clear_updated_components_indices();
+            return;
+        }
+        updated.insert(updated.end(), sequence_idx.begin(), sequence_idx.end());
+    }
+
+    // recalculate all input in the next preparation, e.g., if it is unknown which components are updated
+    void request_full_refresh() {
+        full_refresh_ = true;
+        clear_updated_components_indices();
+    }
+
+    // get the calculation input for the given math topology
+    // prepare_all(std::vector<InputType>&) recalculates all input
+    // update(SequenceIdx const&, std::vector<InputType>&) recalculates the input of the updated components
+    template <typename InputType, typename PrepareAllFn, typename UpdateFn>
+        requires std::invocable<PrepareAllFn, std::vector<InputType>&> &&
+                 std::invocable<UpdateFn, SequenceIdx const&, std::vector<InputType>&>
+    std::vector<InputType> const& prepare(MathTopologies const& math_topology, PrepareAllFn prepare_all,
+                                          UpdateFn update) {
+        auto* const cached_input = std::get_if<std::vector<InputType>>(&input_);
+        if (cached_input == nullptr || full_refresh_ || math_topology != math_topology_) {
+            // take over the buffers of the previous input of the same type, if any
+            std::vector<InputType> input =
+                cached_input == nullptr ? std::vector<InputType>{} : std::move(*cached_input);
+            input_ = std::monostate{}; // nothing is cached if the preparation throws
+            prepare_all(input);
+            input_ = std::move(input);
+            math_topology_ = math_topology;
+            full_refresh_ = false;
+        } else {
+            full_refresh_ = true; // the input is incomplete if the update throws
+            update(updated_components_indices_, *cached_input);
+            full_refresh_ = false;
+        }
+        clear_updated_components_indices();
+        return std::get<std::vector<InputType>>(input_);
+    }
+
+  private:
+    std::variant<std::monostate, std::vector<PowerFlowInput<symmetric_t>>, std::vector<PowerFlowInput<asymmetric_t>>,
+                 std::vector<StateEstimationInput<symmetric_t>>, std::vector<StateEstimationInput<asymmetric_t>>>
+        input_;
+    // the math topology of the cached input, which keeps the old topology alive so that the comparison is reliable
+    MathTopologies math_topology_;
+    SequenceIdx updated_components_indices_{};
+    bool full_refresh_{false};
+
+    void clear_updated_components_indices() {
+        std::ranges::for_each(updated_components_indices_, [](auto& comps) { comps.clear(); });
+    }
+};
+
 namespace detail {
 template <class ModelType>
 inline void reset_solvers(typename ModelType::MainModelState& state, SolverPreparationContext& solver_context,
@@ -147,7 +227,7 @@ inline void rebuild_topology(typename ModelType::MainModelState& state, SolverPr
 
     state.reduced_topology =
         std::make_shared<ReducedTopology const>(supernodes::reduce_topology(*state.comp_topo, comp_conn));
-    Topology topology{state.reduced_topology->reduced_comp_topo, comp_conn};
+    Topology topology{state.reduced_topology->reduced_comp_topo, comp_conn, solver_context.sparse_ordering_method};
     std::tie(state.math_topology, state.topo_comp_coup) = topology.build_topology();
 
     solvers_cache_status.set_topology_status(true);
@@ -155,6 +235,42 @@ inline void rebuild_topology(typename ModelType::MainModelState& state, SolverPr
     solvers_cache_status.template set_parameter_status<asymmetric_t>(false);
 }
 
+// write the topology to a snapshot sink, building it first if needed, see main_core/topology_snapshot.hpp
+template <class ModelType, typename Sink>
+inline void save_topology_snapshot(typename ModelType::MainModelState& state, SolverPreparationContext& solver_context,
+                                   SolversCacheStatus<ModelType>& solvers_cache_status, Sink& sink) {
+    if (!solvers_cache_status.is_topology_valid()) {
+        rebuild_topology(state, solver_context, solvers_cache_status);
+    }
+    ComponentConnections const comp_conn = main_core::construct_components_connections<ModelType>(state.components);
+    main_core::write_topology_snapshot(sink, *state.comp_topo, comp_conn, state.math_topology, *state.topo_comp_coup,
+                                       solver_context.sparse_ordering_method);
+}
+
+// restore the topology from a snapshot instead of building it
+// the snapshot is validated against the components before anything is changed
+template <class ModelType>
+inline void load_topology_snapshot(typename ModelType::MainModelState& state, SolverPreparationContext& solver_context,
+                                   SolversCacheStatus<ModelType>& solvers_cache_status,
+                                   std::span<char const> snapshot) {
+    ComponentConnections const comp_conn = main_core::construct_components_connections<ModelType>(state.components);
+    main_core::TopologySnapshot restored = main_core::read_topology_snapshot(snapshot, *state.comp_topo, comp_conn,
+                                                                             solver_context.sparse_ordering_method);
+
+    // clear old solvers
+    reset_solvers(state, solver_context, solvers_cache_status);
+
+    // the reduction of the links is linear and cheap, so it is not part of the snapshot
+    state.reduced_topology =
+        std::make_shared<ReducedTopology const>(supernodes::reduce_topology(*state.comp_topo, comp_conn));
+    state.math_topology = std::move(restored.math_topology);
+    state.topo_comp_coup = std::move(restored.topo_comp_coup);
+
+    solvers_cache_status.set_topology_status(true);
+    solvers_cache_status.template set_parameter_status<symmetric_t>(false);
+    solvers_cache_status.template set_parameter_status<asymmetric_t>(false);
+}
+
 struct ReferenceVoltageRegulator {
     ID voltage_regulator_id = na_IntID;
     double u_ref = nan;
@@ -240,6 +356,8 @@ template <symmetry_tag sym, class ModelType>
 inline void prepare_solvers(typename ModelType::MainModelState& state, SolverPreparationContext& solver_context,
                             SolversCacheStatus<ModelType>& solvers_cache_status) {
     std::vector<MathSolverProxy<sym>>& solvers = main_core::get_solvers<sym>(solver_context.math_state);
+    // the calculation parameters are gathered from the component columns
+    main_core::prepare_component_columns<sym>(state.components, state.columns);
     // rebuild topology if needed
     if (!solvers_cache_status.is_topology_valid()) {
         detail::rebuild_topology(state, solver_context, solvers_cache_status);
@@ -256,10 +374,6 @@ inline void prepare_solvers(typename ModelType::MainModelState& state, SolverPre
                                [&solver_context](auto const& math_topo) {
                                    return MathSolverProxy<sym>{solver_context.math_solver_dispatcher, math_topo};
                                });
-        for (Idx const idx : IdxRange{n_math_solvers}) {
-            main_core::get_y_bus<sym>(solver_context.math_state)[idx].register_parameters_changed_callback(
-                [solver = std::ref(solvers[idx])](bool changed) { solver.get().get().parameters_changed(changed); });
-        }
     } else if (!solvers_cache_status.template is_parameter_valid<sym>()) {
         if (solvers_cache_status.template is_symmetry_mode_conserved<sym>()) {
             main_core::update_y_bus(solver_context.math_state,
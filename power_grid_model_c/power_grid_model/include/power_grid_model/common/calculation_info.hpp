@@ -13,6 +13,8 @@
 #include <map>
 #include <string_view>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace power_grid_model {
 namespace common::logging {
@@ -72,6 +74,10 @@ class CalculationInfo : public Logger {
         case iterate_unknown:
         case calculate_math_result:
         case produce_output:
+        case prefactorization_cache_hit:
+        case prefactorization_cache_miss:
+        case observability_cache_hit:
+        case observability_cache_miss:
             accumulate_log(tag, value);
             return;
         case iterative_pf_solver_max_num_iter:
@@ -111,8 +117,126 @@ class MultiThreadedCalculationInfo : public MultiThreadedLoggerImpl<CalculationI
     Report report() const { return get().report(); }
     void clear() { get().clear(); }
 };
+// calculation info with a breakdown per scenario of a batch calculation
+// the events between begin_scenario and end_scenario are both aggregated in the total report
+//    and recorded as the report of that scenario
+class ScenarioCalculationInfo : public Logger {
+  public:
+    struct ScenarioEntry {
+        Idx run{}; // the index of the batch calculation
+        Idx scenario{};
+        LogEvent tag{LogEvent::unknown};
+        double value{};
+    };
+    using Report = CalculationInfo::Report;
+    using ScenarioReport = std::vector<ScenarioEntry>;
+    using Logger::log;
+
+    ScenarioCalculationInfo() = default;
+    ScenarioCalculationInfo(ScenarioCalculationInfo const&) = default;
+    ScenarioCalculationInfo(ScenarioCalculationInfo&&) noexcept = default;
+    ScenarioCalculationInfo& operator=(ScenarioCalculationInfo const&) = default;
+    ScenarioCalculationInfo& operator=(ScenarioCalculationInfo&&) noexcept = default;
+    ~ScenarioCalculationInfo() override = default;
+
+    void log(LogEvent tag) override {
+        if (tag == LogEvent::end_scenario) {
+            end_scenario();
+        } else if (tag == LogEvent::begin_batch) {
+            end_scenario();
+            ++run_;
+        }
+    }
+    void log(LogEvent /*tag*/, std::string_view /*message*/) override { /* ignore all such events for now */ }
+    void log(LogEvent tag, double value) override { log_impl(tag, value); }
+    void log(LogEvent tag, Idx value) override {
+        if (tag == LogEvent::begin_scenario) {
+            begin_scenario(value);
+        } else {
+            log_impl(tag, static_cast<double>(value));
+        }
+    }
+    void log(std::string_view /*message*/) const { /* ignore all such events for now */ }
+    template <LazyLoggingFn Fn> void log(LogEvent /*tag*/, Fn /*fn*/) const { /*do nothing*/ }
+    template <LazyLoggingFn Fn> void log(Fn /*fn*/) const { /*do nothing*/ }
+
+    Report report() const { return total_.report(); }
+    // the entries of all finished scenarios, in order of the batch calculations and sorted by scenario within each
+    ScenarioReport scenario_report() const {
+        ScenarioReport result = scenario_entries_;
+        std::ranges::stable_sort(result, {}, [](ScenarioEntry const& entry) {
+            return std::pair{entry.run, entry.scenario};
+        });
+        return result;
+    }
+    Idx n_scenario_entries() const { return std::ssize(scenario_entries_); }
+    void clear() {
+        total_.clear();
+        current_.clear();
+        current_scenario_ = no_scenario;
+        run_ = 0;
+        scenario_entries_.clear();
+    }
+
+    ScenarioCalculationInfo& merge_into(ScenarioCalculationInfo& destination) const {
+        if (&destination == this) {
+            return destination; // nothing to do
+        }
+        total_.merge_into(destination.total_);
+        // the runs are counted from the current batch calculation of the destination
+        for (ScenarioEntry entry : scenario_entries_) {
+            entry.run += destination.run_;
+            destination.scenario_entries_.push_back(entry);
+        }
+        return destination;
+    }
+
+  private:
+    static constexpr Idx no_scenario = -1;
+
+    CalculationInfo total_;
+    CalculationInfo current_;
+    Idx current_scenario_{no_scenario};
+    Idx run_{};
+    ScenarioReport scenario_entries_;
+
+    void log_impl(LogEvent tag, double value) {
+        total_.log(tag, value);
+        if (current_scenario_ != no_scenario) {
+            current_.log(tag, value);
+        }
+    }
+    void begin_scenario(Idx scenario) {
+        end_scenario();
+        current_scenario_ = scenario;
+    }
+    void end_scenario() {
+        if (current_scenario_ == no_scenario) {
+            return;
+        }
+        for (auto const& [tag, value] : current_.report()) {
+            scenario_entries_.push_back({.run = run_, .scenario = current_scenario_, .tag = tag, .value = value});
+        }
+        current_.clear();
+        current_scenario_ = no_scenario;
+    }
+};
+
+class MultiThreadedScenarioCalculationInfo : public MultiThreadedLoggerImpl<ScenarioCalculationInfo> {
+  public:
+    using MultiThreadedLoggerImpl<ScenarioCalculationInfo>::MultiThreadedLoggerImpl;
+    using Report = ScenarioCalculationInfo::Report;
+    using ScenarioReport = ScenarioCalculationInfo::ScenarioReport;
+
+    Report report() const { return get().report(); }
+    ScenarioReport scenario_report() const { return get().scenario_report(); }
+    Idx n_scenario_entries() const { return get().n_scenario_entries(); }
+    void clear() { get().clear(); }
+};
 } // namespace common::logging
 
 using common::logging::CalculationInfo;
 using common::logging::MultiThreadedCalculationInfo;
+using common::logging::MultiThreadedScenarioCalculationInfo;
+using common::logging::ScenarioCalculationInfo;
 } // namespace power_grid_model
@@ -131,6 +131,16 @@ enum class SearchMethod : IntS { // Which type of tap search method for finite e
     binary_search = 1,           // use binary search: half a tap range at a time
 };
 
+enum class PowerFlowInitialization : IntS { // Initial voltages of the iterative power flow methods
+    cold_start = 0, // start from the method's own initial guess (linear guess or flat start)
+    warm_start = 1, // start from the last converged solution of the same solver, if available
+};
+
+enum class SparseOrderingMethod : IntS { // Fill-reducing ordering of the meshed part of a math model
+    minimum_degree = 0,                  // exact minimum degree with explicit clique construction
+    approximate_minimum_degree = 1,      // approximate minimum degree on a quotient graph in flat arrays
+};
+
 enum class AngleMeasurementType : IntS { // The type of the angle measurement for current sensors
     local_angle = 0,                     // local_angle = 0, the angle is relative to the local voltage angle
     global_angle = 1,                    // global_angle = 1, the angle is relative to the global voltage angle
@@ -0,0 +1,166 @@
+// SPDX-FileCopyrightText: Contributors to the Power Grid Model project <powergridmodel@lfenergy.org>
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+// Flat open-addressing hash index from component ID to Idx2D
+// The keys and the values are stored in two contiguous arrays with linear probing,
+//    instead of one heap-allocated node per entry as in std::unordered_map.
+// Only the keys are visited during probing, so that a lookup usually touches one cache line of keys
+//    and one cache line of values.
+
+#include "common.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <ranges>
+#include <vector>
+
+namespace power_grid_model {
+
+class FlatIdIndex {
+  public:
+    Idx size() const { return size_; }
+
+    void reserve(Idx size) {
+        size_t capacity = keys_.size();
+        while (exceeds_max_load(size, capacity)) {
+            capacity = std::max(min_capacity, capacity * 2);
+        }
+        if (capacity != keys_.size()) {
+            rehash(capacity);
+        }
+    }
+
+    bool contains(ID id) const { return find(id) != nullptr; }
+
+    // nullptr if the id is not in the index
+    Idx2D const* find(ID id) const {
+        if (id == empty_key) {
+            return has_empty_key_ ? &empty_key_value_ : nullptr;
+        }
+        if (keys_.empty()) {
+            return nullptr;
+        }
+        for (size_t slot = home_slot(id);; slot = (slot + 1) & mask_) {
+            if (keys_[slot] == id) {
+                return &values_[slot];
+            }
+            if (keys_[slot] == empty_key) {
+                return nullptr;
+            }
+        }
+    }
+
+    // find all ids of the range in order, and call func(id, find(id)) for each of them
+    // the home slots of the next ids are prefetched, so that the cache misses of consecutive lookups overlap
+    template <std::ranges::forward_range IDs, typename Func> void find_each(IDs&& ids, Func&& func) const {
+        auto const end = std::ranges::end(ids);
+        auto ahead = std::ranges::begin(ids);
+        for (Idx step = 0; step != prefetch_distance && ahead != end; ++step, ++ahead) {
+            prefetch(static_cast<ID>(*ahead));
+        }
+        for (auto it = std::ranges::begin(ids); it != end; ++it) {
+            if (ahead != end) {
+                prefetch(static_cast<ID>(*ahead));
+                ++ahead;
+            }
+            auto const id = static_cast<ID>(*it);
+            func(id, find(id));
+        }
+    }
+
+    // the id should not be in the index yet
+    void insert(ID id, Idx2D idx_2d) {
+        assert(!contains(id));
+        if (id == empty_key) {
+            has_empty_key_ = true;
+            empty_key_value_ = idx_2d;
+            ++size_;
+            return;
+        }
+        reserve(size_ + 1);
+        insert_new(id, idx_2d);
+        ++size_;
+    }
+
+    // reverse lookup by scanning all entries, only for debugging purpose
+    std::optional<ID> find_id(Idx2D idx_2d) const {
+        if (has_empty_key_ && empty_key_value_ == idx_2d) {
+            return empty_key;
+        }
+        for (size_t slot = 0; slot != keys_.size(); ++slot) {
+            if (keys_[slot] != empty_key && values_[slot] == idx_2d) {
+                return keys_[slot];
+            }
+        }
+        return std::nullopt;
+    }
+
+  private:
+    // the not-available ID marks an empty slot, it is stored separately if it is used as a real key
+    static constexpr ID empty_key = na_IntID;
+    static constexpr size_t min_capacity = 16;
+    static constexpr Idx prefetch_distance = 8;
+
+    std::vector<ID> keys_;
+    std::vector<Idx2D> values_;
+    size_t mask_{};
+    int shift_{};
+    Idx size_{};
+    bool has_empty_key_{false};
+    Idx2D empty_key_value_{};
+
+    // the load factor is at most 3/4 for the keys stored in the slots
+    bool exceeds_max_load(Idx size, size_t capacity) const {
+        auto const n_slot_keys = static_cast<size_t>(size - (has_empty_key_ ? 1 : 0));
+        return n_slot_keys * 4 > capacity * 3;
+    }
+
+    // Fibonacci hashing, the multiplication mixes the consecutive ids that are common in grid data
+    size_t home_slot(ID id) const {
+        constexpr uint64_t golden_ratio = 0x9E3779B97F4A7C15ULL;
+        return static_cast<size_t>((static_cast<uint64_t>(static_cast<uint32_t>(id)) * golden_ratio) >> shift_);
+    }
+
+    void prefetch([[maybe_unused]] ID id) const {
+#if defined(__GNUC__) || defined(__clang__)
+        if (!keys_.empty() && id != empty_key) {
+            size_t const slot = home_slot(id);
+            __builtin_prefetch(&keys_[slot]);
+            __builtin_prefetch(&values_[slot]);
+        }
+#endif // __GNUC__ || __clang__
+    }
+
+    void insert_new(ID id, Idx2D idx_2d) {
+        size_t slot = home_slot(id);
+        while (keys_[slot] != empty_key) {
+            slot = (slot + 1) & mask_;
+        }
+        keys_[slot] = id;
+        values_[slot] = idx_2d;
+    }
+
+    void rehash(size_t capacity) {
+        assert(std::has_single_bit(capacity));
+        std::vector<ID> old_keys(capacity, empty_key);
+        std::vector<Idx2D> old_values(capacity);
+        old_keys.swap(keys_);
+        old_values.swap(values_);
+        mask_ = capacity - 1;
+        shift_ = 64 - std::countr_zero(capacity);
+        for (size_t slot = 0; slot != old_keys.size(); ++slot) {
+            if (old_keys[slot] != empty_key) {
+                insert_new(old_keys[slot], old_values[slot]);
+            }
+        }
+    }
+};
+
+} // namespace power_grid_model
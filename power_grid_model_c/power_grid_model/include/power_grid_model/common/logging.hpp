@@ -23,6 +23,9 @@ enum class LogEvent : int16_t {
     restore_model = 1201,
     scenario_exception = 1300,
     recover_from_bad = 1400,
+    begin_scenario = 1500, // the value is the index of the scenario in the batch
+    end_scenario = 1501,
+    begin_batch = 1502, // the scenarios of a new batch calculation follow
     prepare = 2100,
     create_math_solver = 2210,
     math_calculation = 2200,
@@ -42,8 +45,92 @@ enum class LogEvent : int16_t {
     produce_output = 3000,
     iterative_pf_solver_max_num_iter = 2246, // TODO(mgovers): find other error code
     max_num_iter = 2248,                     // TODO(mgovers): find other error code
+    prefactorization_cache_hit = 2250,
+    prefactorization_cache_miss = 2251,
+    observability_cache_hit = 2252,
+    observability_cache_miss = 2253,
 };
 
+constexpr std::string_view to_string(LogEvent tag) {
+    using enum LogEvent;
+
+    switch (tag) {
+    case total:
+        return "total";
+    case build_model:
+        return "build_model";
+    case total_single_calculation_in_thread:
+        return "total_single_calculation_in_thread";
+    case total_batch_calculation_in_thread:
+        return "total_batch_calculation_in_thread";
+    case copy_model:
+        return "copy_model";
+    case update_model:
+        return "update_model";
+    case restore_model:
+        return "restore_model";
+    case scenario_exception:
+        return "scenario_exception";
+    case recover_from_bad:
+        return "recover_from_bad";
+    case begin_scenario:
+        return "begin_scenario";
+    case end_scenario:
+        return "end_scenario";
+    case begin_batch:
+        return "begin_batch";
+    case prepare:
+        return "prepare";
+    case create_math_solver:
+        return "create_math_solver";
+    case math_calculation:
+        return "math_calculation";
+    case math_solver:
+        return "math_solver";
+    case initialize_calculation:
+        return "initialize_calculation";
+    case preprocess_measured_value:
+        return "preprocess_measured_value";
+    case prepare_matrix:
+        return "prepare_matrix";
+    case prepare_matrix_including_prefactorization:
+        return "prepare_matrix_including_prefactorization";
+    case prepare_matrices:
+        return "prepare_matrices";
+    case initialize_voltages:
+        return "initialize_voltages";
+    case calculate_rhs:
+        return "calculate_rhs";
+    case prepare_lhs_rhs:
+        return "prepare_lhs_rhs";
+    case solve_sparse_linear_equation:
+        return "solve_sparse_linear_equation";
+    case solve_sparse_linear_equation_prefactorized:
+        return "solve_sparse_linear_equation_prefactorized";
+    case iterate_unknown:
+        return "iterate_unknown";
+    case calculate_math_result:
+        return "calculate_math_result";
+    case produce_output:
+        return "produce_output";
+    case iterative_pf_solver_max_num_iter:
+        return "iterative_pf_solver_max_num_iter";
+    case max_num_iter:
+        return "max_num_iter";
+    case prefactorization_cache_hit:
+        return "prefactorization_cache_hit";
+    case prefactorization_cache_miss:
+        return "prefactorization_cache_miss";
+    case observability_cache_hit:
+        return "observability_cache_hit";
+    case observability_cache_miss:
+        return "observability_cache_miss";
+    case unknown:
+    default:
+        return "unknown";
+    }
+}
+
 template <typename Fn>
 concept LazyLoggingFn = std::invocable<Fn> && std::convertible_to<std::invoke_result_t<Fn>, std::string> &&
                         (!std::convertible_to<Fn, std::string_view>) && functor_c<Fn>;
@@ -0,0 +1,216 @@
+// SPDX-FileCopyrightText: Contributors to the Power Grid Model project <powergridmodel@lfenergy.org>
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+// Tracing logger that records the timeline of the calculations, e.g., to find thread imbalance or slow scenarios.
+// The Timer logs the duration of a phase when it stops, so the phase is recorded as a complete event that ends now.
+// Each thread logs into its own child logger without any locking.
+// The events of a logger are kept in a ring buffer, so that only the most recent events are kept for long runs.
+// The events of a child are appended to the parent once, when the thread is done.
+// The events can be written in the Chrome trace event format, to be viewed in chrome://tracing or Perfetto.
+
+#include "common.hpp"
+#include "exception.hpp"
+#include "logging.hpp"
+#include "multi_threaded_logging.hpp"
+#include "timer.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <ios>
+#include <iomanip>
+#include <map>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace power_grid_model {
+namespace common::logging {
+class TraceLogger : public Logger {
+  public:
+    static constexpr Idx no_scenario = -1;
+    static constexpr Idx default_capacity = Idx{1} << 16; // per logger, i.e., per thread
+
+    enum class EventKind : int8_t {
+        complete = 0, // a phase with a duration, e.g., from a Timer
+        instant = 1,  // a counter value at one moment, e.g., the number of iterations
+    };
+
+    struct TraceEvent {
+        LogEvent tag{LogEvent::unknown};
+        EventKind kind{EventKind::complete};
+        Idx scenario{no_scenario};
+        Idx value{};
+        std::thread::id thread;
+        Clock::time_point begin;
+        Clock::time_point end;
+    };
+
+    using Logger::log;
+
+    TraceLogger() = default;
+    explicit TraceLogger(Idx capacity) : capacity_{std::max(capacity, Idx{1})} {}
+    TraceLogger(TraceLogger const&) = default;
+    TraceLogger(TraceLogger&&) noexcept = default;
+    TraceLogger& operator=(TraceLogger const&) = default;
+    TraceLogger& operator=(TraceLogger&&) noexcept = default;
+    ~TraceLogger() override = default;
+
+    void log(LogEvent tag) override {
+        if (tag == LogEvent::end_scenario) {
+            current_scenario_ = no_scenario;
+        }
+    }
+    void log(LogEvent /*tag*/, std::string_view /*message*/) override { /* ignore all such events for now */ }
+    void log(LogEvent tag, double value) override {
+        auto const now = Clock::now();
+        record({.tag = tag,
+                .kind = EventKind::complete,
+                .scenario = current_scenario_,
+                .thread = std::this_thread::get_id(),
+                .begin = now - std::chrono::duration_cast<Clock::duration>(Duration{value}),
+                .end = now});
+    }
+    void log(LogEvent tag, Idx value) override {
+        if (tag == LogEvent::begin_scenario) {
+            current_scenario_ = value;
+            return;
+        }
+        auto const now = Clock::now();
+        record({.tag = tag,
+                .kind = EventKind::instant,
+                .scenario = current_scenario_,
+                .value = value,
+                .thread = std::this_thread::get_id(),
+                .begin = now,
+                .end = now});
+    }
+    void log(std::string_view /*message*/) const { /* ignore all such events for now */ }
+    template <LazyLoggingFn Fn> void log(LogEvent /*tag*/, Fn /*fn*/) const { /*do nothing*/ }
+    template <LazyLoggingFn Fn> void log(Fn /*fn*/) const { /*do nothing*/ }
+
+    // the merged events of the children, followed by the own events, each in order of recording
+    std::vector<TraceEvent> events() const {
+        std::vector<TraceEvent> result;
+        result.reserve(merged_.size() + ring_.size());
+        result.insert(result.end(), merged_.begin(), merged_.end());
+        append_own_events(result);
+        return result;
+    }
+    Idx n_events() const { return std::ssize(merged_) + std::ssize(ring_); }
+    // the number of events that were overwritten because a ring buffer was full
+    Idx n_dropped_events() const { return n_dropped_; }
+    void clear() {
+        ring_.clear();
+        next_ = 0;
+        merged_.clear();
+        n_dropped_ = 0;
+        current_scenario_ = no_scenario;
+    }
+
+    TraceLogger& merge_into(TraceLogger& destination) const {
+        if (&destination == this) {
+            return destination; // nothing to do
+        }
+        destination.merged_.insert(destination.merged_.end(), merged_.begin(), merged_.end());
+        append_own_events(destination.merged_);
+        destination.n_dropped_ += n_dropped_;
+        return destination;
+    }
+
+    // the threads are numbered in order of appearance, the times are in microseconds since the first event
+    void write_chrome_trace(std::ostream& stream) const {
+        auto const all_events = events();
+        Clock::time_point const origin =
+            all_events.empty() ? Clock::time_point{} : std::ranges::min(all_events, {}, &TraceEvent::begin).begin;
+        std::map<std::thread::id, Idx> thread_numbers;
+        auto const microseconds = [origin](Clock::time_point time) {
+            return std::chrono::duration<double, std::micro>(time - origin).count();
+        };
+
+        std::ios_base::fmtflags const flags = stream.flags();
+        std::streamsize const precision = stream.precision();
+        stream << std::fixed << std::setprecision(3);
+        stream << R"({"displayTimeUnit":"ms","otherData":{"dropped_events":)" << n_dropped_ << R"(},"traceEvents":[)";
+        bool first = true;
+        for (TraceEvent const& event : all_events) {
+            Idx const thread_number =
+                thread_numbers.try_emplace(event.thread, std::ssize(thread_numbers)).first->second;
+            stream << (first ? "\n" : ",\n") << R"({"name":")" << to_string(event.tag)
+                   << R"(","cat":"power_grid_model","pid":0,"tid":)" << thread_number
+                   << R"(,"ts":)" << microseconds(event.begin);
+            if (event.kind == EventKind::complete) {
+                stream << R"(,"ph":"X","dur":)" << microseconds(event.end) - microseconds(event.begin);
+            } else {
+                stream << R"(,"ph":"i","s":"t")";
+            }
+            stream << R"(,"args":{)";
+            if (event.scenario != no_scenario) {
+                stream << R"("scenario":)" << event.scenario << (event.kind == EventKind::instant ? "," : "");
+            }
+            if (event.kind == EventKind::instant) {
+                stream << R"("value":)" << event.value;
+            }
+            stream << "}}";
+            first = false;
+        }
+        stream << "\n]}\n";
+        stream.flags(flags);
+        stream.precision(precision);
+    }
+    void write_chrome_trace(std::filesystem::path const& path) const {
+        std::ofstream file{path};
+        if (!file) {
+            throw SerializationError{"Cannot open the trace file for writing: " + path.string() + "\n"};
+        }
+        write_chrome_trace(static_cast<std::ostream&>(file));
+    }
+
+  private:
+    Idx capacity_{default_capacity};
+    Idx current_scenario_{no_scenario};
+    std::vector<TraceEvent> ring_; // grows up to the capacity, afterwards the oldest event is overwritten
+    Idx next_{};                   // the oldest event once the ring buffer is full
+    std::vector<TraceEvent> merged_;
+    Idx n_dropped_{};
+
+    void record(TraceEvent const& event) {
+        if (std::ssize(ring_) < capacity_) {
+            ring_.push_back(event);
+            return;
+        }
+        ring_[next_] = event;
+        next_ = (next_ + 1) % capacity_;
+        ++n_dropped_;
+    }
+
+    void append_own_events(std::vector<TraceEvent>& destination) const {
+        destination.insert(destination.end(), ring_.begin() + next_, ring_.end());
+        destination.insert(destination.end(), ring_.begin(), ring_.begin() + next_);
+    }
+};
+
+class MultiThreadedTraceLogger : public MultiThreadedLoggerImpl<TraceLogger> {
+  public:
+    using MultiThreadedLoggerImpl<TraceLogger>::MultiThreadedLoggerImpl;
+    using TraceEvent = TraceLogger::TraceEvent;
+
+    std::vector<TraceEvent> events() const { return get().events(); }
+    Idx n_events() const { return get().n_events(); }
+    Idx n_dropped_events() const { return get().n_dropped_events(); }
+    void clear() { get().clear(); }
+    void write_chrome_trace(std::ostream& stream) const { get().write_chrome_trace(stream); }
+    void write_chrome_trace(std::filesystem::path const& path) const { get().write_chrome_trace(path); }
+};
+} // namespace common::logging
+
+using common::logging::MultiThreadedTraceLogger;
+using common::logging::TraceLogger;
+} // namespace power_grid_model
@@ -9,6 +9,7 @@
 #include "common/common.hpp"
 #include "common/component_list.hpp"
 #include "common/exception.hpp"
+#include "common/flat_id_index.hpp"
 #include "common/iterator_facade.hpp"
 
 #include <algorithm>
@@ -17,11 +18,11 @@
 #include <compare>
 #include <concepts>
 #include <cstddef>
+#include <iterator>
 #include <numeric>
 #include <ranges>
 #include <tuple>
 #include <type_traits>
-#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -82,6 +83,7 @@ class Container<RetrievableTypes<GettableTypes...>, StorageableTypes...> {
     template <supported_type_c<StorageableTypes...> Storageable> void reserve(size_t size) {
         auto& vec = std::get<std::vector<Storageable>>(vectors_);
         vec.reserve(size);
+        map_.reserve(map_.size() + static_cast<Idx>(size));
     }
 
     // emplace component
@@ -99,7 +101,39 @@ class Container<RetrievableTypes<GettableTypes...>, StorageableTypes...> {
         // create object
         vec.emplace_back(std::forward<Args>(args)...);
         // insert idx to map
-        map_[id] = Idx2D{.group = group, .pos = pos};
+        map_.insert(id, Idx2D{.group = group, .pos = pos});
+    }
+
+    // register the ids of the components of one type in advance, in the order in which they will be emplaced
+    // throw if an id already exists
+    // the index is not changed by emplace_registered, so components of different types can be emplaced concurrently
+    template <supported_type_c<StorageableTypes...> Storageable, std::ranges::sized_range IDs>
+    void register_ids(IDs&& ids) {
+        assert(!construction_complete_);
+        constexpr size_t type_pos = get_cls_pos_v<Storageable, StorageableTypes...>;
+        auto const group = static_cast<Idx>(type_pos);
+        auto& vec = std::get<std::vector<Storageable>>(vectors_);
+        assert(vec.empty());
+        auto& n_registered = n_registered_[type_pos];
+        vec.reserve(static_cast<size_t>(n_registered) + std::ranges::size(ids));
+        map_.reserve(map_.size() + static_cast<Idx>(std::ranges::size(ids)));
+        for (ID const id : ids) {
+            if (map_.contains(id)) {
+                throw ConflictID{id};
+            }
+            map_.insert(id, Idx2D{.group = group, .pos = n_registered++});
+        }
+    }
+
+    // emplace component of which the id is registered by register_ids
+    template <supported_type_c<StorageableTypes...> Storageable, class... Args>
+    void emplace_registered([[maybe_unused]] ID id, Args&&... args) {
+        assert(!construction_complete_);
+        auto& vec = std::get<std::vector<Storageable>>(vectors_);
+        assert(map_.find(id) != nullptr);
+        assert((*map_.find(id) == Idx2D{.group = static_cast<Idx>(get_cls_pos_v<Storageable, StorageableTypes...>),
+                                         .pos = static_cast<Idx>(vec.size())}));
+        vec.emplace_back(std::forward<Args>(args)...);
     }
 
     // get item based on Idx2D
@@ -121,8 +155,8 @@ class Container<RetrievableTypes<GettableTypes...>, StorageableTypes...> {
 #ifndef NDEBUG
     // get id by idx, only for debugging purpose
     ID get_id_by_idx(Idx2D idx_2d) const {
-        if (auto it = std::ranges::find(map_, idx_2d, &std::pair<const ID, Idx2D>::second); it != map_.end()) {
-            return it->first;
+        if (auto const id = map_.find_id(idx_2d); id.has_value()) {
+            return *id;
         }
         throw Idx2DNotFound{idx_2d};
     }
@@ -130,11 +164,11 @@ class Container<RetrievableTypes<GettableTypes...>, StorageableTypes...> {
 
     // get idx by id
     Idx2D get_idx_by_id(ID id) const {
-        auto const found = map_.find(id);
-        if (found == map_.end()) {
+        Idx2D const* const found = map_.find(id);
+        if (found == nullptr) {
             throw IDNotFound{id};
         }
-        return found->second;
+        return *found;
     }
     template <supported_type_c<GettableTypes...> Gettable> Idx2D get_idx_by_id(ID id) const {
         auto const result = get_idx_by_id(id);
@@ -143,6 +177,31 @@ class Container<RetrievableTypes<GettableTypes...>, StorageableTypes...> {
         }
         return result;
     }
+
+    // get idx by a range of ids
+    // the lookups are done in bulk, so that the memory accesses of consecutive ids overlap
+    template <std::ranges::forward_range IDs, std::output_iterator<Idx2D> OutputIterator>
+    void get_idx_by_id(IDs&& ids, OutputIterator destination) const {
+        map_.find_each(std::forward<IDs>(ids), [&destination](ID id, Idx2D const* found) {
+            if (found == nullptr) {
+                throw IDNotFound{id};
+            }
+            *destination++ = *found;
+        });
+    }
+    template <supported_type_c<GettableTypes...> Gettable, std::ranges::forward_range IDs,
+              std::output_iterator<Idx2D> OutputIterator>
+    void get_idx_by_id(IDs&& ids, OutputIterator destination) const {
+        map_.find_each(std::forward<IDs>(ids), [&destination](ID id, Idx2D const* found) {
+            if (found == nullptr) {
+                throw IDNotFound{id};
+            }
+            if (!is_base<Gettable>[found->group]) {
+                throw IDWrongType{id};
+            }
+            *destination++ = *found;
+        });
+    }
     template <supported_type_c<StorageableTypes...> Storageable> constexpr Idx get_group_idx() const {
         return static_cast<Idx>(get_cls_pos_v<Storageable, StorageableTypes...>);
     }
@@ -183,9 +242,9 @@ class Container<RetrievableTypes<GettableTypes...>, StorageableTypes...> {
     // get sequence idx based on id
     template <supported_type_c<GettableTypes...> Gettable> Idx get_seq(ID id) const {
         assert(construction_complete_);
-        auto const found = map_.find(id);
-        assert(found != map_.end());
-        return get_seq<Gettable>(found->second);
+        Idx2D const* const found = map_.find(id);
+        assert(found != nullptr);
+        return get_seq<Gettable>(*found);
     }
 
     // get idx_2d based on sequence
@@ -225,7 +284,8 @@ class Container<RetrievableTypes<GettableTypes...>, StorageableTypes...> {
 
   private:
     std::tuple<std::vector<StorageableTypes>...> vectors_;
-    std::unordered_map<ID, Idx2D> map_;
+    FlatIdIndex map_;
+    std::array<Idx, num_storageable> n_registered_{};
     std::array<Idx, num_gettable> size_{};
     std::array<std::array<Idx, num_storageable + 1>, num_gettable> cum_size_{};
 
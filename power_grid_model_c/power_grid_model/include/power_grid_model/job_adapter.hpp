@@ -7,6 +7,7 @@
 // Adapter that connects the JobDispatch to the MainModelImpl
 
 #include "job_interface.hpp"
+#include "job_worker_pool.hpp"
 #include "main_model_fwd.hpp"
 
 #include "auxiliary/dataset.hpp"
@@ -16,6 +17,7 @@
 #include "main_core/update.hpp"
 
 #include <algorithm>
+#include <concepts>
 #include <functional>
 #include <memory>
 #include <span>
@@ -28,22 +30,29 @@ template <class MainModel> class JobAdapter : public JobInterface {
   public:
     using ModelType = MainModel::ImplType;
 
+    // the copies of the model are taken from the model replicas if they are given
+    //    and given back on destruction if they are still equal to the model
     JobAdapter(std::reference_wrapper<MainModel> model_reference,
-               std::reference_wrapper<MainModelOptions const> options)
-        : model_reference_{model_reference}, options_{options} {}
+               std::reference_wrapper<MainModelOptions const> options,
+               ModelReplicas<MainModel>* model_replicas = nullptr)
+        : model_reference_{model_reference}, options_{options}, model_replicas_{model_replicas} {}
     JobAdapter(JobAdapter const& other)
-        : model_copy_{std::make_unique<MainModel>(other.model_reference_.get())},
+        : model_copy_{other.copy_model()},
           model_reference_{std::ref(*model_copy_)},
           options_{std::ref(other.options_)},
+          model_replicas_{other.model_replicas_},
+          model_modified_{other.model_modified_},
           components_to_update_{other.components_to_update_},
           update_independence_{other.update_independence_},
           independence_flags_{other.independence_flags_},
           all_scenarios_sequence_{other.all_scenarios_sequence_} {}
     JobAdapter& operator=(JobAdapter const& other) {
         if (this != &other) {
-            model_copy_ = std::make_unique<MainModel>(other.model_reference_.get());
+            model_copy_ = other.copy_model();
             model_reference_ = std::ref(*model_copy_);
             options_ = std::ref(other.options_);
+            model_replicas_ = other.model_replicas_;
+            model_modified_ = other.model_modified_;
             components_to_update_ = other.components_to_update_;
             update_independence_ = other.update_independence_;
             independence_flags_ = other.independence_flags_;
@@ -55,6 +64,8 @@ template <class MainModel> class JobAdapter : public JobInterface {
         : model_copy_{std::move(other.model_copy_)},
           model_reference_{model_copy_ ? std::ref(*model_copy_) : std::move(other.model_reference_)},
           options_{other.options_},
+          model_replicas_{other.model_replicas_},
+          model_modified_{other.model_modified_},
           components_to_update_{std::move(other.components_to_update_)},
           update_independence_{std::move(other.update_independence_)},
           independence_flags_{std::move(other.independence_flags_)},
@@ -64,6 +75,8 @@ template <class MainModel> class JobAdapter : public JobInterface {
             model_copy_ = std::move(other.model_copy_);
             model_reference_ = model_copy_ ? std::ref(*model_copy_) : std::move(other.model_reference_);
             options_ = other.options_;
+            model_replicas_ = other.model_replicas_;
+            model_modified_ = other.model_modified_;
             components_to_update_ = std::move(other.components_to_update_);
             update_independence_ = std::move(other.update_independence_);
             independence_flags_ = std::move(other.independence_flags_);
@@ -71,7 +84,12 @@ template <class MainModel> class JobAdapter : public JobInterface {
         }
         return *this;
     }
-    ~JobAdapter() { model_copy_.reset(); }
+    ~JobAdapter() {
+        if (model_copy_ != nullptr && model_replicas_ != nullptr && !model_modified_) {
+            model_replicas_->give_back(std::move(model_copy_));
+        }
+        model_copy_.reset();
+    }
 
   private:
     friend class JobInterface;
@@ -79,6 +97,9 @@ template <class MainModel> class JobAdapter : public JobInterface {
     std::unique_ptr<MainModel> model_copy_;
     std::reference_wrapper<MainModel> model_reference_;
     std::reference_wrapper<MainModelOptions const> options_;
+    ModelReplicas<MainModel>* model_replicas_{};
+    // permanent updates are applied on the model copy, so it cannot be given back as a replica
+    bool model_modified_{false};
 
     ModelType::ComponentFlags components_to_update_{};
     ModelType::UpdateIndependence update_independence_{};
@@ -87,7 +108,8 @@ template <class MainModel> class JobAdapter : public JobInterface {
     // current_scenario_sequence_cache_ is calculated per scenario, so it is excluded from the constructors.
     ModelType::SequenceIdx current_scenario_sequence_cache_{};
 
-    void calculate_impl(MutableDataset const& result_data, Idx scenario_idx, Logger& logger) const {
+    template <std::derived_from<Logger> LoggerType>
+    void calculate_impl(MutableDataset const& result_data, Idx scenario_idx, LoggerType& logger) const {
         MainModel::calculator(options_.get(), model_reference_.get(), result_data.get_individual_scenario(scenario_idx),
                               false, logger);
     }
@@ -133,11 +155,25 @@ template <class MainModel> class JobAdapter : public JobInterface {
                                                                            current_scenario_sequence);
     }
 
+    void apply_update_impl(ConstDataset const& update_data, Idx scenario_idx) {
+        model_modified_ = true;
+        model_reference_.get().template update_components<permanent_update_t>(
+            update_data.get_individual_scenario(scenario_idx));
+    }
+
     void winddown_impl() {
         model_reference_.get().restore_components(get_current_scenario_sequence_view_());
         std::ranges::for_each(current_scenario_sequence_cache_, [](auto& comp_seq_idx) { comp_seq_idx.clear(); });
     }
 
+    // only a copy of the model itself can be taken from the replicas, not a copy of a copy
+    std::unique_ptr<MainModel> copy_model() const {
+        if (model_replicas_ != nullptr && model_copy_ == nullptr) {
+            return model_replicas_->take(model_reference_.get());
+        }
+        return std::make_unique<MainModel>(model_reference_.get());
+    }
+
     auto get_current_scenario_sequence_view_() const {
         return ModelType::run_functor_with_all_component_types_return_array([this]<typename CT>() {
             constexpr auto comp_idx = ModelType::template index_of_component<CT>;
@@ -6,15 +6,18 @@
 
 #include "batch_parameter.hpp"
 #include "job_interface.hpp"
+#include "job_worker_pool.hpp"
 
 #include "common/common.hpp"
 #include "common/counting_iterator.hpp"
+#include "common/enum.hpp"
 #include "common/exception.hpp"
 #include "common/logging.hpp"
 #include "common/timer.hpp"
 #include "common/typing.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <concepts>
 #include <exception>
@@ -30,20 +33,101 @@
 
 namespace power_grid_model {
 
+// the update dataset of a multi-dimensional batch is a linked list of the dimensions of the cartesian product
+template <typename UpdateDataset>
+concept cartesian_product_dataset_c = requires(UpdateDataset const& update_data) {
+    { update_data.get_next_cartesian_product_dimension() } -> std::convertible_to<UpdateDataset const*>;
+};
+
 class JobDispatch {
   public:
+    enum class BatchScheduling : IntS { // assignment of the batch scenarios to the threads
+        dynamic = 0,                    // threads claim chunks of consecutive scenarios until all are handed out
+        static_round_robin = 1,         // thread k of n calculates the scenarios k, k + n, k + 2n, ...
+    };
+
+    // dynamic scheduler for the batch scenarios
+    // threads claim chunks of consecutive scenarios from a shared atomic counter until all scenarios are handed out,
+    //    so that a thread that finishes cheap scenarios early picks up the remaining work instead of idling
+    // consecutive scenarios are kept together in a chunk because they are often similar (e.g., time series), which
+    //    benefits the cached topology and solver state of the per-thread adapter
+    // the static round-robin assignment is kept as a baseline, e.g., for benchmarks
+    class ScenarioQueue {
+      public:
+        static constexpr Idx chunks_per_thread = 8;
+
+        // the scenarios of a single thread, claimed from the shared queue
+        class ThreadScenarios {
+          public:
+            explicit ThreadScenarios(ScenarioQueue& queue)
+                : queue_{&queue},
+                  next_static_{queue.scheduling_ == BatchScheduling::static_round_robin
+                                   ? queue.next_thread_.fetch_add(1, std::memory_order_relaxed)
+                                   : 0} {}
+
+            // an empty range means that all scenarios of this thread are handed out
+            IdxRange next_chunk() {
+                if (queue_->scheduling_ == BatchScheduling::dynamic) {
+                    return queue_->next_chunk();
+                }
+                Idx const begin = std::min(next_static_, queue_->n_scenarios_);
+                next_static_ += queue_->n_thread_;
+                return IdxRange{begin, std::min(begin + 1, queue_->n_scenarios_)};
+            }
+
+          private:
+            ScenarioQueue* queue_;
+            Idx next_static_;
+        };
+
+        ScenarioQueue(Idx n_scenarios, Idx n_thread, BatchScheduling scheduling = BatchScheduling::dynamic)
+            : n_scenarios_{n_scenarios},
+              n_thread_{std::max(Idx{1}, n_thread)},
+              chunk_size_{scheduling == BatchScheduling::dynamic
+                              ? std::max(Idx{1}, n_scenarios / (n_thread_ * chunks_per_thread))
+                              : Idx{1}},
+              scheduling_{scheduling} {
+            assert(n_scenarios >= 0);
+        }
+
+        Idx n_scenarios() const { return n_scenarios_; }
+        Idx chunk_size() const { return chunk_size_; }
+        BatchScheduling scheduling() const { return scheduling_; }
+
+        // claim the next chunk of scenarios; an empty range means that all scenarios are handed out
+        // only for the dynamic scheduling, the static assignment depends on the thread, see thread_scenarios
+        IdxRange next_chunk() {
+            assert(scheduling_ == BatchScheduling::dynamic);
+            Idx const begin = std::min(next_.fetch_add(chunk_size_, std::memory_order_relaxed), n_scenarios_);
+            return IdxRange{begin, std::min(begin + chunk_size_, n_scenarios_)};
+        }
+
+        // to be called once by each of the threads that work on the queue
+        ThreadScenarios thread_scenarios() { return ThreadScenarios{*this}; }
+
+      private:
+        Idx n_scenarios_;
+        Idx n_thread_;
+        Idx chunk_size_;
+        BatchScheduling scheduling_;
+        std::atomic<Idx> next_{0};
+        std::atomic<Idx> next_thread_{0};
+    };
+
     template <typename Adapter, typename ResultDataset, typename UpdateDataset>
         requires std::is_base_of_v<JobInterface, Adapter>
     static BatchParameter batch_calculation(Adapter& adapter, ResultDataset const& result_data,
                                             UpdateDataset const& update_data, Idx threading,
-                                            common::logging::MultiThreadedLogger& log) {
-        if (update_data.empty()) {
+                                            common::logging::MultiThreadedLogger& log,
+                                            JobThreadPool* thread_pool = nullptr,
+                                            BatchScheduling scheduling = BatchScheduling::dynamic) {
+        if (is_empty_batch(update_data)) {
             adapter.calculate(result_data, log);
             return BatchParameter{};
         }
 
-        // get batch size
-        Idx const n_scenarios = update_data.batch_size();
+        // get batch size, of all dimensions together
+        Idx const n_scenarios = total_batch_size(update_data);
 
         // if the batch_size is zero, it is a special case without doing any calculations at all
         // we consider in this case the batch set is independent but not topology cacheable
@@ -54,13 +138,16 @@ class JobDispatch {
         // calculate once to cache, ignore results
         adapter.cache_calculate(log);
 
+        // the scenario indices start again for this batch
+        log.log(LogEvent::begin_batch);
+
         // error messages
         std::vector<std::string> exceptions(n_scenarios, "");
 
-        adapter.prepare_job_dispatch(update_data);
+        adapter.prepare_job_dispatch(*batch_dimensions(update_data).back());
         auto single_job = JobDispatch::single_thread_job(adapter, result_data, update_data, exceptions, log);
 
-        job_dispatch(single_job, n_scenarios, threading);
+        job_dispatch(single_job, n_scenarios, threading, thread_pool, scheduling);
 
         handle_batch_exceptions(exceptions);
 
@@ -84,13 +171,46 @@ class JobDispatch {
         };
     }
 
+    // the dimensions of the batch, from the outermost to the innermost
+    // a one-dimensional batch has only one dimension
+    template <typename UpdateDataset>
+    static std::vector<UpdateDataset const*> batch_dimensions(UpdateDataset const& update_data) {
+        std::vector<UpdateDataset const*> dimensions{&update_data};
+        if constexpr (cartesian_product_dataset_c<UpdateDataset>) {
+            for (UpdateDataset const* next = update_data.get_next_cartesian_product_dimension(); next != nullptr;
+                 next = next->get_next_cartesian_product_dimension()) {
+                dimensions.push_back(next);
+            }
+        }
+        return dimensions;
+    }
+
+    // no dimension of the batch has update data
+    template <typename UpdateDataset> static bool is_empty_batch(UpdateDataset const& update_data) {
+        return std::ranges::all_of(batch_dimensions(update_data),
+                                   [](UpdateDataset const* dimension) { return dimension->empty(); });
+    }
+
+    // the number of scenarios in the cartesian product of all dimensions
+    template <typename UpdateDataset> static Idx total_batch_size(UpdateDataset const& update_data) {
+        Idx result{1};
+        for (UpdateDataset const* dimension : batch_dimensions(update_data)) {
+            result *= dimension->batch_size();
+        }
+        return result;
+    }
+
+    // a multi-dimensional batch is calculated as one job space of all scenarios of the cartesian product
+    //    the scenario index is row-major over the dimensions, i.e., the innermost (last) dimension runs fastest
+    // each thread applies the updates of the outer dimensions permanently on its own model copy,
+    //    and only replaces them when the outer scenario changes, by starting again from a copy of the base model
+    // the update of the innermost dimension is applied and restored for each scenario, as for a one-dimensional batch
     template <typename Adapter, typename ResultDataset, typename UpdateDataset>
     static auto single_thread_job(Adapter& base_adapter, ResultDataset const& result_data,
                                   UpdateDataset const& update_data, std::vector<std::string>& exceptions,
                                   common::logging::MultiThreadedLogger& base_log) {
-        return [&base_adapter, &exceptions, &result_data, &update_data, &base_log](Idx start, Idx stride,
-                                                                                   Idx n_scenarios) {
-            assert(n_scenarios <= narrow_cast<Idx>(exceptions.size()));
+        return [&base_adapter, &exceptions, &result_data, &update_data, &base_log](ScenarioQueue& scenario_queue) {
+            assert(scenario_queue.n_scenarios() <= narrow_cast<Idx>(exceptions.size()));
             auto thread_log_ptr = base_log.create_child();
             Logger& thread_log = *thread_log_ptr;
 
@@ -104,9 +224,45 @@ class JobDispatch {
 
             auto adapter = copy_adapter_functor();
 
-            auto setup = [&adapter, &update_data, &thread_log](Idx scenario_idx) {
+            auto const dimensions = batch_dimensions(update_data);
+            UpdateDataset const& inner_update_data = *dimensions.back();
+            Idx const inner_batch_size = inner_update_data.batch_size();
+
+            // the outer scenario of which the updates are applied on the model copy
+            constexpr Idx no_outer_scenario = -1;      // the model copy is equal to the base model
+            constexpr Idx partial_outer_scenario = -2; // the outer updates failed halfway
+            Idx applied_outer_scenario = no_outer_scenario;
+
+            auto setup_outer = [&adapter, &dimensions, &copy_adapter_functor, &applied_outer_scenario,
+                                &thread_log](Idx outer_scenario_idx) {
+                if (dimensions.size() == 1 || outer_scenario_idx == applied_outer_scenario) {
+                    return;
+                }
+                if (applied_outer_scenario != no_outer_scenario) {
+                    adapter = copy_adapter_functor();
+                }
+                Timer const t_update_model{thread_log, LogEvent::update_model};
+                applied_outer_scenario = partial_outer_scenario;
+
+                // apply from the outermost dimension, so that the inner dimensions take precedence
+                IdxVector dimension_scenario_idx(dimensions.size() - 1);
+                Idx remainder = outer_scenario_idx;
+                for (Idx dimension = std::ssize(dimension_scenario_idx) - 1; dimension >= 0; --dimension) {
+                    Idx const dimension_batch_size = dimensions[dimension]->batch_size();
+                    dimension_scenario_idx[dimension] = remainder % dimension_batch_size;
+                    remainder /= dimension_batch_size;
+                }
+                for (auto const& [dimension, scenario_idx] : enumerate(dimension_scenario_idx)) {
+                    adapter.apply_update(*dimensions[dimension], scenario_idx);
+                }
+                applied_outer_scenario = outer_scenario_idx;
+            };
+
+            auto setup = [&adapter, &inner_update_data, inner_batch_size, &setup_outer,
+                          &thread_log](Idx scenario_idx) {
+                setup_outer(scenario_idx / inner_batch_size);
                 Timer const t_update_model{thread_log, LogEvent::update_model};
-                adapter.setup(update_data, scenario_idx);
+                adapter.setup(inner_update_data, scenario_idx % inner_batch_size);
             };
 
             auto winddown = [&adapter, &thread_log]() {
@@ -114,10 +270,11 @@ class JobDispatch {
                 adapter.winddown();
             };
 
-            auto recover_from_bad = [&adapter, &copy_adapter_functor]() {
+            auto recover_from_bad = [&adapter, &copy_adapter_functor, &applied_outer_scenario]() {
                 // TODO(figueroa1395): Time this step
                 // how do we want to deal with exceptions and timing?
                 adapter = copy_adapter_functor();
+                applied_outer_scenario = no_outer_scenario;
             };
 
             auto run = [&adapter, &result_data, &thread_log](Idx scenario_idx) {
@@ -128,30 +285,48 @@ class JobDispatch {
                                                                   JobDispatch::scenario_exception_handler(exceptions),
                                                                   std::move(recover_from_bad));
 
-            for (Idx scenario_idx = start; scenario_idx < n_scenarios; scenario_idx += stride) {
-                Timer const t_total_single{thread_log, LogEvent::total_single_calculation_in_thread};
-                calculate_scenario(scenario_idx);
+            auto thread_scenarios = scenario_queue.thread_scenarios();
+            for (auto chunk = thread_scenarios.next_chunk(); !chunk.empty(); chunk = thread_scenarios.next_chunk()) {
+                for (Idx const scenario_idx : chunk) {
+                    // the events in between are attributed to the scenario by the loggers that keep a breakdown
+                    thread_log.log(LogEvent::begin_scenario, scenario_idx);
+                    {
+                        Timer const t_total_single{thread_log, LogEvent::total_single_calculation_in_thread};
+                        calculate_scenario(scenario_idx);
+                    }
+                    thread_log.log(LogEvent::end_scenario);
+                }
             }
 
             t_total.stop();
         };
     }
 
+    // the threads are taken from the thread pool if it is given, otherwise they are created for this call
     template <typename RunSingleJobFn>
-        requires std::invocable<std::remove_cvref_t<RunSingleJobFn>, Idx /*start*/, Idx /*stride*/, Idx /*n_scenarios*/>
-    static void job_dispatch(RunSingleJobFn single_thread_job, Idx n_scenarios, Idx threading) {
+        requires std::invocable<std::remove_cvref_t<RunSingleJobFn>, ScenarioQueue&>
+    static void job_dispatch(RunSingleJobFn single_thread_job, Idx n_scenarios, Idx threading,
+                             JobThreadPool* thread_pool = nullptr,
+                             BatchScheduling scheduling = BatchScheduling::dynamic) {
         // run batches sequential or parallel
-        auto const n_thread = n_threads(n_scenarios, threading);
+        auto const n_thread = thread_pool == nullptr
+                                  ? n_threads(n_scenarios, threading)
+                                  : std::min(n_threads(n_scenarios, threading, thread_pool->n_workers()),
+                                             thread_pool->n_workers());
+        ScenarioQueue scenario_queue{n_scenarios, n_thread, scheduling};
         if (n_thread == 1) {
             // run all in sequential
-            single_thread_job(0, 1, n_scenarios);
+            single_thread_job(scenario_queue);
+        } else if (thread_pool != nullptr) {
+            // each worker keeps claiming chunks of scenarios until the queue is exhausted
+            thread_pool->run(n_thread, [&single_thread_job, &scenario_queue] { single_thread_job(scenario_queue); });
         } else {
             // create parallel threads
             std::vector<std::jthread> threads;
             threads.reserve(n_thread);
             for (Idx thread_number = 0; thread_number < n_thread; ++thread_number) {
-                // compute each single thread job with stride
-                threads.emplace_back(single_thread_job, thread_number, n_thread, n_scenarios);
+                // each thread keeps claiming chunks of scenarios until the queue is exhausted
+                threads.emplace_back([&single_thread_job, &scenario_queue] { single_thread_job(scenario_queue); });
             }
             for (auto& thread : threads) {
                 thread.join();
@@ -164,7 +339,11 @@ class JobDispatch {
     //    use hardware threads, but it is either unknown (0) or only has one thread (1)
     //    specified threading = 1
     static Idx n_threads(Idx n_scenarios, Idx threading) {
-        auto const hardware_thread = static_cast<Idx>(std::jthread::hardware_concurrency());
+        return n_threads(n_scenarios, threading, static_cast<Idx>(std::jthread::hardware_concurrency()));
+    }
+
+    // same as above, with the given number of available threads instead of the hardware threads
+    static Idx n_threads(Idx n_scenarios, Idx threading, Idx hardware_thread) {
         if (threading < 0 || threading == 1 || (threading == 0 && hardware_thread < 2)) {
             return 1; // sequential
         }
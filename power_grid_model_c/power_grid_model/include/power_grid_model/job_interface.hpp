@@ -16,8 +16,9 @@ namespace power_grid_model {
 class JobInterface {
   public:
     // the multiple  NOSONARs are used to avoid the complaints about the unnamed concepts
-    template <typename Self, typename ResultDataset>
-    void calculate(this Self& self, ResultDataset const& result_data, Idx pos, Logger& logger)
+    // the type of the logger is kept, so that a single calculation can create child loggers of a multi-threaded logger
+    template <typename Self, typename ResultDataset, std::derived_from<Logger> LoggerType>
+    void calculate(this Self& self, ResultDataset const& result_data, Idx pos, LoggerType& logger)
         requires requires { // NOSONAR
             { self.calculate_impl(result_data, pos, logger) } -> std::same_as<void>;
         }
@@ -25,8 +26,8 @@ class JobInterface {
         return self.calculate_impl(result_data, pos, logger);
     }
 
-    template <typename Self, typename ResultDataset>
-    void calculate(this Self& self, ResultDataset const& result_data, Logger& logger) {
+    template <typename Self, typename ResultDataset, std::derived_from<Logger> LoggerType>
+    void calculate(this Self& self, ResultDataset const& result_data, LoggerType& logger) {
         self.calculate(result_data, Idx{}, logger);
     }
 
@@ -57,6 +58,16 @@ class JobInterface {
         return self.setup_impl(update_data, scenario_idx);
     }
 
+    // permanently apply one scenario of the update data, e.g., of an outer dimension of a cartesian product batch
+    template <typename Self, typename UpdateDataset>
+    void apply_update(this Self& self, UpdateDataset const& update_data, Idx scenario_idx)
+        requires requires { // NOSONAR
+            { self.apply_update_impl(update_data, scenario_idx) } -> std::same_as<void>;
+        }
+    {
+        return self.apply_update_impl(update_data, scenario_idx);
+    }
+
     template <typename Self>
     void winddown(this Self& self)
         requires requires { // NOSONAR
@@ -0,0 +1,136 @@
+// SPDX-FileCopyrightText: Contributors to the Power Grid Model project <powergridmodel@lfenergy.org>
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+// Persistent resources for batch calculations that are kept between calculations on the same model
+//    JobThreadPool: worker threads, instead of starting and joining threads for every batch calculation
+//    ModelReplicas: copies of the base model, instead of copying the model for every thread in every batch calculation
+
+#include "common/common.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stop_token>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace power_grid_model {
+
+class JobThreadPool {
+  public:
+    explicit JobThreadPool(Idx n_workers) {
+        assert(n_workers > 0);
+        workers_.reserve(n_workers);
+        for (Idx worker = 0; worker != n_workers; ++worker) {
+            workers_.emplace_back([this](std::stop_token const& stop_token) { work(stop_token); });
+        }
+    }
+    JobThreadPool(JobThreadPool const&) = delete;
+    JobThreadPool& operator=(JobThreadPool const&) = delete;
+    JobThreadPool(JobThreadPool&&) = delete;
+    JobThreadPool& operator=(JobThreadPool&&) = delete;
+    // the workers are stopped and joined before the synchronization members are destroyed
+    ~JobThreadPool() = default;
+
+    Idx n_workers() const { return std::ssize(workers_); }
+
+    // run the job on n_workers workers at once and wait until all of them are finished
+    // the first exception thrown by the job is rethrown
+    void run(Idx n_workers, std::function<void()> const& job) {
+        std::scoped_lock const run_lock{run_mutex_}; // one job at a time
+        std::unique_lock lock{mutex_};
+        job_ = &job;
+        n_requested_ = std::clamp(n_workers, Idx{0}, this->n_workers());
+        n_started_ = 0;
+        n_running_ = n_requested_;
+        ++generation_;
+        job_available_.notify_all();
+        job_finished_.wait(lock, [this] { return n_running_ == 0; });
+        job_ = nullptr;
+        if (exception_ != nullptr) {
+            std::rethrow_exception(std::exchange(exception_, nullptr));
+        }
+    }
+
+  private:
+    std::mutex run_mutex_;
+    std::mutex mutex_;
+    std::condition_variable_any job_available_;
+    std::condition_variable job_finished_;
+    std::function<void()> const* job_{};
+    Idx generation_{};
+    Idx n_requested_{};
+    Idx n_started_{};
+    Idx n_running_{};
+    std::exception_ptr exception_;
+    // declared last, so that the workers are joined first on destruction
+    std::vector<std::jthread> workers_;
+
+    void work(std::stop_token const& stop_token) {
+        Idx finished_generation{};
+        std::unique_lock lock{mutex_};
+        while (job_available_.wait(lock, stop_token, [this, &finished_generation] {
+            return generation_ != finished_generation && n_started_ < n_requested_;
+        })) {
+            ++n_started_;
+            finished_generation = generation_;
+            auto const& job = *job_;
+            lock.unlock();
+            std::exception_ptr exception;
+            try {
+                job();
+            } catch (...) { // NOSONAR(S2738)
+                exception = std::current_exception();
+            }
+            lock.lock();
+            if (exception_ == nullptr) {
+                exception_ = std::move(exception);
+            }
+            if (--n_running_ == 0) {
+                job_finished_.notify_all();
+            }
+        }
+    }
+};
+
+// a replica is taken for a batch calculation and given back afterwards if it is still equal to the base model
+// the replicas should be cleared when the base model changes
+template <class Model> class ModelReplicas {
+  public:
+    std::unique_ptr<Model> take(Model const& base_model) {
+        {
+            std::scoped_lock const lock{mutex_};
+            if (!replicas_.empty()) {
+                auto replica = std::move(replicas_.back());
+                replicas_.pop_back();
+                return replica;
+            }
+        }
+        return std::make_unique<Model>(base_model);
+    }
+
+    void give_back(std::unique_ptr<Model> replica) {
+        assert(replica != nullptr);
+        std::scoped_lock const lock{mutex_};
+        replicas_.push_back(std::move(replica));
+    }
+
+    void clear() {
+        std::scoped_lock const lock{mutex_};
+        replicas_.clear();
+    }
+
+  private:
+    std::mutex mutex_;
+    std::vector<std::unique_ptr<Model>> replicas_;
+};
+
+} // namespace power_grid_model
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include "component_columns.hpp"
 #include "container_queries.hpp"
 #include "state.hpp"
 #include "y_bus.hpp"
@@ -55,6 +56,20 @@ inline auto calculate_param(auto const& c, auto const&... extra_args)
     return c.template calc_param<typename CalcInputType::sym>(extra_args...);
 }
 
+// fill the calculation parameters of the component with the given sequence number, see prepare_input below
+template <calculation_input_type CalcStructOut, typename CalcParamOut,
+          std::vector<CalcParamOut>(CalcStructOut::* comp_vect), class ComponentIn>
+inline void prepare_input_single(main_model_state_c auto const& state, std::vector<Idx2D> const& components,
+                                 std::vector<CalcStructOut>& calc_input, Idx sequence) {
+    Idx2D const math_idx = components[sequence];
+    if (math_idx.group != isolated_component) {
+        auto const& component = get_component_by_sequence<ComponentIn>(state.components, sequence);
+        CalcStructOut& math_model_input = calc_input[math_idx.group];
+        std::vector<CalcParamOut>& math_model_input_vect = math_model_input.*comp_vect;
+        math_model_input_vect[math_idx.pos] = calculate_param<CalcStructOut>(component);
+    }
+}
+
 /** This is a heavily templated member function because it operates on many different variables of many
  *different types, but the essence is ever the same: filling one member (vector) of the calculation calc_input
  *struct (soa) with the right calculation symmetric or asymmetric calculation parameters, in the same order as
@@ -113,13 +128,8 @@ inline void prepare_input(main_model_state_c auto const& state, std::vector<Idx2
                           std::vector<CalcStructOut>& calc_input, PredicateIn include = include_all) {
     for (Idx i = 0, n = narrow_cast<Idx>(components.size()); i != n; ++i) {
         if (include(i)) {
-            Idx2D const math_idx = components[i];
-            if (math_idx.group != isolated_component) {
-                auto const& component = get_component_by_sequence<ComponentIn>(state.components, i);
-                CalcStructOut& math_model_input = calc_input[math_idx.group];
-                std::vector<CalcParamOut>& math_model_input_vect = math_model_input.*comp_vect;
-                math_model_input_vect[math_idx.pos] = calculate_param<CalcStructOut>(component);
-            }
+            prepare_input_single<CalcStructOut, CalcParamOut, comp_vect, ComponentIn>(state, components, calc_input,
+                                                                                     i);
         }
     }
 }
@@ -144,28 +154,113 @@ inline void prepare_input(main_model_state_c auto const& state, std::vector<Idx2
     }
 }
 
+template <symmetry_tag sym, class InputType, IntSVector(InputType::* component), class Component>
+    requires std::same_as<InputType, PowerFlowInput<sym>> || std::same_as<InputType, StateEstimationInput<sym>>
+inline void prepare_input_status_single(main_model_state_c auto const& state, std::vector<Idx2D> const& objects,
+                                        std::vector<InputType>& input, Idx sequence) {
+    Idx2D const math_idx = objects[sequence];
+    if (math_idx.group == isolated_component) {
+        return;
+    }
+    (input[math_idx.group].*component)[math_idx.pos] =
+        main_core::get_component_by_sequence<Component>(state.components, sequence).status();
+}
+
 template <symmetry_tag sym, class InputType, IntSVector(InputType::* component), class Component>
     requires std::same_as<InputType, PowerFlowInput<sym>> || std::same_as<InputType, StateEstimationInput<sym>>
 inline void prepare_input_status(main_model_state_c auto const& state, std::vector<Idx2D> const& objects,
                                  std::vector<InputType>& input) {
     for (Idx i = 0, n = narrow_cast<Idx>(objects.size()); i != n; ++i) {
-        Idx2D const math_idx = objects[i];
-        if (math_idx.group == isolated_component) {
-            continue;
+        prepare_input_status_single<sym, InputType, component, Component>(state, objects, input, i);
+    }
+}
+
+// copy the calculation parameter with the given sequence number from a column of the component columns
+template <calculation_input_type CalcStructOut, typename CalcParamOut,
+          std::vector<CalcParamOut>(CalcStructOut::* comp_vect)>
+inline void prepare_input_from_column_single(std::vector<Idx2D> const& components,
+                                             std::vector<CalcParamOut> const& column,
+                                             std::vector<CalcStructOut>& calc_input, Idx sequence) {
+    Idx2D const math_idx = components[sequence];
+    if (math_idx.group != isolated_component) {
+        (calc_input[math_idx.group].*comp_vect)[math_idx.pos] = column[sequence];
+    }
+}
+
+// same as prepare_input, but the calculation parameters are copied from a column of the component columns
+template <calculation_input_type CalcStructOut, typename CalcParamOut,
+          std::vector<CalcParamOut>(CalcStructOut::* comp_vect), std::invocable<Idx> PredicateIn = IncludeAll>
+    requires std::convertible_to<std::invoke_result_t<PredicateIn, Idx>, bool>
+inline void prepare_input_from_column(std::vector<Idx2D> const& components, std::vector<CalcParamOut> const& column,
+                                      std::vector<CalcStructOut>& calc_input, PredicateIn include = include_all) {
+    assert(components.size() == column.size());
+    for (Idx i = 0, n = narrow_cast<Idx>(components.size()); i != n; ++i) {
+        if (include(i)) {
+            prepare_input_from_column_single<CalcStructOut, CalcParamOut, comp_vect>(components, column, calc_input,
+                                                                                     i);
         }
-        (input[math_idx.group].*component)[math_idx.pos] =
-            main_core::get_component_by_sequence<Component>(state.components, i).status();
+    }
+}
+
+// the state estimation input vector of a power sensor, depending on the measured terminal type
+template <symmetry_tag sym>
+constexpr auto power_sensor_input_vector(MeasuredTerminalType terminal_type) {
+    using enum MeasuredTerminalType;
+
+    switch (terminal_type) {
+    case source:
+        return &StateEstimationInput<sym>::measured_source_power;
+    case load:
+    case generator:
+        return &StateEstimationInput<sym>::measured_load_gen_power;
+    case shunt:
+        return &StateEstimationInput<sym>::measured_shunt_power;
+    case branch_from:
+    // all branch3 sensors are at from side in the mathematical model
+    case branch3_1:
+    case branch3_2:
+    case branch3_3:
+        return &StateEstimationInput<sym>::measured_branch_from_power;
+    case branch_to:
+        return &StateEstimationInput<sym>::measured_branch_to_power;
+    case node:
+        return &StateEstimationInput<sym>::measured_bus_injection;
+    default:
+        throw MissingCaseForEnumError{"Power sensor input", terminal_type};
+    }
+}
+
+// the state estimation input vector of a current sensor, depending on the measured terminal type
+template <symmetry_tag sym>
+constexpr auto current_sensor_input_vector(MeasuredTerminalType terminal_type) {
+    using enum MeasuredTerminalType;
+
+    switch (terminal_type) {
+    case branch_from:
+    // all branch3 sensors are at from side in the mathematical model
+    case branch3_1:
+    case branch3_2:
+    case branch3_3:
+        return &StateEstimationInput<sym>::measured_branch_from_current;
+    case branch_to:
+        return &StateEstimationInput<sym>::measured_branch_to_current;
+    default:
+        throw MissingCaseForEnumError{"Current sensor input", terminal_type};
     }
 }
 } // namespace detail
 
+// fill the power flow input of all components
+// the existing input buffers are reused if they have the right size
 template <symmetry_tag sym>
-inline std::vector<PowerFlowInput<sym>> prepare_power_flow_input(main_model_state_c auto const& state,
-                                                                 Idx n_math_solvers) {
+inline void prepare_power_flow_input(main_model_state_c auto const& state, Idx n_math_solvers,
+                                     std::vector<PowerFlowInput<sym>>& pf_input) {
     using detail::prepare_input;
-    using detail::prepare_input_status;
+    using detail::prepare_input_from_column;
+
+    auto const& columns = get_columns<sym>(state.columns);
 
-    std::vector<PowerFlowInput<sym>> pf_input(n_math_solvers);
+    pf_input.resize(n_math_solvers);
     for (Idx i = 0; i != n_math_solvers; ++i) {
         pf_input[i].s_injection.resize(state.math_topology[i]->n_load_gen());
         pf_input[i].source.resize(state.math_topology[i]->n_source());
@@ -175,25 +270,74 @@ inline std::vector<PowerFlowInput<sym>> prepare_power_flow_input(main_model_stat
     prepare_input<PowerFlowInput<sym>, DoubleComplex, &PowerFlowInput<sym>::source, Source>(
         state, state.topo_comp_coup->source, pf_input);
 
-    prepare_input<PowerFlowInput<sym>, ComplexValue<sym>, &PowerFlowInput<sym>::s_injection, GenericLoadGen>(
-        state, state.topo_comp_coup->load_gen, pf_input);
+    prepare_input_from_column<PowerFlowInput<sym>, ComplexValue<sym>, &PowerFlowInput<sym>::s_injection>(
+        state.topo_comp_coup->load_gen, columns.load_gen_s_injection, pf_input);
 
     prepare_input<PowerFlowInput<sym>, VoltageRegulatorCalcParam<sym>, &PowerFlowInput<sym>::voltage_regulator,
                   VoltageRegulator>(state, state.topo_comp_coup->voltage_regulator, pf_input);
 
-    prepare_input_status<sym, PowerFlowInput<sym>, &PowerFlowInput<sym>::load_gen_status, GenericLoadGen>(
-        state, state.topo_comp_coup->load_gen, pf_input);
+    prepare_input_from_column<PowerFlowInput<sym>, IntS, &PowerFlowInput<sym>::load_gen_status>(
+        state.topo_comp_coup->load_gen, columns.load_gen_status, pf_input);
+}
 
+template <symmetry_tag sym>
+inline std::vector<PowerFlowInput<sym>> prepare_power_flow_input(main_model_state_c auto const& state,
+                                                                 Idx n_math_solvers) {
+    std::vector<PowerFlowInput<sym>> pf_input;
+    prepare_power_flow_input<sym>(state, n_math_solvers, pf_input);
     return pf_input;
 }
 
+// only recalculate the power flow input of the updated components
+// pf_input should be prepared with the same math topology, before the components were updated
+template <symmetry_tag sym, class ModelType>
+inline void update_power_flow_input(typename ModelType::MainModelState const& state,
+                                    typename ModelType::SequenceIdx const& updated_components,
+                                    std::vector<PowerFlowInput<sym>>& pf_input) {
+    using detail::prepare_input_from_column_single;
+    using detail::prepare_input_single;
+
+    auto const& columns = get_columns<sym>(state.columns);
+
+    ModelType::run_functor_with_all_component_types_return_void([&state, &columns, &updated_components,
+                                                                 &pf_input]<typename CT>() {
+        for (Idx2D const& component_idx :
+             std::get<ModelType::template index_of_component<CT>>(updated_components)) {
+            if constexpr (std::derived_from<CT, Source>) {
+                Idx const sequence = get_component_sequence_idx<Source>(state.components, component_idx);
+                prepare_input_single<PowerFlowInput<sym>, DoubleComplex, &PowerFlowInput<sym>::source, Source>(
+                    state, state.topo_comp_coup->source, pf_input, sequence);
+            } else if constexpr (std::derived_from<CT, GenericLoadGen>) {
+                Idx const sequence = get_component_sequence_idx<GenericLoadGen>(state.components, component_idx);
+                prepare_input_from_column_single<PowerFlowInput<sym>, ComplexValue<sym>,
+                                                 &PowerFlowInput<sym>::s_injection>(
+                    state.topo_comp_coup->load_gen, columns.load_gen_s_injection, pf_input, sequence);
+                prepare_input_from_column_single<PowerFlowInput<sym>, IntS, &PowerFlowInput<sym>::load_gen_status>(
+                    state.topo_comp_coup->load_gen, columns.load_gen_status, pf_input, sequence);
+            } else if constexpr (std::derived_from<CT, VoltageRegulator>) {
+                Idx const sequence = get_component_sequence_idx<VoltageRegulator>(state.components, component_idx);
+                prepare_input_single<PowerFlowInput<sym>, VoltageRegulatorCalcParam<sym>,
+                                     &PowerFlowInput<sym>::voltage_regulator, VoltageRegulator>(
+                    state, state.topo_comp_coup->voltage_regulator, pf_input, sequence);
+            }
+        }
+    });
+}
+
+// fill the state estimation input of all components
+// the existing input buffers are reused if they have the right size
 template <symmetry_tag sym>
-inline std::vector<StateEstimationInput<sym>> prepare_state_estimation_input(main_model_state_c auto const& state,
-                                                                             Idx n_math_solvers) {
-    using detail::prepare_input;
+inline void prepare_state_estimation_input(main_model_state_c auto const& state, Idx n_math_solvers,
+                                           std::vector<StateEstimationInput<sym>>& se_input) {
+    using detail::prepare_input_from_column;
     using detail::prepare_input_status;
+    using Input = StateEstimationInput<sym>;
 
-    std::vector<StateEstimationInput<sym>> se_input(n_math_solvers);
+    auto const& columns = get_columns<sym>(state.columns);
+    auto const power_sensor_at = [&state](Idx i) { return state.comp_topo->power_sensor_terminal_type[i]; };
+    auto const current_sensor_at = [&state](Idx i) { return state.comp_topo->current_sensor_terminal_type[i]; };
+
+    se_input.resize(n_math_solvers);
 
     for (Idx i = 0; i != n_math_solvers; ++i) {
         se_input[i].shunt_status.resize(state.math_topology[i]->n_shunt());
@@ -210,67 +354,115 @@ inline std::vector<StateEstimationInput<sym>> prepare_state_estimation_input(mai
         se_input[i].measured_branch_to_current.resize(state.math_topology[i]->n_branch_to_current_sensor());
     }
 
-    prepare_input_status<sym, StateEstimationInput<sym>, &StateEstimationInput<sym>::shunt_status, Shunt>(
-        state, state.topo_comp_coup->shunt, se_input);
-    prepare_input_status<sym, StateEstimationInput<sym>, &StateEstimationInput<sym>::load_gen_status, GenericLoadGen>(
-        state, state.topo_comp_coup->load_gen, se_input);
-    prepare_input_status<sym, StateEstimationInput<sym>, &StateEstimationInput<sym>::source_status, Source>(
-        state, state.topo_comp_coup->source, se_input);
-
-    prepare_input<StateEstimationInput<sym>, VoltageSensorCalcParam<sym>, &StateEstimationInput<sym>::measured_voltage,
-                  GenericVoltageSensor>(state, state.topo_comp_coup->voltage_sensor, se_input);
-    prepare_input<StateEstimationInput<sym>, PowerSensorCalcParam<sym>,
-                  &StateEstimationInput<sym>::measured_source_power, GenericPowerSensor>(
-        state, state.topo_comp_coup->power_sensor, se_input,
-        [&state](Idx i) { return state.comp_topo->power_sensor_terminal_type[i] == MeasuredTerminalType::source; });
-    prepare_input<StateEstimationInput<sym>, PowerSensorCalcParam<sym>,
-                  &StateEstimationInput<sym>::measured_load_gen_power, GenericPowerSensor>(
-        state, state.topo_comp_coup->power_sensor, se_input, [&state](Idx i) {
-            return state.comp_topo->power_sensor_terminal_type[i] == MeasuredTerminalType::load ||
-                   state.comp_topo->power_sensor_terminal_type[i] == MeasuredTerminalType::generator;
+    prepare_input_status<sym, Input, &Input::shunt_status, Shunt>(state, state.topo_comp_coup->shunt, se_input);
+    prepare_input_from_column<Input, IntS, &Input::load_gen_status>(state.topo_comp_coup->load_gen,
+                                                                   columns.load_gen_status, se_input);
+    prepare_input_status<sym, Input, &Input::source_status, Source>(state, state.topo_comp_coup->source, se_input);
+
+    prepare_input_from_column<Input, VoltageSensorCalcParam<sym>, &Input::measured_voltage>(
+        state.topo_comp_coup->voltage_sensor, columns.voltage_sensor_param, se_input);
+    prepare_input_from_column<Input, PowerSensorCalcParam<sym>, &Input::measured_source_power>(
+        state.topo_comp_coup->power_sensor, columns.power_sensor_param, se_input,
+        [&power_sensor_at](Idx i) { return power_sensor_at(i) == MeasuredTerminalType::source; });
+    prepare_input_from_column<Input, PowerSensorCalcParam<sym>, &Input::measured_load_gen_power>(
+        state.topo_comp_coup->power_sensor, columns.power_sensor_param, se_input, [&power_sensor_at](Idx i) {
+            return power_sensor_at(i) == MeasuredTerminalType::load ||
+                   power_sensor_at(i) == MeasuredTerminalType::generator;
         });
-    prepare_input<StateEstimationInput<sym>, PowerSensorCalcParam<sym>,
-                  &StateEstimationInput<sym>::measured_shunt_power, GenericPowerSensor>(
-        state, state.topo_comp_coup->power_sensor, se_input,
-        [&state](Idx i) { return state.comp_topo->power_sensor_terminal_type[i] == MeasuredTerminalType::shunt; });
-    prepare_input<StateEstimationInput<sym>, PowerSensorCalcParam<sym>,
-                  &StateEstimationInput<sym>::measured_branch_from_power, GenericPowerSensor>(
-        state, state.topo_comp_coup->power_sensor, se_input, [&state](Idx i) {
+    prepare_input_from_column<Input, PowerSensorCalcParam<sym>, &Input::measured_shunt_power>(
+        state.topo_comp_coup->power_sensor, columns.power_sensor_param, se_input,
+        [&power_sensor_at](Idx i) { return power_sensor_at(i) == MeasuredTerminalType::shunt; });
+    prepare_input_from_column<Input, PowerSensorCalcParam<sym>, &Input::measured_branch_from_power>(
+        state.topo_comp_coup->power_sensor, columns.power_sensor_param, se_input, [&power_sensor_at](Idx i) {
             using enum MeasuredTerminalType;
-            return state.comp_topo->power_sensor_terminal_type[i] == branch_from ||
+            return power_sensor_at(i) == branch_from ||
                    // all branch3 sensors are at from side in the mathematical model
-                   state.comp_topo->power_sensor_terminal_type[i] == branch3_1 ||
-                   state.comp_topo->power_sensor_terminal_type[i] == branch3_2 ||
-                   state.comp_topo->power_sensor_terminal_type[i] == branch3_3;
+                   power_sensor_at(i) == branch3_1 || power_sensor_at(i) == branch3_2 ||
+                   power_sensor_at(i) == branch3_3;
         });
-    prepare_input<StateEstimationInput<sym>, PowerSensorCalcParam<sym>,
-                  &StateEstimationInput<sym>::measured_branch_to_power, GenericPowerSensor>(
-        state, state.topo_comp_coup->power_sensor, se_input,
-        [&state](Idx i) { return state.comp_topo->power_sensor_terminal_type[i] == MeasuredTerminalType::branch_to; });
-    prepare_input<StateEstimationInput<sym>, PowerSensorCalcParam<sym>,
-                  &StateEstimationInput<sym>::measured_bus_injection, GenericPowerSensor>(
-        state, state.topo_comp_coup->power_sensor, se_input,
-        [&state](Idx i) { return state.comp_topo->power_sensor_terminal_type[i] == MeasuredTerminalType::node; });
-
-    prepare_input<StateEstimationInput<sym>, CurrentSensorCalcParam<sym>,
-                  &StateEstimationInput<sym>::measured_branch_from_current, GenericCurrentSensor>(
-        state, state.topo_comp_coup->current_sensor, se_input, [&state](Idx i) {
+    prepare_input_from_column<Input, PowerSensorCalcParam<sym>, &Input::measured_branch_to_power>(
+        state.topo_comp_coup->power_sensor, columns.power_sensor_param, se_input,
+        [&power_sensor_at](Idx i) { return power_sensor_at(i) == MeasuredTerminalType::branch_to; });
+    prepare_input_from_column<Input, PowerSensorCalcParam<sym>, &Input::measured_bus_injection>(
+        state.topo_comp_coup->power_sensor, columns.power_sensor_param, se_input,
+        [&power_sensor_at](Idx i) { return power_sensor_at(i) == MeasuredTerminalType::node; });
+
+    prepare_input_from_column<Input, CurrentSensorCalcParam<sym>, &Input::measured_branch_from_current>(
+        state.topo_comp_coup->current_sensor, columns.current_sensor_param, se_input, [&current_sensor_at](Idx i) {
             using enum MeasuredTerminalType;
-            return state.comp_topo->current_sensor_terminal_type[i] == branch_from ||
+            return current_sensor_at(i) == branch_from ||
                    // all branch3 sensors are at from side in the mathematical model
-                   state.comp_topo->current_sensor_terminal_type[i] == branch3_1 ||
-                   state.comp_topo->current_sensor_terminal_type[i] == branch3_2 ||
-                   state.comp_topo->current_sensor_terminal_type[i] == branch3_3;
-        });
-    prepare_input<StateEstimationInput<sym>, CurrentSensorCalcParam<sym>,
-                  &StateEstimationInput<sym>::measured_branch_to_current, GenericCurrentSensor>(
-        state, state.topo_comp_coup->current_sensor, se_input, [&state](Idx i) {
-            return state.comp_topo->current_sensor_terminal_type[i] == MeasuredTerminalType::branch_to;
+                   current_sensor_at(i) == branch3_1 || current_sensor_at(i) == branch3_2 ||
+                   current_sensor_at(i) == branch3_3;
         });
+    prepare_input_from_column<Input, CurrentSensorCalcParam<sym>, &Input::measured_branch_to_current>(
+        state.topo_comp_coup->current_sensor, columns.current_sensor_param, se_input,
+        [&current_sensor_at](Idx i) { return current_sensor_at(i) == MeasuredTerminalType::branch_to; });
+}
 
+template <symmetry_tag sym>
+inline std::vector<StateEstimationInput<sym>> prepare_state_estimation_input(main_model_state_c auto const& state,
+                                                                             Idx n_math_solvers) {
+    std::vector<StateEstimationInput<sym>> se_input;
+    prepare_state_estimation_input<sym>(state, n_math_solvers, se_input);
     return se_input;
 }
 
+// only recalculate the state estimation input of the updated components
+// se_input should be prepared with the same math topology, before the components were updated
+template <symmetry_tag sym, class ModelType>
+inline void update_state_estimation_input(typename ModelType::MainModelState const& state,
+                                          typename ModelType::SequenceIdx const& updated_components,
+                                          std::vector<StateEstimationInput<sym>>& se_input) {
+    using detail::prepare_input_from_column_single;
+    using detail::prepare_input_status_single;
+    using Input = StateEstimationInput<sym>;
+
+    auto const& columns = get_columns<sym>(state.columns);
+
+    ModelType::run_functor_with_all_component_types_return_void([&state, &columns, &updated_components,
+                                                                 &se_input]<typename CT>() {
+        for (Idx2D const& component_idx :
+             std::get<ModelType::template index_of_component<CT>>(updated_components)) {
+            if constexpr (std::derived_from<CT, Shunt>) {
+                Idx const sequence = get_component_sequence_idx<Shunt>(state.components, component_idx);
+                prepare_input_status_single<sym, Input, &Input::shunt_status, Shunt>(
+                    state, state.topo_comp_coup->shunt, se_input, sequence);
+            } else if constexpr (std::derived_from<CT, GenericLoadGen>) {
+                Idx const sequence = get_component_sequence_idx<GenericLoadGen>(state.components, component_idx);
+                prepare_input_from_column_single<Input, IntS, &Input::load_gen_status>(
+                    state.topo_comp_coup->load_gen, columns.load_gen_status, se_input, sequence);
+            } else if constexpr (std::derived_from<CT, Source>) {
+                Idx const sequence = get_component_sequence_idx<Source>(state.components, component_idx);
+                prepare_input_status_single<sym, Input, &Input::source_status, Source>(
+                    state, state.topo_comp_coup->source, se_input, sequence);
+            } else if constexpr (std::derived_from<CT, GenericVoltageSensor>) {
+                Idx const sequence =
+                    get_component_sequence_idx<GenericVoltageSensor>(state.components, component_idx);
+                prepare_input_from_column_single<Input, VoltageSensorCalcParam<sym>, &Input::measured_voltage>(
+                    state.topo_comp_coup->voltage_sensor, columns.voltage_sensor_param, se_input, sequence);
+            } else if constexpr (std::derived_from<CT, GenericPowerSensor>) {
+                Idx const sequence = get_component_sequence_idx<GenericPowerSensor>(state.components, component_idx);
+                Idx2D const math_idx = state.topo_comp_coup->power_sensor[sequence];
+                if (math_idx.group != isolated_component) {
+                    auto const input_vector =
+                        detail::power_sensor_input_vector<sym>(state.comp_topo->power_sensor_terminal_type[sequence]);
+                    (se_input[math_idx.group].*input_vector)[math_idx.pos] = columns.power_sensor_param[sequence];
+                }
+            } else if constexpr (std::derived_from<CT, GenericCurrentSensor>) {
+                Idx const sequence =
+                    get_component_sequence_idx<GenericCurrentSensor>(state.components, component_idx);
+                Idx2D const math_idx = state.topo_comp_coup->current_sensor[sequence];
+                if (math_idx.group != isolated_component) {
+                    auto const input_vector = detail::current_sensor_input_vector<sym>(
+                        state.comp_topo->current_sensor_terminal_type[sequence]);
+                    (se_input[math_idx.group].*input_vector)[math_idx.pos] = columns.current_sensor_param[sequence];
+                }
+            }
+        }
+    });
+}
+
 template <symmetry_tag sym>
 inline std::vector<ShortCircuitInput>
 prepare_short_circuit_input(main_model_state_c auto const& state, ComponentToMathCoupling& comp_coup,
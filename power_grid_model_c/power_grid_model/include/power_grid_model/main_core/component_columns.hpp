@@ -0,0 +1,170 @@
+// SPDX-FileCopyrightText: Contributors to the Power Grid Model project <powergridmodel@lfenergy.org>
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+// Structure-of-arrays copy of the calculation parameters that are gathered for every calculation.
+// Each column is in the sequence order of a base component type, e.g., all GenericLoadGen.
+// The parameters of the polymorphic components are calculated once when the columns are filled,
+//    and afterwards only for the updated components.
+// The preparation of the calculation input and of the Y bus parameters copies from these contiguous columns,
+//    instead of calling the virtual functions of each component for every calculation.
+
+#include "container_queries.hpp"
+
+#include "../calculation_parameters.hpp"
+#include "../common/common.hpp"
+#include "../common/three_phase_tensor.hpp"
+#include "../component/branch.hpp"
+#include "../component/branch3.hpp"
+#include "../component/current_sensor.hpp"
+#include "../component/load_gen.hpp"
+#include "../component/power_sensor.hpp"
+#include "../component/voltage_sensor.hpp"
+
+#include <array>
+#include <cassert>
+#include <concepts>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace power_grid_model::main_core {
+
+template <symmetry_tag sym_type> struct CalcParamColumns {
+    using sym = sym_type;
+
+    IntSVector load_gen_status;
+    std::vector<ComplexValue<sym>> load_gen_s_injection;
+    std::vector<BranchCalcParam<sym>> branch_param;
+    std::vector<std::array<BranchCalcParam<sym>, 3>> branch3_param;
+    std::vector<VoltageSensorCalcParam<sym>> voltage_sensor_param;
+    std::vector<PowerSensorCalcParam<sym>> power_sensor_param;
+    std::vector<CurrentSensorCalcParam<sym>> current_sensor_param;
+};
+
+// the columns of a symmetry are only filled when a calculation of that symmetry is prepared
+struct ComponentColumns {
+    std::optional<CalcParamColumns<symmetric_t>> sym;
+    std::optional<CalcParamColumns<asymmetric_t>> asym;
+};
+
+template <symmetry_tag sym> inline CalcParamColumns<sym> const& get_columns(ComponentColumns const& columns) {
+    if constexpr (is_symmetric_v<sym>) {
+        assert(columns.sym.has_value());
+        return *columns.sym;
+    } else {
+        assert(columns.asym.has_value());
+        return *columns.asym;
+    }
+}
+
+namespace detail {
+template <symmetry_tag sym> struct ColumnParams {
+    static IntS load_gen_status(GenericLoadGen const& load_gen) { return static_cast<IntS>(load_gen.status()); }
+    static ComplexValue<sym> load_gen_s_injection(GenericLoadGen const& load_gen) {
+        return load_gen.template calc_param<sym>();
+    }
+    static BranchCalcParam<sym> branch_param(Branch const& branch) { return branch.template calc_param<sym>(); }
+    static std::array<BranchCalcParam<sym>, 3> branch3_param(Branch3 const& branch3) {
+        return branch3.template calc_param<sym>();
+    }
+    static VoltageSensorCalcParam<sym> voltage_sensor_param(GenericVoltageSensor const& sensor) {
+        return sensor.template calc_param<sym>();
+    }
+    static PowerSensorCalcParam<sym> power_sensor_param(GenericPowerSensor const& sensor) {
+        return sensor.template calc_param<sym>();
+    }
+    static CurrentSensorCalcParam<sym> current_sensor_param(GenericCurrentSensor const& sensor) {
+        return sensor.template calc_param<sym>();
+    }
+};
+
+template <typename Component, typename ComponentContainer, typename T>
+inline void fill_column(ComponentContainer const& components, std::vector<T>& column,
+                        T (*param)(Component const&)) {
+    column.clear();
+    column.reserve(components.template size<Component>());
+    for (Component const& component : components.template citer<Component>()) {
+        column.push_back(param(component));
+    }
+}
+
+template <typename Component, typename ComponentContainer, typename T>
+inline void update_column(ComponentContainer const& components, std::span<Idx2D const> sequence_idx,
+                          std::vector<T>& column, T (*param)(Component const&)) {
+    for (Idx2D const& idx_2d : sequence_idx) {
+        Idx const sequence = get_component_sequence_idx<Component>(components, idx_2d);
+        column[sequence] = param(components.template get_item_by_seq<Component>(sequence));
+    }
+}
+
+// the column operation for each of the columns that store parameters of the component type
+template <typename CompType, symmetry_tag sym> inline void for_each_column(CalcParamColumns<sym>& columns, auto func) {
+    using Params = ColumnParams<sym>;
+
+    if constexpr (std::derived_from<CompType, GenericLoadGen>) {
+        func(columns.load_gen_status, &Params::load_gen_status);
+        func(columns.load_gen_s_injection, &Params::load_gen_s_injection);
+    } else if constexpr (std::derived_from<CompType, Branch>) {
+        func(columns.branch_param, &Params::branch_param);
+    } else if constexpr (std::derived_from<CompType, Branch3>) {
+        func(columns.branch3_param, &Params::branch3_param);
+    } else if constexpr (std::derived_from<CompType, GenericVoltageSensor>) {
+        func(columns.voltage_sensor_param, &Params::voltage_sensor_param);
+    } else if constexpr (std::derived_from<CompType, GenericPowerSensor>) {
+        func(columns.power_sensor_param, &Params::power_sensor_param);
+    } else if constexpr (std::derived_from<CompType, GenericCurrentSensor>) {
+        func(columns.current_sensor_param, &Params::current_sensor_param);
+    }
+}
+} // namespace detail
+
+// fill the columns of the symmetry, if they are not filled yet
+template <symmetry_tag sym, typename ComponentContainer>
+inline void prepare_component_columns(ComponentContainer const& components, ComponentColumns& columns) {
+    auto& sym_columns = [&columns]() -> auto& {
+        if constexpr (is_symmetric_v<sym>) {
+            return columns.sym;
+        } else {
+            return columns.asym;
+        }
+    }();
+    if (sym_columns.has_value()) {
+        return;
+    }
+    CalcParamColumns<sym> result;
+    auto const fill = [&components](auto& column, auto param) { detail::fill_column(components, column, param); };
+    detail::for_each_column<GenericLoadGen>(result, fill);
+    detail::for_each_column<Branch>(result, fill);
+    detail::for_each_column<Branch3>(result, fill);
+    detail::for_each_column<GenericVoltageSensor>(result, fill);
+    detail::for_each_column<GenericPowerSensor>(result, fill);
+    detail::for_each_column<GenericCurrentSensor>(result, fill);
+    sym_columns = std::move(result);
+}
+
+// recalculate the columns of the updated components of one type, for the filled symmetries
+template <typename CompType, typename ComponentContainer>
+inline void update_component_columns(ComponentContainer const& components, std::span<Idx2D const> sequence_idx,
+                                     ComponentColumns& columns) {
+    auto const update = [&components, sequence_idx](auto& column, auto param) {
+        detail::update_column(components, sequence_idx, column, param);
+    };
+    if (columns.sym.has_value()) {
+        detail::for_each_column<CompType>(*columns.sym, update);
+    }
+    if (columns.asym.has_value()) {
+        detail::for_each_column<CompType>(*columns.asym, update);
+    }
+}
+
+// the columns are out of sync, e.g., after a failed update, they are filled again on the next calculation
+inline void clear(ComponentColumns& columns) {
+    columns.sym.reset();
+    columns.asym.reset();
+}
+
+} // namespace power_grid_model::main_core
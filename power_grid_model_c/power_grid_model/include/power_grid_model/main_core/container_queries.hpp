@@ -10,7 +10,10 @@
 #include "../component/component.hpp"
 
 #include <concepts>
+#include <iterator>
+#include <ranges>
 #include <type_traits>
+#include <utility>
 
 namespace power_grid_model::main_core {
 
@@ -42,6 +45,19 @@ inline Idx2D get_component_idx_by_id(ComponentContainer const& components, ID id
     return components.template get_idx_by_id<ComponentType>(id);
 }
 
+// bulk versions of get_component_idx_by_id, for a range of ids
+template <class ComponentContainer, std::ranges::forward_range IDs, std::output_iterator<Idx2D> OutputIterator>
+inline void get_component_idx_by_id(ComponentContainer const& components, IDs&& ids, OutputIterator destination) {
+    components.get_idx_by_id(std::forward<IDs>(ids), destination);
+}
+
+template <typename ComponentType, class ComponentContainer, std::ranges::forward_range IDs,
+          std::output_iterator<Idx2D> OutputIterator>
+    requires common::component_container_c<ComponentContainer, ComponentType>
+inline void get_component_idx_by_id(ComponentContainer const& components, IDs&& ids, OutputIterator destination) {
+    components.template get_idx_by_id<ComponentType>(std::forward<IDs>(ids), destination);
+}
+
 template <typename ComponentType, class ComponentContainer>
     requires common::storagable_component_container_c<ComponentContainer, ComponentType>
 constexpr Idx get_component_group_idx(ComponentContainer const& components) {
@@ -86,6 +102,18 @@ constexpr auto emplace_component(ComponentContainer& components, ID id, Args&&..
     return components.template emplace<ComponentType>(id, std::forward<Args>(args)...);
 }
 
+template <typename ComponentType, class ComponentContainer, std::ranges::sized_range IDs>
+    requires common::storagable_component_container_c<ComponentContainer, ComponentType>
+inline void register_component_ids(ComponentContainer& components, IDs&& ids) {
+    components.template register_ids<ComponentType>(std::forward<IDs>(ids));
+}
+
+template <typename ComponentType, class ComponentContainer, typename... Args>
+    requires common::storagable_component_container_c<ComponentContainer, ComponentType>
+constexpr void emplace_registered_component(ComponentContainer& components, ID id, Args&&... args) {
+    components.template emplace_registered<ComponentType>(id, std::forward<Args>(args)...);
+}
+
 template <typename ComponentType, class ComponentContainer, typename... Args>
     requires common::storagable_component_container_c<ComponentContainer, ComponentType>
 constexpr void reserve_component(ComponentContainer& components, std::integral auto size) {
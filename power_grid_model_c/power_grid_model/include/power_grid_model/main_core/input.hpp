@@ -21,6 +21,7 @@
 #include "../component/load_gen.hpp"
 #include "../component/node.hpp"
 #include "../component/power_sensor.hpp"
+#include "../component/regulator.hpp"
 #include "../component/shunt.hpp"
 #include "../component/source.hpp"
 #include "../component/three_winding_transformer.hpp"
@@ -30,12 +31,20 @@
 #include "../component/voltage_sensor.hpp"
 #include "../container_fwd.hpp"
 
+#include <algorithm>
 #include <array>
+#include <cassert>
 #include <concepts>
+#include <exception>
 #include <format>
+#include <iterator>
 #include <ranges>
+#include <span>
+#include <thread>
+#include <tuple>
 #include <type_traits>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 namespace power_grid_model::main_core {
@@ -43,17 +52,182 @@ namespace power_grid_model::main_core {
 constexpr std::array<Branch3Side, 3> const branch3_sides = {Branch3Side::side_1, Branch3Side::side_2,
                                                             Branch3Side::side_3};
 
+// the ids of the components are either inserted into the index one by one while the components are constructed,
+// or registered in advance by register_input_ids, so that the index is read-only during the construction
+enum class IdRegistration : bool { during_construction = false, in_advance = true };
+
+// the components are constructed in stages, the components of a stage only refer to components of earlier stages
+// so the component types of one stage can be constructed concurrently if the ids are registered in advance
+// the stages are contiguous in the list of all component types,
+//     so the first error in the order of the component types is the same as in a sequential construction
+template <std::derived_from<Base> Component>
+constexpr Idx construction_stage_v =
+    std::derived_from<Component, Node>
+        ? 0
+        : ((std::derived_from<Component, GenericCurrentSensor> || std::derived_from<Component, Fault> ||
+            std::derived_from<Component, Regulator>)
+               ? 2
+               : 1);
+constexpr Idx n_construction_stages = 3;
+
+namespace detail {
+template <std::derived_from<Base> Component, non_owning_view_c Inputs>
+using component_input_view_t =
+    std::conditional_t<std::same_as<std::ranges::range_reference_t<Inputs>, typename Component::InputType const&>,
+                       typename Component::InputType const&, typename Component::InputType>;
+
+// the ids of the nodes that a component refers to, in the order in which they are looked up
+template <std::derived_from<Base> Component>
+constexpr auto node_references(typename Component::InputType const& input) {
+    if constexpr (std::derived_from<Component, Branch>) {
+        return std::array{input.from_node, input.to_node};
+    } else if constexpr (std::derived_from<Component, Branch3>) {
+        return std::array{input.node_1, input.node_2, input.node_3};
+    } else if constexpr (std::derived_from<Component, Appliance>) {
+        return std::array{input.node};
+    } else if constexpr (std::derived_from<Component, GenericVoltageSensor>) {
+        return std::array{input.measured_object};
+    } else if constexpr (std::derived_from<Component, Fault>) {
+        return std::array{input.fault_object};
+    } else {
+        return std::array<ID, 0>{};
+    }
+}
+
+// in a construction one by one in the order of the component types, only the components of the earlier types and
+//     the earlier components of the same type are constructed when the next component is constructed
+constexpr bool is_constructed_before(Idx2D idx, Idx2D next_component) {
+    return idx.group < next_component.group || (idx.group == next_component.group && idx.pos < next_component.pos);
+}
+
+// the index of a component that is referenced by the next component to construct
+// if the ids are registered in advance, the index also contains the components that are not constructed yet
+//     their ids are not found, the same as in a construction one by one, and their type is not checked
+template <typename Gettable, IdRegistration id_registration, class ComponentContainer>
+inline Idx2D get_referenced_component_idx(ComponentContainer const& components, ID id, Idx2D next_component) {
+    if constexpr (id_registration == IdRegistration::in_advance) {
+        if (!is_constructed_before(get_component_idx_by_id(components, id), next_component)) {
+            throw IDNotFound{id};
+        }
+    }
+    if constexpr (std::same_as<Gettable, void>) {
+        return get_component_idx_by_id(components, id);
+    } else {
+        return get_component_idx_by_id<Gettable>(components, id);
+    }
+}
+} // namespace detail
+
+// resolve the node references of all components in bulk, so that the memory accesses of consecutive lookups overlap
+// the references are split into consecutive chunks that are resolved concurrently if n_thread > 1
+// the types of the referenced components are checked by add_component, in the order of the components
+// the first failed lookup is the same as in the lookups one by one
+template <std::derived_from<Base> Component, class ComponentContainer, non_owning_view_c Inputs>
+inline std::vector<Idx2D> resolve_node_references(ComponentContainer const& components, Inputs component_inputs,
+                                                  Idx n_thread = 1) {
+    using ComponentView = detail::component_input_view_t<Component, Inputs>;
+    constexpr size_t n_references = std::tuple_size_v<decltype(detail::node_references<Component>(
+        std::declval<typename Component::InputType const&>()))>;
+
+    std::vector<Idx2D> result;
+    if constexpr (n_references > 0) {
+        std::vector<ID> node_ids;
+        node_ids.reserve(n_references * std::ranges::size(component_inputs));
+        for (auto const& input_proxy : component_inputs) {
+            ComponentView const input = [&input_proxy]() -> ComponentView { return input_proxy; }();
+            std::ranges::copy(detail::node_references<Component>(input), std::back_inserter(node_ids));
+        }
+        result.resize(node_ids.size());
+
+        Idx const n_ids = std::ssize(node_ids);
+        Idx const n_chunks = std::clamp(n_thread, Idx{1}, n_ids);
+        if (n_chunks <= 1) {
+            get_component_idx_by_id(components, node_ids, result.begin());
+            return result;
+        }
+        std::vector<std::exception_ptr> chunk_exceptions(n_chunks);
+        {
+            std::vector<std::jthread> threads;
+            threads.reserve(n_chunks);
+            for (Idx chunk = 0; chunk != n_chunks; ++chunk) {
+                threads.emplace_back([&components, &node_ids, &result, &chunk_exceptions, chunk, n_chunks, n_ids] {
+                    Idx const begin = n_ids * chunk / n_chunks;
+                    Idx const end = n_ids * (chunk + 1) / n_chunks;
+                    try {
+                        get_component_idx_by_id(components, std::span{node_ids}.subspan(begin, end - begin),
+                                                result.begin() + begin);
+                    } catch (...) { // NOSONAR(S2738)
+                        chunk_exceptions[chunk] = std::current_exception();
+                    }
+                });
+            }
+        } // join all threads
+        if (auto const failed = std::ranges::find_if(chunk_exceptions, [](auto const& ex) { return ex != nullptr; });
+            failed != chunk_exceptions.end()) {
+            std::rethrow_exception(*failed);
+        }
+    }
+    return result;
+}
+
+// register the ids of the components in advance, to construct them with IdRegistration::in_advance afterwards
+template <std::derived_from<Base> Component, class ComponentContainer, non_owning_view_c Inputs>
+    requires common::component_container_c<ComponentContainer, Component>
+inline void register_input_ids(ComponentContainer& components, Inputs component_inputs) {
+    using ComponentView = detail::component_input_view_t<Component, Inputs>;
+
+    register_component_ids<Component>(components,
+                                      component_inputs | std::views::transform([](auto const& input_proxy) -> ID {
+                                          ComponentView const input = input_proxy;
+                                          return input.id;
+                                      }));
+}
+
 // template to construct components
 // using forward interators
 // different selection based on component type
-template <std::derived_from<Base> Component, class ComponentContainer, non_owning_view_c Inputs>
+// if the ids are registered in advance, the node references may be resolved in advance by resolve_node_references
+template <std::derived_from<Base> Component, IdRegistration id_registration = IdRegistration::during_construction,
+          class ComponentContainer, non_owning_view_c Inputs>
     requires common::component_container_c<ComponentContainer, Component>
-inline void add_component(ComponentContainer& components, Inputs component_inputs, double system_frequency) {
-    using ComponentView =
-        std::conditional_t<std::same_as<std::ranges::range_reference_t<Inputs>, typename Component::InputType const&>,
-                           typename Component::InputType const&, typename Component::InputType>;
+inline void add_component(ComponentContainer& components, Inputs component_inputs, double system_frequency,
+                          std::span<Idx2D const> node_idx = {}) {
+    using ComponentView = detail::component_input_view_t<Component, Inputs>;
+    constexpr bool ids_registered = id_registration == IdRegistration::in_advance;
+
+    if constexpr (!ids_registered) {
+        reserve_component<Component>(components, std::ranges::size(component_inputs));
+    }
+    assert(ids_registered || node_idx.empty());
+    Idx2D next_component{.group = get_component_group_idx<Component>(components), .pos = 0};
+    // the index of a referenced component, see detail::get_referenced_component_idx
+    [[maybe_unused]] auto const get_idx = [&components, &next_component]<typename Gettable = void>(
+                                              ID ref_id, std::type_identity<Gettable> /*type*/ = {}) {
+        return detail::get_referenced_component_idx<Gettable, id_registration>(components, ref_id, next_component);
+    };
+    // the node references are looked up one by one, unless they are resolved in advance
+    [[maybe_unused]] auto get_node = [&components, &get_idx, &next_component, next_node_idx = node_idx.begin(),
+                                      resolved = !node_idx.empty()](ID node_id) mutable -> Node const& {
+        if (!resolved) {
+            return get_component<Node>(components, get_idx(node_id, std::type_identity<Node>{}));
+        }
+        Idx2D const idx = *next_node_idx++;
+        if (!detail::is_constructed_before(idx, next_component)) {
+            throw IDNotFound{node_id};
+        }
+        if (idx.group != get_component_group_idx<Node>(components)) {
+            throw IDWrongType{node_id};
+        }
+        return get_component<Node>(components, idx);
+    };
+    auto const emplace = [&components]<typename... Args>(ID id, Args&&... args) {
+        if constexpr (ids_registered) {
+            emplace_registered_component<Component>(components, id, std::forward<Args>(args)...);
+        } else {
+            emplace_component<Component>(components, id, std::forward<Args>(args)...);
+        }
+    };
 
-    reserve_component<Component>(components, std::ranges::size(component_inputs));
     // do sanity check on the transformer tap regulator
     std::vector<Idx2D> regulated_objects;
     // loop to add component
@@ -64,94 +238,98 @@ inline void add_component(ComponentContainer& components, Inputs component_input
         ID const id = input.id;
         // construct based on type of component
         if constexpr (std::derived_from<Component, Node>) {
-            emplace_component<Component>(components, id, input);
+            emplace(id, input);
         } else if constexpr (std::derived_from<Component, Branch>) {
-            double const u1 = get_component<Node>(components, input.from_node).u_rated();
-            double const u2 = get_component<Node>(components, input.to_node).u_rated();
+            double const u1 = get_node(input.from_node).u_rated();
+            double const u2 = get_node(input.to_node).u_rated();
             // set system frequency for line
             if constexpr (std::same_as<Component, Line> || std::same_as<Component, AsymLine>) {
-                emplace_component<Component>(components, id, input, system_frequency, u1, u2);
+                emplace(id, input, system_frequency, u1, u2);
             } else {
-                emplace_component<Component>(components, id, input, u1, u2);
+                emplace(id, input, u1, u2);
             }
         } else if constexpr (std::derived_from<Component, Branch3>) {
-            double const u1 = get_component<Node>(components, input.node_1).u_rated();
-            double const u2 = get_component<Node>(components, input.node_2).u_rated();
-            double const u3 = get_component<Node>(components, input.node_3).u_rated();
-            emplace_component<Component>(components, id, input, u1, u2, u3);
+            double const u1 = get_node(input.node_1).u_rated();
+            double const u2 = get_node(input.node_2).u_rated();
+            double const u3 = get_node(input.node_3).u_rated();
+            emplace(id, input, u1, u2, u3);
         } else if constexpr (std::derived_from<Component, Appliance>) {
-            double const u = get_component<Node>(components, input.node).u_rated();
-            emplace_component<Component>(components, id, input, u);
+            double const u = get_node(input.node).u_rated();
+            emplace(id, input, u);
         } else if constexpr (std::derived_from<Component, GenericVoltageSensor>) {
-            double const u = get_component<Node>(components, input.measured_object).u_rated();
-            emplace_component<Component>(components, id, input, u);
+            double const u = get_node(input.measured_object).u_rated();
+            emplace(id, input, u);
         } else if constexpr (std::derived_from<Component, GenericPowerSensor>) {
             // it is not allowed to place a sensor at a link
-            if (get_component_idx_by_id(components, input.measured_object).group ==
-                get_component_type_index<Link>(components)) {
+            if (get_idx(input.measured_object).group == get_component_type_index<Link>(components)) {
                 throw InvalidMeasuredObject("Link", "PowerSensor");
             }
             ID const measured_object = input.measured_object;
             // check correctness of measured component type based on measured terminal type
+            // only the index is used, the measured object may be constructed concurrently
             switch (input.measured_terminal_type) {
                 using enum MeasuredTerminalType;
 
             case branch_from:
                 [[fallthrough]];
             case branch_to:
-                get_component<Branch>(components, measured_object);
+                get_idx(measured_object, std::type_identity<Branch>{});
                 break;
             case branch3_1:
                 [[fallthrough]];
             case branch3_2:
                 [[fallthrough]];
             case branch3_3:
-                get_component<Branch3>(components, measured_object);
+                get_idx(measured_object, std::type_identity<Branch3>{});
                 break;
             case shunt:
-                get_component<Shunt>(components, measured_object);
+                get_idx(measured_object, std::type_identity<Shunt>{});
                 break;
             case source:
-                get_component<Source>(components, measured_object);
+                get_idx(measured_object, std::type_identity<Source>{});
                 break;
             case load:
-                get_component<GenericLoad>(components, measured_object);
+                get_idx(measured_object, std::type_identity<GenericLoad>{});
                 break;
             case generator:
-                get_component<GenericGenerator>(components, measured_object);
+                get_idx(measured_object, std::type_identity<GenericGenerator>{});
                 break;
             case node:
-                get_component<Node>(components, measured_object);
+                get_idx(measured_object, std::type_identity<Node>{});
                 break;
             default:
                 throw MissingCaseForEnumError{std::format("{} item retrieval", GenericPowerSensor::name),
                                               input.measured_terminal_type};
             }
 
-            emplace_component<Component>(components, id, input);
+            emplace(id, input);
         } else if constexpr (std::derived_from<Component, GenericCurrentSensor>) {
             // it is not allowed to place a sensor at a link
-            if (get_component_idx_by_id(components, input.measured_object).group ==
-                get_component_type_index<Link>(components)) {
+            if (get_idx(input.measured_object).group == get_component_type_index<Link>(components)) {
                 throw InvalidMeasuredObject("Link", "CurrentSensor");
             }
             // check correctness and get node based on measured terminal type
-            ID const node = [&components, measured_object = input.measured_object,
+            ID const node = [&components, &get_idx, measured_object = input.measured_object,
                              measured_terminal_type = input.measured_terminal_type] {
                 switch (measured_terminal_type) {
                     using enum MeasuredTerminalType;
                     using enum Branch3Side;
 
                 case branch_from:
-                    return get_component<Branch>(components, measured_object).node(BranchSide::from);
+                    return get_component<Branch>(components, get_idx(measured_object, std::type_identity<Branch>{}))
+                        .node(BranchSide::from);
                 case branch_to:
-                    return get_component<Branch>(components, measured_object).node(BranchSide::to);
+                    return get_component<Branch>(components, get_idx(measured_object, std::type_identity<Branch>{}))
+                        .node(BranchSide::to);
                 case branch3_1:
-                    return get_component<Branch3>(components, measured_object).node(side_1);
+                    return get_component<Branch3>(components, get_idx(measured_object, std::type_identity<Branch3>{}))
+                        .node(side_1);
                 case branch3_2:
-                    return get_component<Branch3>(components, measured_object).node(side_2);
+                    return get_component<Branch3>(components, get_idx(measured_object, std::type_identity<Branch3>{}))
+                        .node(side_2);
                 case branch3_3:
-                    return get_component<Branch3>(components, measured_object).node(side_3);
+                    return get_component<Branch3>(components, get_idx(measured_object, std::type_identity<Branch3>{}))
+                        .node(side_3);
                 default:
                     throw MissingCaseForEnumError{std::format("{} item retrieval", GenericCurrentSensor::name),
                                                   measured_terminal_type};
@@ -160,14 +338,13 @@ inline void add_component(ComponentContainer& components, Inputs component_input
 
             double const u_rated = get_component<Node>(components, node).u_rated();
 
-            emplace_component<Component>(components, id, input, u_rated);
+            emplace(id, input, u_rated);
         } else if constexpr (std::derived_from<Component, Fault>) {
             // check that fault object exists (currently, only faults at nodes are supported)
-            get_component<Node>(components, input.fault_object);
-            emplace_component<Component>(components, id, input);
+            get_node(input.fault_object);
+            emplace(id, input);
         } else if constexpr (std::derived_from<Component, TransformerTapRegulator>) {
-            Idx2D const regulated_object_idx =
-                main_core::get_component_idx_by_id<ComponentContainer>(components, input.regulated_object);
+            Idx2D const regulated_object_idx = get_idx(input.regulated_object);
             regulated_objects.push_back(regulated_object_idx);
 
             ID const regulated_terminal = [&input, &components, &regulated_object_idx] {
@@ -212,10 +389,9 @@ inline void add_component(ComponentContainer& components, Inputs component_input
             auto const regulated_object_type = get_component<Base>(components, regulated_object_idx).math_model_type();
             double const u_rated = get_component<Node>(components, regulated_terminal).u_rated();
 
-            emplace_component<Component>(components, id, input, regulated_object_type, u_rated);
+            emplace(id, input, regulated_object_type, u_rated);
         } else if constexpr (std::derived_from<Component, VoltageRegulator>) {
-            Idx2D const regulated_object_idx =
-                main_core::get_component_idx_by_id<ComponentContainer>(components, input.regulated_object);
+            Idx2D const regulated_object_idx = get_idx(input.regulated_object);
             regulated_objects.push_back(regulated_object_idx);
 
             // regulate generators
@@ -229,8 +405,9 @@ inline void add_component(ComponentContainer& components, Inputs component_input
 
             auto const& regulated_object = get_component<Appliance>(components, regulated_object_idx);
             auto const regulated_object_type = regulated_object.math_model_type();
-            emplace_component<Component>(components, id, input, regulated_object_type);
+            emplace(id, input, regulated_object_type);
         }
+        ++next_component.pos;
     }
     // Make sure that each regulated object has at most one regulator
     const std::unordered_set<Idx2D, Idx2DHash> unique_regulated_objects(regulated_objects.begin(),
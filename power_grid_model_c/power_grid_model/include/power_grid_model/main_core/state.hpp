@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include "component_columns.hpp"
+
 #include "../calculation_parameters.hpp"
 #include "../container_fwd.hpp"
 
@@ -17,6 +19,8 @@ template <class CompContainer> struct MainModelState {
     using ComponentContainer = CompContainer;
 
     ComponentContainer components;
+    // structure-of-arrays copy of the calculation parameters of the components
+    ComponentColumns columns;
 
     // calculation parameters
     std::shared_ptr<ComponentTopology const> comp_topo;
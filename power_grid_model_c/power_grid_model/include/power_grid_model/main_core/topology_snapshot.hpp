@@ -0,0 +1,400 @@
+// SPDX-FileCopyrightText: Contributors to the Power Grid Model project <powergridmodel@lfenergy.org>
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+// Binary snapshot of the built topology of a model, i.e., the math topologies including the bus ordering and the
+// fill-in of the minimum degree ordering, and the coupling of the components to the math topologies.
+// Restoring a snapshot skips the graph traversal and the ordering, which dominate the preparation of a large grid.
+// The components and the solvers are not part of the snapshot: they are polymorphic and are constructed from the
+// input data as usual.
+//
+// The snapshot also contains the component topology and connections of the grid it was made of.
+// They are compared exactly with the model on restoring, so a snapshot cannot be restored onto a different grid.
+//
+// The snapshot also records the fill-reducing ordering method of the fill-in. It is only restored onto a model that
+// uses the same method.
+//
+// Layout, in the native byte order:
+//     magic, format version, byte order mark, size of Idx, sparse ordering method (all as 32-bit unsigned integers)
+//     component topology and connections
+//     number of math topologies, followed by each math topology
+//     coupling of the components to the math topologies
+// A vector is stored as its number of elements (64-bit unsigned integer), followed by the raw elements.
+// Nothing is aligned, so the snapshot can be restored from any buffer, e.g., a memory-mapped file.
+
+#include "../calculation_parameters.hpp"
+#include "../common/common.hpp"
+#include "../common/counting_iterator.hpp"
+#include "../common/enum.hpp"
+#include "../common/exception.hpp"
+#include "../common/grouped_index_vector.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <ostream>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace power_grid_model::main_core {
+
+struct TopologySnapshot {
+    std::vector<std::shared_ptr<MathModelTopology const>> math_topology;
+    std::shared_ptr<TopologicalComponentToMathCoupling const> topo_comp_coup;
+};
+
+namespace detail::snapshot {
+
+constexpr uint32_t magic = 0x4F54'4750; // "PGTO" in little endian
+constexpr uint32_t format_version = 2;
+constexpr uint32_t byte_order_mark = 0x0102'0304;
+
+template <typename T>
+concept plain_value = std::is_trivially_copyable_v<T> && !std::same_as<T, bool>;
+
+template <typename Archive, typename Topo>
+    requires std::same_as<std::remove_const_t<Topo>, ComponentTopology>
+void visit_fields(Archive& archive, Topo& comp_topo) {
+    archive(comp_topo.n_node);
+    archive(comp_topo.branch_node_idx);
+    archive(comp_topo.branch3_node_idx);
+    archive(comp_topo.link_node_idx);
+    archive(comp_topo.shunt_node_idx);
+    archive(comp_topo.source_node_idx);
+    archive(comp_topo.load_gen_node_idx);
+    archive(comp_topo.load_gen_type);
+    archive(comp_topo.voltage_sensor_node_idx);
+    archive(comp_topo.power_sensor_object_idx);
+    archive(comp_topo.power_sensor_terminal_type);
+    archive(comp_topo.current_sensor_object_idx);
+    archive(comp_topo.current_sensor_terminal_type);
+    archive(comp_topo.regulator_type);
+    archive(comp_topo.regulated_object_idx);
+    archive(comp_topo.regulated_object_type);
+}
+
+template <typename Archive, typename Conn>
+    requires std::same_as<std::remove_const_t<Conn>, ComponentConnections>
+void visit_fields(Archive& archive, Conn& comp_conn) {
+    archive(comp_conn.branch_connected);
+    archive(comp_conn.branch3_connected);
+    archive(comp_conn.link_connected);
+    archive(comp_conn.branch_phase_shift);
+    archive(comp_conn.branch3_phase_shift);
+    archive(comp_conn.source_connected);
+}
+
+template <typename Archive, typename Topo>
+    requires std::same_as<std::remove_const_t<Topo>, MathModelTopology>
+void visit_fields(Archive& archive, Topo& math_topo) {
+    archive(math_topo.slack_bus);
+    archive(math_topo.is_radial);
+    archive(math_topo.phase_shift);
+    archive(math_topo.branch_bus_idx);
+    archive(math_topo.fill_in);
+    archive(math_topo.sources_per_bus);
+    archive(math_topo.shunts_per_bus);
+    archive(math_topo.load_gens_per_bus);
+    archive(math_topo.load_gen_type);
+    archive(math_topo.voltage_sensors_per_bus);
+    archive(math_topo.power_sensors_per_source);
+    archive(math_topo.power_sensors_per_load_gen);
+    archive(math_topo.power_sensors_per_shunt);
+    archive(math_topo.power_sensors_per_branch_from);
+    archive(math_topo.power_sensors_per_branch_to);
+    archive(math_topo.power_sensors_per_bus);
+    archive(math_topo.current_sensors_per_branch_from);
+    archive(math_topo.current_sensors_per_branch_to);
+    archive(math_topo.tap_regulators_per_branch);
+    archive(math_topo.voltage_regulators_per_load_gen);
+}
+
+template <typename Archive, typename Coup>
+    requires std::same_as<std::remove_const_t<Coup>, TopologicalComponentToMathCoupling>
+void visit_fields(Archive& archive, Coup& topo_comp_coup) {
+    archive(topo_comp_coup.node);
+    archive(topo_comp_coup.branch);
+    archive(topo_comp_coup.branch3);
+    archive(topo_comp_coup.shunt);
+    archive(topo_comp_coup.load_gen);
+    archive(topo_comp_coup.source);
+    archive(topo_comp_coup.voltage_sensor);
+    archive(topo_comp_coup.power_sensor);
+    archive(topo_comp_coup.current_sensor);
+    archive(topo_comp_coup.regulator);
+    archive(topo_comp_coup.voltage_regulator);
+}
+
+template <typename Sink> class Writer {
+  public:
+    explicit Writer(Sink& sink) : sink_{sink} {}
+
+    template <plain_value T> void operator()(T const& value) { write_bytes(&value, sizeof(T)); }
+    void operator()(bool value) { (*this)(static_cast<uint8_t>(value)); }
+    template <plain_value T> void operator()(std::vector<T> const& values) {
+        (*this)(static_cast<uint64_t>(values.size()));
+        write_bytes(values.data(), values.size() * sizeof(T));
+    }
+    // the grouped vectors are stored in their own encoding, reconstructed from the public interface
+    void operator()(DenseGroupedIdxVector const& grouped) {
+        IdxVector dense(grouped.element_size());
+        for (Idx const element : IdxRange{grouped.element_size()}) {
+            dense[element] = grouped.get_group(element);
+        }
+        (*this)(grouped.size());
+        (*this)(dense);
+    }
+    void operator()(SparseGroupedIdxVector const& grouped) {
+        IdxVector indptr;
+        indptr.reserve(static_cast<size_t>(grouped.size()) + 1);
+        for (Idx const group : IdxRange{grouped.size()}) {
+            indptr.push_back(*grouped.get_element_range(group).begin());
+        }
+        indptr.push_back(grouped.element_size());
+        (*this)(indptr);
+    }
+
+  private:
+    Sink& sink_; // NOLINT(cppcoreguidelines-avoid-const-or-ref-data-members)
+
+    void write_bytes(void const* data, size_t size) { sink_.write(static_cast<char const*>(data), size); }
+};
+
+class Reader {
+  public:
+    explicit Reader(std::span<char const> data) : data_{data} {}
+
+    template <plain_value T> void operator()(T& value) { read_bytes(&value, sizeof(T)); }
+    void operator()(bool& value) {
+        uint8_t stored{};
+        (*this)(stored);
+        value = stored != 0;
+    }
+    template <plain_value T> void operator()(std::vector<T>& values) {
+        values.resize(read_size(sizeof(T)));
+        read_bytes(values.data(), values.size() * sizeof(T));
+    }
+    void operator()(DenseGroupedIdxVector& grouped) {
+        Idx num_groups{};
+        IdxVector dense;
+        (*this)(num_groups);
+        (*this)(dense);
+        if (num_groups < 0 || !std::ranges::is_sorted(dense) ||
+            (!dense.empty() && (dense.front() < 0 || dense.back() >= num_groups))) {
+            throw_corrupted();
+        }
+        grouped = DenseGroupedIdxVector{from_dense, std::move(dense), num_groups};
+    }
+    void operator()(SparseGroupedIdxVector& grouped) {
+        IdxVector indptr;
+        (*this)(indptr);
+        if (indptr.empty() || indptr.front() != 0 || !std::ranges::is_sorted(indptr)) {
+            throw_corrupted();
+        }
+        grouped = SparseGroupedIdxVector{from_sparse, std::move(indptr)};
+    }
+
+    // compare the stored values with the expected ones instead of reading them, without allocation
+    template <plain_value T> void expect(T const& expected) {
+        T stored{};
+        (*this)(stored);
+        if (std::memcmp(&stored, &expected, sizeof(T)) != 0) {
+            throw_mismatch();
+        }
+    }
+    template <plain_value T> void expect(std::vector<T> const& expected) {
+        uint64_t size{};
+        (*this)(size);
+        if (size != expected.size()) {
+            throw_mismatch();
+        }
+        size_t const n_bytes = expected.size() * sizeof(T);
+        if (n_bytes > data_.size() - offset_) {
+            throw_corrupted();
+        }
+        if (n_bytes != 0 && std::memcmp(data_.data() + offset_, expected.data(), n_bytes) != 0) {
+            throw_mismatch();
+        }
+        offset_ += n_bytes;
+    }
+
+    bool at_end() const { return offset_ == data_.size(); }
+
+    [[noreturn]] static void throw_corrupted() {
+        throw SerializationError{"The topology snapshot is truncated or corrupted.\n"};
+    }
+
+  private:
+    std::span<char const> data_;
+    size_t offset_{};
+
+    size_t read_size(size_t element_size) {
+        uint64_t size{};
+        (*this)(size);
+        if (size > (data_.size() - offset_) / element_size) {
+            throw_corrupted();
+        }
+        return static_cast<size_t>(size);
+    }
+
+    void read_bytes(void* destination, size_t size) {
+        if (size > data_.size() - offset_) {
+            throw_corrupted();
+        }
+        if (size != 0) {
+            std::memcpy(destination, data_.data() + offset_, size);
+        }
+        offset_ += size;
+    }
+
+    [[noreturn]] static void throw_mismatch() {
+        throw SerializationError{"The topology snapshot was made of a different grid or of a different state of the "
+                                 "switches, so it cannot be restored onto this model.\n"};
+    }
+};
+
+// adapts the expect functions of the reader to the field visitors
+struct Expecter {
+    Reader& reader; // NOLINT(cppcoreguidelines-avoid-const-or-ref-data-members)
+
+    template <typename T> void operator()(T const& expected) { reader.expect(expected); }
+};
+
+} // namespace detail::snapshot
+
+// the destinations of a snapshot
+// write the snapshot to a stream, e.g., a file
+class TopologySnapshotStream {
+  public:
+    explicit TopologySnapshotStream(std::ostream& stream) : stream_{stream} {}
+
+    void write(char const* data, size_t size) {
+        stream_.write(data, static_cast<std::streamsize>(size));
+        if (!stream_) {
+            throw SerializationError{"Cannot write the topology snapshot.\n"};
+        }
+    }
+
+  private:
+    std::ostream& stream_; // NOLINT(cppcoreguidelines-avoid-const-or-ref-data-members)
+};
+
+// write the snapshot to a buffer of at least the size counted by TopologySnapshotSize
+class TopologySnapshotBuffer {
+  public:
+    explicit TopologySnapshotBuffer(std::span<char> buffer) : buffer_{buffer} {}
+
+    void write(char const* data, size_t size) {
+        if (size > buffer_.size() - offset_) {
+            throw SerializationError{"The buffer is too small for the topology snapshot.\n"};
+        }
+        if (size != 0) {
+            std::memcpy(buffer_.data() + offset_, data, size);
+        }
+        offset_ += size;
+    }
+
+  private:
+    std::span<char> buffer_;
+    size_t offset_{};
+};
+
+// only count the size of the snapshot
+class TopologySnapshotSize {
+  public:
+    void write(char const* /* data */, size_t size) { size_ += size; }
+    Idx size() const { return static_cast<Idx>(size_); }
+
+  private:
+    size_t size_{};
+};
+
+template <typename Sink>
+inline void write_topology_snapshot(Sink& sink, ComponentTopology const& comp_topo,
+                                    ComponentConnections const& comp_conn,
+                                    std::vector<std::shared_ptr<MathModelTopology const>> const& math_topology,
+                                    TopologicalComponentToMathCoupling const& topo_comp_coup,
+                                    SparseOrderingMethod sparse_ordering_method) {
+    using namespace detail::snapshot;
+
+    Writer<Sink> writer{sink};
+    writer(magic);
+    writer(format_version);
+    writer(byte_order_mark);
+    writer(static_cast<uint32_t>(sizeof(Idx)));
+    writer(static_cast<uint32_t>(sparse_ordering_method));
+    visit_fields(writer, comp_topo);
+    visit_fields(writer, comp_conn);
+    writer(static_cast<Idx>(math_topology.size()));
+    for (auto const& math_topo : math_topology) {
+        visit_fields(writer, *math_topo);
+    }
+    visit_fields(writer, topo_comp_coup);
+}
+
+// throws a SerializationError if the snapshot is corrupted, was made of another component topology or connections,
+//     or with another sparse ordering method
+inline TopologySnapshot read_topology_snapshot(std::span<char const> data, ComponentTopology const& comp_topo,
+                                               ComponentConnections const& comp_conn,
+                                               SparseOrderingMethod sparse_ordering_method) {
+    using namespace detail::snapshot;
+
+    Reader reader{data};
+    uint32_t stored_magic{};
+    uint32_t stored_version{};
+    uint32_t stored_byte_order_mark{};
+    uint32_t stored_idx_size{};
+    uint32_t stored_sparse_ordering_method{};
+    reader(stored_magic);
+    reader(stored_version);
+    reader(stored_byte_order_mark);
+    reader(stored_idx_size);
+    reader(stored_sparse_ordering_method);
+    if (stored_magic != magic) {
+        throw SerializationError{"The data is not a topology snapshot.\n"};
+    }
+    if (stored_version != format_version) {
+        throw SerializationError{"Unsupported topology snapshot version: " + std::to_string(stored_version) +
+                                 ", expected version: " + std::to_string(format_version) + "\n"};
+    }
+    if (stored_byte_order_mark != byte_order_mark || stored_idx_size != sizeof(Idx)) {
+        throw SerializationError{"The topology snapshot was made on a platform with a different byte order or "
+                                 "integer size.\n"};
+    }
+    if (stored_sparse_ordering_method != static_cast<uint32_t>(sparse_ordering_method)) {
+        throw SerializationError{"The topology snapshot was made with a different sparse ordering method: " +
+                                 std::to_string(stored_sparse_ordering_method) + ", expected sparse ordering method: " +
+                                 std::to_string(static_cast<uint32_t>(sparse_ordering_method)) + "\n"};
+    }
+
+    Expecter expecter{reader};
+    visit_fields(expecter, comp_topo);
+    visit_fields(expecter, comp_conn);
+
+    Idx n_math_topology{};
+    reader(n_math_topology);
+    if (n_math_topology < 0 || n_math_topology > comp_topo.n_node_total()) {
+        Reader::throw_corrupted();
+    }
+    TopologySnapshot result;
+    result.math_topology.reserve(static_cast<size_t>(n_math_topology));
+    for ([[maybe_unused]] Idx const idx : IdxRange{n_math_topology}) {
+        MathModelTopology math_topo;
+        visit_fields(reader, math_topo);
+        result.math_topology.push_back(std::make_shared<MathModelTopology const>(std::move(math_topo)));
+    }
+    TopologicalComponentToMathCoupling topo_comp_coup;
+    visit_fields(reader, topo_comp_coup);
+    result.topo_comp_coup = std::make_shared<TopologicalComponentToMathCoupling const>(std::move(topo_comp_coup));
+    if (!reader.at_end()) {
+        Reader::throw_corrupted();
+    }
+    return result;
+}
+
+} // namespace power_grid_model::main_core
@@ -190,9 +190,9 @@ inline void get_component_sequence_impl(ComponentContainer const& components, El
     using UpdateType = Component::UpdateType;
 
     if (n_comp_elements < 0) {
-        std::ranges::transform(elements, destination, [&components](UpdateType const& update) {
-            return get_component_idx_by_id<Component>(components, update.id);
-        });
+        get_component_idx_by_id<Component>(
+            components, elements | std::views::transform([](UpdateType const& update) { return update.id; }),
+            destination);
     } else {
         assert(std::ranges::ssize(elements) <= n_comp_elements);
         std::ranges::transform(
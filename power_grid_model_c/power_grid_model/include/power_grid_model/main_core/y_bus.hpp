@@ -11,6 +11,7 @@
 #include "../component/branch3.hpp"
 #include "../component/component.hpp"
 #include "../math_solver/y_bus.hpp"
+#include "component_columns.hpp"
 #include "container_queries.hpp"
 #include "math_state.hpp"
 #include "state.hpp"
@@ -34,8 +35,8 @@ constexpr void add_to_math_model_params(std::vector<MathModelParamType>& math_mo
     }
     // assign parameters
     auto& model_params = math_model_param[math_idx.group];
-    auto branch_params = state.components.template get_item_by_seq<Branch>(topology_sequence_idx)
-                             .template calc_param<typename MathModelParamType::sym>();
+    auto branch_params =
+        get_columns<typename MathModelParamType::sym>(state.columns).branch_param[topology_sequence_idx];
 
     if constexpr (std::derived_from<MathModelParamType, MathModelParamIncrement<typename MathModelParamType::sym>>) {
         model_params.branch_param.push_back(std::move(branch_params));
@@ -54,8 +55,8 @@ constexpr void add_to_math_model_params(std::vector<MathModelParamType>& math_mo
         return;
     }
     // assign parameters, branch3 param consists of three branch parameters
-    auto branch3_param = state.components.template get_item_by_seq<Branch3>(topology_sequence_idx)
-                             .template calc_param<typename MathModelParamType::sym>();
+    auto branch3_param =
+        get_columns<typename MathModelParamType::sym>(state.columns).branch3_param[topology_sequence_idx];
 
     auto& model_params = math_model_param[math_idx.group];
     for (Idx const branch2 : IdxRange{3}) {
@@ -7,6 +7,7 @@
 #include "all_components.hpp"
 #include "job_adapter.hpp"
 #include "job_dispatch.hpp"
+#include "job_worker_pool.hpp"
 #include "main_model_impl.hpp"
 
 #include "auxiliary/dataset.hpp"
@@ -20,10 +21,14 @@
 #include "main_model_fwd.hpp"
 #include "math_solver/math_solver_dispatch.hpp"
 
+#include <algorithm>
 #include <cassert>
 #include <functional>
 #include <memory>
+#include <ostream>
+#include <span>
 #include <string_view>
+#include <thread>
 #include <utility>
 
 namespace power_grid_model {
@@ -39,12 +44,14 @@ class MainModel {
   public:
     using Options = MainModelOptions;
 
+    // threading of the construction of large models, the same as the threading of the calculation options
     explicit MainModel(double system_frequency, ConstDataset const& input_data,
                        MathSolverDispatcher const& math_solver_dispatcher, Idx pos = 0,
-                       MultiThreadedLogger& logger = no_logger_)
+                       MultiThreadedLogger& logger = no_logger_, Idx threading = Options::sequential)
         : impl_{std::make_unique<Impl>(
               system_frequency, input_data,
-              SolverPreparationContext{.math_state = {}, .math_solver_dispatcher = &math_solver_dispatcher}, pos)},
+              SolverPreparationContext{.math_state = {}, .math_solver_dispatcher = &math_solver_dispatcher}, pos,
+              threading)},
           logger_{logger} {}
     explicit MainModel(double system_frequency, meta_data::MetaData const& meta_data,
                        MathSolverDispatcher const& math_solver_dispatcher, MultiThreadedLogger& logger = no_logger_)
@@ -53,28 +60,42 @@ class MainModel {
               SolverPreparationContext{.math_state = {}, .math_solver_dispatcher = &math_solver_dispatcher})},
           logger_{logger} {};
 
-    // deep copy
+    // deep copy, the worker pool is not copied
     MainModel(MainModel const& other) {
         if (other.impl_ != nullptr) {
             impl_ = std::make_unique<Impl>(*other.impl_);
             logger_ = other.logger_;
         }
+        batch_scheduling_ = other.batch_scheduling_;
     }
+    // the worker pool of this model is kept, the copies of the previous model are discarded
     MainModel& operator=(MainModel const& other) {
         if (this != &other) {
             impl_.reset();
+            if (model_replicas_ != nullptr) {
+                model_replicas_->clear(); // the replicas are copies of the previous model
+            }
             if (other.impl_ != nullptr) {
                 impl_ = std::make_unique<Impl>(*other.impl_);
                 logger_ = other.logger_;
             }
+            batch_scheduling_ = other.batch_scheduling_;
         }
         return *this;
     }
-    MainModel(MainModel&& other) noexcept : impl_{std::move(other.impl_)}, logger_{other.logger_} {}
+    MainModel(MainModel&& other) noexcept
+        : impl_{std::move(other.impl_)},
+          thread_pool_{std::move(other.thread_pool_)},
+          model_replicas_{std::move(other.model_replicas_)},
+          logger_{other.logger_},
+          batch_scheduling_{other.batch_scheduling_} {}
     MainModel& operator=(MainModel&& other) noexcept {
         if (this != &other) {
             impl_ = std::move(other.impl_);
+            thread_pool_ = std::move(other.thread_pool_);
+            model_replicas_ = std::move(other.model_replicas_);
             logger_ = other.logger_;
+            batch_scheduling_ = other.batch_scheduling_;
         }
         return *this;
     };
@@ -84,10 +105,78 @@ class MainModel {
         impl().get_indexer(component_type, id_begin, size, indexer_begin);
     }
 
+    // save the built topology of the model to a binary snapshot, see main_core/topology_snapshot.hpp
+    void save_topology_snapshot(std::ostream& stream) {
+        main_core::TopologySnapshotStream sink{stream};
+        impl().save_topology_snapshot(sink);
+    }
+
+    // the size of the snapshot in bytes, for the buffer of save_topology_snapshot
+    // the size is valid as long as the model is not updated
+    Idx topology_snapshot_size() {
+        main_core::TopologySnapshotSize sink;
+        impl().save_topology_snapshot(sink);
+        return sink.size();
+    }
+
+    // save the snapshot to a buffer of at least topology_snapshot_size() bytes
+    void save_topology_snapshot(std::span<char> buffer) {
+        main_core::TopologySnapshotBuffer sink{buffer};
+        impl().save_topology_snapshot(sink);
+    }
+
+    // restore the topology from a snapshot of a model with the same components, instead of building it
+    void load_topology_snapshot(std::span<char const> snapshot) {
+        impl().load_topology_snapshot(snapshot);
+        if (model_replicas_ != nullptr) {
+            model_replicas_->clear(); // the replicas should get the restored topology as well
+        }
+    }
+
     template <cache_type_c CacheType> void update_components(ConstDataset const& update_data) {
+        if (model_replicas_ != nullptr) {
+            model_replicas_->clear(); // the replicas are no longer equal to the model
+        }
         impl().update_components<CacheType>(update_data.get_individual_scenario(0));
     }
 
+    /*
+    Keep worker threads and copies of the model alive between batch calculations
+
+    n_workers
+        < 0 remove the worker pool, threads are created for each batch calculation again
+        = 0 use number of hardware threads
+        > 0 specify number of worker threads
+    the number of threads of a batch calculation is limited by the number of workers
+    the copies of the model are discarded when the model is updated
+    */
+    void set_worker_pool(Idx n_workers) {
+        thread_pool_.reset();
+        model_replicas_.reset();
+        if (n_workers < 0) {
+            return;
+        }
+        if (n_workers == 0) {
+            n_workers = std::max(static_cast<Idx>(std::jthread::hardware_concurrency()), Idx{1});
+        }
+        thread_pool_ = std::make_unique<JobThreadPool>(n_workers);
+        model_replicas_ = std::make_unique<ModelReplicas<Impl>>();
+    }
+
+    // the assignment of the batch scenarios to the threads
+    // the dynamic scheduling is the default, the static round-robin is a baseline for benchmarks and tests
+    void set_batch_scheduling(JobDispatch::BatchScheduling scheduling) { batch_scheduling_ = scheduling; }
+
+    // the logger of the calculations, nullptr to stop logging
+    // the logger should outlive the model
+    void set_logger(MultiThreadedLogger* logger) {
+        if (logger == nullptr) {
+            logger_ = no_logger_;
+        } else {
+            logger_ = *logger;
+        }
+    }
+
     /*
     Batch calculation, propagating the results to result_data
 
@@ -99,12 +188,32 @@ class MainModel {
         < 0 sequential
         = 0 parallel, use number of hardware threads
         > 0 specify number of parallel threads
+    for a batch, the scenarios are calculated in parallel
+    for a multi-dimensional batch, all scenarios of the cartesian product are calculated as one batch
+    for a single calculation, the electrically isolated subgrids are solved in parallel
     raise a BatchCalculationError if any of the calculations in the batch raised an exception
     */
     BatchParameter calculate(Options const& options, MutableDataset const& result_data,
                              ConstDataset const& update_data) {
-        JobAdapter<Impl> adapter{std::ref(impl()), std::ref(options)};
-        return JobDispatch::batch_calculation(adapter, result_data, update_data, options.threading, logger_.get());
+        Options scenario_options = options; // copy
+        if (!JobDispatch::is_empty_batch(update_data)) {
+            // the threads are already spent on the scenarios, so each scenario solves its subgrids sequentially
+            scenario_options.threading = Options::sequential;
+        }
+        JobAdapter<Impl> adapter{std::ref(impl()), std::cref(scenario_options), model_replicas_.get()};
+        return JobDispatch::batch_calculation(adapter, result_data, update_data, options.threading, logger_.get(),
+                                              thread_pool_.get(), batch_scheduling_);
+    }
+
+    /*
+    Short circuit sweep, propagating the results to result_data
+
+    Every fault is calculated separately, as if only that fault is active.
+    result_data should be a batch with one scenario per fault.
+    The network without faults is factorized once, the threads are spent on the sparse LU solver.
+    */
+    void calculate_short_circuit_sweep(Options const& options, MutableDataset const& result_data) {
+        impl().calculate_short_circuit_sweep(options, result_data, logger_.get());
     }
 
     void check_no_experimental_features_used(Options const& options, ConstDataset const* batch_dataset) const {
@@ -126,8 +235,11 @@ class MainModel {
     }
 
     std::unique_ptr<Impl> impl_;
+    std::unique_ptr<JobThreadPool> thread_pool_;
+    std::unique_ptr<ModelReplicas<Impl>> model_replicas_;
     inline static NoMultiThreadedLogger no_logger_{};
     std::reference_wrapper<MultiThreadedLogger> logger_{no_logger_};
+    JobDispatch::BatchScheduling batch_scheduling_{JobDispatch::BatchScheduling::dynamic};
 };
 
 } // namespace power_grid_model
@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include "calculation_parameters.hpp"
+
 #include "common/common.hpp"
 #include "common/enum.hpp"
 
@@ -30,8 +32,14 @@ struct MainModelOptions {
     double err_tol{1e-8};
     Idx max_iter{20};
     Idx threading{sequential};
+    PowerFlowInitialization pf_initialization{PowerFlowInitialization::cold_start};
+    SparseOrderingMethod sparse_ordering{SparseOrderingMethod::minimum_degree};
+    // state estimation only: check the observability without solving, the output is not written
+    bool observability_check_only{false};
 
     ShortCircuitVoltageScaling short_circuit_voltage_scaling{ShortCircuitVoltageScaling::maximum};
+
+    SolverOutputRequest solver_output_request{};
 };
 
 } // namespace power_grid_model
@@ -9,11 +9,13 @@
 // main include
 #include "calculation_parameters.hpp"
 #include "calculation_preparation.hpp"
+#include "job_dispatch.hpp"
 #include "main_model_fwd.hpp"
 #include "math_solver/y_bus.hpp"
 
 // common
 #include "common/common.hpp"
+#include "common/counting_iterator.hpp"
 #include "common/enum.hpp"
 #include "common/exception.hpp"
 #include "common/logging.hpp"
@@ -44,13 +46,17 @@
 // stl library
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cassert>
 #include <concepts>
+#include <exception>
+#include <functional>
 #include <limits>
 #include <memory>
 #include <ranges>
 #include <span>
 #include <string_view>
+#include <thread>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -81,6 +87,10 @@ class MainModelImpl {
     using SequenceIdxView = ModelType::SequenceIdxView;
     using OwnedUpdateDataset = ModelType::OwnedUpdateDataset;
     using ComponentFlags = ModelType::ComponentFlags;
+    using MultiThreadedLogger = common::logging::MultiThreadedLogger;
+
+    // minimum number of components in a construction stage to construct its component types concurrently
+    static constexpr Idx parallel_construction_threshold = 10000;
 
   public:
     using ImplType = ModelType;
@@ -89,12 +99,13 @@ class MainModelImpl {
 
     // constructor with data
     explicit MainModelImpl(double system_frequency, ConstDataset const& input_data,
-                           SolverPreparationContext solver_preparation_context, Idx pos = 0)
+                           SolverPreparationContext solver_preparation_context, Idx pos = 0,
+                           Idx threading = Options::sequential)
         : system_frequency_{system_frequency},
           meta_data_{&input_data.meta_data()},
           solver_preparation_context_{std::move(solver_preparation_context)} {
         assert(input_data.get_description().dataset->name == std::string_view("input"));
-        add_components(input_data, pos);
+        add_components(input_data, pos, threading);
         set_construction_complete();
     }
 
@@ -113,23 +124,118 @@ class MainModelImpl {
     }
 
   private:
-    // template to construct components
-    // using forward interators
-    // different selection based on component type
-    template <std::derived_from<Base> CompType, non_owning_view_c Inputs> void add_component(Inputs components) {
+    // call func with the (columnar or row based) input span of the component type
+    template <std::derived_from<Base> CompType, typename Func>
+    static decltype(auto) visit_input_span(ConstDataset const& input_data, Idx pos, Func const& func) {
+        if (input_data.is_columnar(CompType::name)) {
+            return func(input_data.get_columnar_buffer_span<meta_data::input_getter_s, CompType>(pos));
+        }
+        return func(input_data.get_buffer_span<meta_data::input_getter_s, CompType>(pos));
+    }
+
+    // resolve the node references of the components of which the ids are registered in advance
+    template <std::derived_from<Base> CompType>
+    std::vector<Idx2D> resolve_node_references(ConstDataset const& input_data, Idx pos, Idx n_thread) const {
+        return visit_input_span<CompType>(input_data, pos, [this, n_thread](auto inputs) {
+            return main_core::resolve_node_references<CompType>(state_.components, inputs, n_thread);
+        });
+    }
+
+    // construct the components of which the ids are registered in advance
+    template <std::derived_from<Base> CompType>
+    void add_registered_component(ConstDataset const& input_data, Idx pos, std::span<Idx2D const> node_idx) {
         assert(!construction_complete_);
-        main_core::add_component<CompType>(state_.components, components, system_frequency_);
+        visit_input_span<CompType>(input_data, pos, [this, node_idx](auto inputs) {
+            main_core::add_component<CompType, main_core::IdRegistration::in_advance>(state_.components, inputs,
+                                                                                    system_frequency_, node_idx);
+        });
     }
 
-    void add_components(ConstDataset const& input_data, Idx pos = 0) {
-        auto const add_func = [this, pos, &input_data]<typename CT>() {
-            if (input_data.is_columnar(CT::name)) {
-                this->add_component<CT>(input_data.get_columnar_buffer_span<meta_data::input_getter_s, CT>(pos));
-            } else {
-                this->add_component<CT>(input_data.get_buffer_span<meta_data::input_getter_s, CT>(pos));
+    // The ids of all components are registered first, so that conflicting ids are reported before invalid references
+    //    and the index is read-only during the construction of the components.
+    // The components are constructed in stages, see main_core::construction_stage_v. In a large stage, the node
+    //    references of each component type are resolved in bulk by threading threads (see JobDispatch::n_threads),
+    //    after which the component types are constructed concurrently, largest first.
+    // If the node references of a type cannot be resolved, its components look them up one by one, so that the first
+    //    failing type determines the exception, the same as in a sequential construction.
+    void add_components(ConstDataset const& input_data, Idx pos = 0, Idx threading = Options::sequential) {
+        using ResolveNodeReferencesFunc = std::vector<Idx2D> (MainModelImpl::*)(ConstDataset const&, Idx, Idx) const;
+        using AddRegisteredComponentFunc = void (MainModelImpl::*)(ConstDataset const&, Idx, std::span<Idx2D const>);
+
+        auto const n_components =
+            ModelType::run_functor_with_all_component_types_return_array([this, pos, &input_data]<typename CT>() {
+                return visit_input_span<CT>(input_data, pos, [this](auto inputs) {
+                    main_core::register_input_ids<CT>(state_.components, inputs);
+                    return static_cast<Idx>(std::ranges::size(inputs));
+                });
+            });
+        constexpr auto construction_stages = ModelType::run_functor_with_all_component_types_return_array(
+            []<typename CT>() { return main_core::construction_stage_v<CT>; });
+        auto const resolve_funcs = ModelType::run_functor_with_all_component_types_return_array(
+            []<typename CT>() -> ResolveNodeReferencesFunc { return &MainModelImpl::resolve_node_references<CT>; });
+        auto const add_funcs = ModelType::run_functor_with_all_component_types_return_array(
+            []<typename CT>() -> AddRegisteredComponentFunc { return &MainModelImpl::add_registered_component<CT>; });
+
+        for (Idx stage = 0; stage != main_core::n_construction_stages; ++stage) {
+            IdxVector stage_types;
+            Idx n_stage_components{};
+            for (Idx const type_idx : IdxRange{static_cast<Idx>(ModelType::n_types)}) {
+                if (construction_stages[type_idx] == stage && n_components[type_idx] > 0) {
+                    stage_types.push_back(type_idx);
+                    n_stage_components += n_components[type_idx];
+                }
+            }
+            Idx const n_thread = n_stage_components < parallel_construction_threshold
+                                     ? 1
+                                     : JobDispatch::n_threads(n_stage_components, threading);
+            if (n_thread <= 1) {
+                for (Idx const type_idx : stage_types) {
+                    (this->*add_funcs[type_idx])(input_data, pos, {});
+                }
+                continue;
+            }
+
+            std::array<std::vector<Idx2D>, ModelType::n_types> node_idx{};
+            for (Idx const type_idx : stage_types) {
+                try {
+                    node_idx[type_idx] = (this->*resolve_funcs[type_idx])(input_data, pos, n_thread);
+                } catch (IDNotFound const&) {
+                    // reported by the construction of the type
+                }
             }
-        };
-        ModelType::run_functor_with_all_component_types_return_void(add_func);
+
+            IdxVector construction_order = stage_types;
+            std::ranges::stable_sort(construction_order, std::ranges::greater{},
+                                     [&n_components](Idx type_idx) { return n_components[type_idx]; });
+            std::array<std::exception_ptr, ModelType::n_types> type_exceptions{};
+            std::atomic<Idx> next_position{0};
+
+            auto const construct_types = [&]() {
+                for (Idx position = next_position.fetch_add(1, std::memory_order_relaxed);
+                     position < std::ssize(construction_order);
+                     position = next_position.fetch_add(1, std::memory_order_relaxed)) {
+                    Idx const type_idx = construction_order[position];
+                    try {
+                        (this->*add_funcs[type_idx])(input_data, pos, node_idx[type_idx]);
+                    } catch (...) { // NOSONAR(S2738)
+                        type_exceptions[type_idx] = std::current_exception();
+                    }
+                }
+            };
+            Idx const n_type_thread = std::min(n_thread, std::ssize(construction_order));
+            {
+                std::vector<std::jthread> threads;
+                threads.reserve(n_type_thread);
+                for (Idx thread_number = 0; thread_number < n_type_thread; ++thread_number) {
+                    threads.emplace_back(construct_types);
+                }
+            } // join all threads
+
+            if (auto const failed = std::ranges::find_if(type_exceptions, [](auto const& ex) { return ex != nullptr; });
+                failed != type_exceptions.end()) {
+                std::rethrow_exception(*failed);
+            }
+        }
     }
 
     // template to update components
@@ -149,9 +255,21 @@ class MainModelImpl {
                 sequence_idx);
         }
 
-        UpdateChange const changed = main_core::update::update_component<CompType>(
-            state_.components, updates,
-            std::back_inserter(std::get<comp_index>(solvers_cache_status_.changed_components_indices())), sequence_idx);
+        UpdateChange changed{};
+        try {
+            changed = main_core::update::update_component<CompType>(
+                state_.components, updates,
+                std::back_inserter(std::get<comp_index>(solvers_cache_status_.changed_components_indices())),
+                sequence_idx);
+        } catch (...) {
+            // the components may be updated partially, so the updated components are unknown
+            main_core::clear(state_.columns);
+            calculation_input_cache_.request_full_refresh();
+            throw;
+        }
+        main_core::update_component_columns<CompType>(state_.components, sequence_idx, state_.columns);
+        calculation_input_cache_.template record_updated_components<comp_index>(
+            sequence_idx, state_.components.template size<CompType>());
 
         // update, get changed variable
         solvers_cache_status_.update(changed);
@@ -167,8 +285,20 @@ class MainModelImpl {
         assert(update_data.get_description().dataset->name == std::string_view("update"));
 
         if (update_data.is_columnar(CompType::name)) {
-            this->update_component<CompType, CacheType>(
-                update_data.get_columnar_buffer_span<meta_data::update_getter_s, CompType>(pos), sequence_idx);
+            using UpdateType = typename CompType::UpdateType;
+
+            // the columns are copied to rows column by column, so that the attribute types are resolved per column
+            //    instead of per element
+            // all rows are gathered before updating, so that a cached update stores the inverse of the whole span
+            //    before any of the components is changed
+            // the other attributes of the rows stay not-available
+            // the rows are kept between the scenarios, so that they are only allocated once per batch calculation
+            auto const columnar_updates =
+                update_data.get_columnar_buffer_span<meta_data::update_getter_s, CompType>(pos);
+            auto& rows = std::get<ModelType::template index_of_component<CompType>>(columnar_update_rows_);
+            rows.assign(columnar_updates.size(), UpdateType{});
+            columnar_updates.gather(rows);
+            this->update_component<CompType, CacheType>(std::span<UpdateType const>{rows}, sequence_idx);
         } else {
             this->update_component<CompType, CacheType>(
                 update_data.get_buffer_span<meta_data::update_getter_s, CompType>(pos), sequence_idx);
@@ -219,14 +349,27 @@ class MainModelImpl {
         auto const get_index_func = [&components = this->state_.components, component_type, id_begin, size,
                                      indexer_begin]<typename CT>() {
             if (component_type == CT::name) {
-                std::transform(id_begin, id_begin + size, indexer_begin, [&components](ID id) {
-                    return main_core::get_component_idx_by_id<CT>(components, id).pos;
-                });
+                std::vector<Idx2D> indexer(size);
+                std::span<ID const> const ids{id_begin, static_cast<size_t>(size)};
+                main_core::get_component_idx_by_id<CT>(components, ids, indexer.begin());
+                std::ranges::transform(indexer, indexer_begin, &Idx2D::pos);
             }
         };
         ModelType::run_functor_with_all_component_types_return_void(get_index_func);
     }
 
+    // save the built topology to a snapshot sink, building it first if needed
+    template <typename Sink> void save_topology_snapshot(Sink& sink) {
+        assert(construction_complete_);
+        detail::save_topology_snapshot(state_, solver_preparation_context_, solvers_cache_status_, sink);
+    }
+
+    // restore the topology saved by save_topology_snapshot of a model with the same components
+    void load_topology_snapshot(std::span<char const> snapshot) {
+        assert(construction_complete_);
+        detail::load_topology_snapshot(state_, solver_preparation_context_, solvers_cache_status_, snapshot);
+    }
+
   private:
     // Entry point for main_model.hpp
     SequenceIdx get_all_sequence_idx_map(ConstDataset const& update_data) {
@@ -275,24 +418,30 @@ class MainModelImpl {
         });
     }
 
-    template <typename MathSolverType, typename YBus, typename PrepareInputFn, typename SolveFn>
+    template <typename MathSolverType, typename YBus, typename PrepareInputFn, typename SolveFn,
+              std::derived_from<Logger> LoggerType>
         requires std::invocable<std::remove_cvref_t<PrepareInputFn>, Idx /*n_math_solvers*/> &&
-                 std::ranges::range<std::invoke_result_t<PrepareInputFn, Idx /*n_math_solvers*/>> &&
-                 std::invocable<
-                     std::remove_cvref_t<SolveFn>, MathSolverType&, YBus const&,
-                     typename std::invoke_result_t<PrepareInputFn, Idx /*n_math_solvers*/>::const_reference> &&
+                 std::ranges::range<std::remove_cvref_t<std::invoke_result_t<PrepareInputFn, Idx /*n_math_solvers*/>>> &&
+                 std::invocable<std::remove_cvref_t<SolveFn>, MathSolverType&, YBus const&,
+                                typename std::remove_cvref_t<
+                                    std::invoke_result_t<PrepareInputFn, Idx /*n_math_solvers*/>>::const_reference,
+                                Logger&> &&
                  solver_output_type<std::invoke_result_t<
                      SolveFn, MathSolverType&, YBus const&,
-                     typename std::invoke_result_t<PrepareInputFn, Idx /*n_math_solvers*/>::const_reference>>
-
-    auto calculate_(PrepareInputFn prepare_input, SolveFn solve, Logger& logger) {
-        using InputType = std::invoke_result_t<PrepareInputFn, Idx /*n_math_solvers*/>::const_reference;
-        using SolverOutputType = std::invoke_result_t<SolveFn, MathSolverType&, YBus const&, InputType>;
+                     typename std::remove_cvref_t<
+                         std::invoke_result_t<PrepareInputFn, Idx /*n_math_solvers*/>>::const_reference,
+                     Logger&>>
+
+    auto calculate_(PrepareInputFn prepare_input, SolveFn solve, Idx threading, LoggerType& logger) {
+        using InputType =
+            std::remove_cvref_t<std::invoke_result_t<PrepareInputFn, Idx /*n_math_solvers*/>>::const_reference;
+        using SolverOutputType = std::invoke_result_t<SolveFn, MathSolverType&, YBus const&, InputType, Logger&>;
         using sym = decode_symmetry_v<SolverOutputType>;
 
         assert(construction_complete_);
         // prepare
-        auto const& input = [this, &logger, prepare_input_ = prepare_input] {
+        // the input is either a reference to the cached input or a temporary bound to the reference
+        auto const& input = [this, &logger, prepare_input_ = prepare_input]() -> decltype(auto) {
             Timer const timer{logger, LogEvent::prepare};
             assert(construction_complete_);
             prepare_solvers<sym>(state_, solver_preparation_context_, solvers_cache_status_);
@@ -301,22 +450,86 @@ class MainModelImpl {
             return prepare_input_(get_n_math_solvers<ModelType>(state_));
         }();
         // calculate
-        return [this, &logger, &input, &solve_ = solve] {
+        return [this, &logger, &input, &solve_ = solve, threading] {
             Timer const timer{logger, LogEvent::math_calculation};
             auto& solvers = main_core::get_solvers<sym>(solver_preparation_context_.math_state);
             auto& y_bus_vec = main_core::get_y_bus<sym>(solver_preparation_context_.math_state);
+            Idx const n_math_solvers = get_n_math_solvers<ModelType>(state_);
+            // the subgrids are only solved in parallel if each thread can log into a child of the logger
+            Idx const n_thread = std::derived_from<LoggerType, MultiThreadedLogger>
+                                     ? JobDispatch::n_threads(n_math_solvers, threading)
+                                     : Idx{1};
+            // the threads are spent on the subgrids if there are multiple, otherwise on the sparse LU solver
+            Idx const n_sparse_lu_thread =
+                n_thread > 1 ? 1 : JobDispatch::n_threads(std::numeric_limits<Idx>::max(), threading);
+            for (auto& y_bus : y_bus_vec) {
+                y_bus.set_sparse_lu_threads(n_sparse_lu_thread, sparse_lu_level_threads_);
+            }
+            if constexpr (std::derived_from<LoggerType, MultiThreadedLogger>) {
+                if (n_thread > 1) {
+                    return this->template solve_math_solvers_parallel<SolverOutputType>(solvers, y_bus_vec, input,
+                                                                                        solve_, n_thread, logger);
+                }
+            }
             std::vector<SolverOutputType> solver_output;
-            solver_output.reserve(get_n_math_solvers<ModelType>(state_));
-            for (Idx i = 0; i != get_n_math_solvers<ModelType>(state_); ++i) {
-                solver_output.emplace_back(solve_(solvers[i], y_bus_vec[i], input[i]));
+            solver_output.reserve(n_math_solvers);
+            for (Idx i = 0; i != n_math_solvers; ++i) {
+                solver_output.emplace_back(solve_(solvers[i], y_bus_vec[i], input[i], logger));
             }
             return solver_output;
         }();
     }
 
+    // Solve the electrically isolated subgrids (one math solver each) concurrently.
+    // Subgrids are handed out largest first (by bus count) from a shared counter to balance the load over the threads.
+    // Each thread logs into its own child of the logger, which is synchronized into the logger when the thread is done.
+    // The output order is the subgrid order and the first failing subgrid determines the exception, as if sequential.
+    template <typename SolverOutputType, typename Solvers, typename YBusVec, typename Input, typename SolveFn>
+    std::vector<SolverOutputType> solve_math_solvers_parallel(Solvers& solvers, YBusVec const& y_bus_vec,
+                                                              Input const& input, SolveFn const& solve, Idx n_thread,
+                                                              MultiThreadedLogger& logger) const {
+        Idx const n_math_solvers = get_n_math_solvers<ModelType>(state_);
+
+        IdxVector solve_order(n_math_solvers);
+        std::ranges::copy(IdxRange{n_math_solvers}, solve_order.begin());
+        std::ranges::stable_sort(solve_order, std::ranges::greater{}, [this](Idx math_model_idx) {
+            return state_.math_topology[math_model_idx]->n_bus();
+        });
+
+        std::vector<SolverOutputType> solver_output(n_math_solvers);
+        std::vector<std::exception_ptr> subgrid_exceptions(n_math_solvers);
+        std::atomic<Idx> next_position{0};
+
+        auto const solve_subgrids = [&]() {
+            auto const thread_log = logger.create_child();
+            for (Idx position = next_position.fetch_add(1, std::memory_order_relaxed); position < n_math_solvers;
+                 position = next_position.fetch_add(1, std::memory_order_relaxed)) {
+                Idx const i = solve_order[position];
+                try {
+                    solver_output[i] = solve(solvers[i], y_bus_vec[i], input[i], *thread_log);
+                } catch (...) { // NOSONAR(S2738)
+                    subgrid_exceptions[i] = std::current_exception();
+                }
+            }
+        };
+        {
+            std::vector<std::jthread> threads;
+            threads.reserve(n_thread);
+            for (Idx thread_number = 0; thread_number < n_thread; ++thread_number) {
+                threads.emplace_back(solve_subgrids);
+            }
+        } // join all threads
+
+        if (auto const failed = std::ranges::find_if(subgrid_exceptions, [](auto const& ex) { return ex != nullptr; });
+            failed != subgrid_exceptions.end()) {
+            std::rethrow_exception(*failed);
+        }
+        return solver_output;
+    }
+
     // Calculate with optimization, e.g., automatic tap changer
-    template <calculation_type_tag calculation_type, symmetry_tag sym>
-    auto calculate_with_optimizer(Options const& options, bool cache_run, Logger& logger) {
+    template <calculation_type_tag calculation_type, symmetry_tag sym, std::derived_from<Logger> LoggerType>
+    auto calculate_with_optimizer(Options const& options, bool cache_run, LoggerType& logger) {
         auto const get_calculator = [this, &options, cache_run, &logger] {
             using Calc = Calculator<calculation_type, sym>;
 
@@ -329,8 +542,8 @@ class MainModelImpl {
                 assert(&state == &state_);
 
                 return calculate_<MathSolverProxy<sym>, YBus<sym>>(
-                    Calc::preparer(state, mutable_comp_coup, options),
-                    Calc::solver(calculation_method, options, cache_run, logger), logger);
+                    Calc::preparer(state, mutable_comp_coup, calculation_input_cache_, options),
+                    Calc::solver(calculation_method, options, cache_run), options.threading, logger);
             };
         };
 
@@ -347,8 +560,41 @@ class MainModelImpl {
             ->optimize(state_, options.calculation_method);
     }
 
+    // The branch and shunt flows are only calculated if they are needed for the requested results, i.e.,
+    //    for the output of the branches or shunts themselves or of the sensors that can measure them.
+    // The optimizer always needs the branch flows, e.g., for the line drop compensation of the tap regulators.
+    SolverOutputRequest get_solver_output_request(Options const& options, MutableDataset const& result_data) const {
+        SolverOutputRequest request{.branch_flow = options.optimizer_type != OptimizerType::no_optimization,
+                                    .shunt_flow = false};
+        ModelType::run_functor_with_all_component_types_return_void([this, &result_data, &request]<typename CT>() {
+            if (state_.components.template size<CT>() == 0 ||
+                result_data.find_component(CT::name, false) == main_core::utils::invalid_index) {
+                return;
+            }
+            constexpr bool is_power_sensor = std::derived_from<CT, GenericPowerSensor>;
+            if constexpr (std::derived_from<CT, Branch> || std::derived_from<CT, Branch3> || is_power_sensor ||
+                          std::derived_from<CT, GenericCurrentSensor>) {
+                request.branch_flow = true;
+            }
+            if constexpr (std::derived_from<CT, Shunt> || is_power_sensor) {
+                request.shunt_flow = true;
+            }
+        });
+        return request;
+    }
+
+    // the ordering is part of the math topology, which is rebuilt if another ordering is requested
+    void set_sparse_ordering(SparseOrderingMethod sparse_ordering) {
+        if (sparse_ordering != solver_preparation_context_.sparse_ordering_method) {
+            solver_preparation_context_.sparse_ordering_method = sparse_ordering;
+            solvers_cache_status_.set_topology_status(false);
+        }
+    }
+
     // Single calculation, propagating the results to result_data
-    void calculate(Options options, bool cache_run, MutableDataset const& result_data, Logger& logger) {
+    // the subgrids are solved in parallel if the logger is multi-threaded, see calculate_
+    template <std::derived_from<Logger> LoggerType>
+    void calculate(Options options, bool cache_run, MutableDataset const& result_data, LoggerType& logger) {
         assert(construction_complete_);
 
         if (options.calculation_type == CalculationType::short_circuit) {
@@ -365,21 +611,152 @@ class MainModelImpl {
             throw InvalidCalculationMethod{};
         }
 
+        options.solver_output_request = get_solver_output_request(options, result_data);
+        set_sparse_ordering(options.sparse_ordering);
+
         calculation_type_symmetry_func_selector(
             options.calculation_type, options.calculation_symmetry,
             [cache_run]<calculation_type_tag calculation_type, symmetry_tag sym>(
                 MainModelImpl& main_model_, Options const& options_, MutableDataset const& result_data_,
-                Logger& logger) {
-                main_model_.output_result(
-                    main_model_.calculate_with_optimizer<calculation_type, sym>(options_, cache_run, logger),
-                    result_data_, logger);
+                LoggerType& logger) {
+                auto math_output =
+                    main_model_.calculate_with_optimizer<calculation_type, sym>(options_, cache_run, logger);
+                if (!options_.observability_check_only) {
+                    main_model_.output_result(math_output, result_data_, logger);
+                }
             },
             *this, options, result_data, logger);
     }
 
+    template <symmetry_tag sym>
+    void calculate_short_circuit_sweep_(Options const& options, MutableDataset const& result_data, Logger& logger) {
+        Idx const n_faults = state_.components.template size<Fault>();
+
+        auto const input = [this, &options, &logger] {
+            Timer const timer{logger, LogEvent::prepare};
+            prepare_solvers<sym>(state_, solver_preparation_context_, solvers_cache_status_);
+            return main_core::prepare_short_circuit_input<sym>(state_, state_.comp_coup,
+                                                               get_n_math_solvers<ModelType>(state_),
+                                                               options.short_circuit_voltage_scaling);
+        }();
+        Idx const n_math_solvers = get_n_math_solvers<ModelType>(state_);
+        auto& solvers = main_core::get_solvers<sym>(solver_preparation_context_.math_state);
+        auto& y_bus_vec = main_core::get_y_bus<sym>(solver_preparation_context_.math_state);
+
+        // the subgrids are swept one after the other, so the threads are spent on the sparse LU solver
+        Idx const n_sparse_lu_thread = JobDispatch::n_threads(std::numeric_limits<Idx>::max(), options.threading);
+        for (auto& y_bus : y_bus_vec) {
+            y_bus.set_sparse_lu_threads(n_sparse_lu_thread, sparse_lu_level_threads_);
+        }
+
+        // the output without any fault, the subgrids without the fault of a scenario keep this output
+        MathOutput<std::vector<ShortCircuitSolverOutput<sym>>> math_output;
+        {
+            Timer const timer{logger, LogEvent::math_calculation};
+            math_output.solver_output.reserve(n_math_solvers);
+            for (Idx math_model_idx = 0; math_model_idx != n_math_solvers; ++math_model_idx) {
+                math_output.solver_output.emplace_back(solvers[math_model_idx].get().prepare_short_circuit_sweep(
+                    input[math_model_idx], logger, options.calculation_method, y_bus_vec[math_model_idx],
+                    options.solver_output_request));
+                math_output.solver_output.back().fault.resize(input[math_model_idx].faults.size());
+            }
+        }
+
+        // scenario of each fault in each subgrid
+        std::vector<IdxVector> fault_scenarios(n_math_solvers);
+        for (Idx math_model_idx = 0; math_model_idx != n_math_solvers; ++math_model_idx) {
+            fault_scenarios[math_model_idx].resize(input[math_model_idx].faults.size());
+        }
+        for (Idx const fault_idx : IdxRange{n_faults}) {
+            Idx2D const math_idx = state_.comp_coup.fault[fault_idx];
+            if (math_idx.group != main_core::isolated_component) {
+                fault_scenarios[math_idx.group][math_idx.pos] = fault_idx;
+            }
+        }
+
+        // in each scenario, only the fault of that scenario is coupled, so that the others are output as inactive
+        constexpr Idx2D uncoupled{.group = main_core::isolated_component, .pos = main_core::not_connected};
+        std::vector<Idx2D> const fault_coup =
+            std::exchange(state_.comp_coup.fault, std::vector<Idx2D>(n_faults, uncoupled));
+        auto const write_scenario = [this, &math_output, &result_data, &fault_coup, &logger](Idx scenario) {
+            state_.comp_coup.fault[scenario] = fault_coup[scenario];
+            math_output.supernode_output.clear();
+            output_result(math_output, result_data.get_individual_scenario(scenario), logger);
+            state_.comp_coup.fault[scenario] = uncoupled;
+        };
+
+        try {
+            // the output of a subgrid only changes while its own faults are swept, and is restored afterwards
+            for (Idx math_model_idx = 0; math_model_idx != n_math_solvers; ++math_model_idx) {
+                auto& subgrid_output = math_output.solver_output[math_model_idx];
+                ShortCircuitSolverOutput<sym> const pre_fault_output = subgrid_output;
+                solvers[math_model_idx].get().run_short_circuit_sweep(
+                    input[math_model_idx], y_bus_vec[math_model_idx], options.solver_output_request,
+                    [&subgrid_output, &write_scenario, &scenarios = fault_scenarios[math_model_idx]](
+                        Idx fault_number, ShortCircuitSolverOutput<sym> const& fault_output) {
+                        subgrid_output.u_bus = fault_output.u_bus;
+                        subgrid_output.branch = fault_output.branch;
+                        subgrid_output.source = fault_output.source;
+                        subgrid_output.shunt = fault_output.shunt;
+                        subgrid_output.fault[fault_number] = fault_output.fault.front();
+                        write_scenario(scenarios[fault_number]);
+                    });
+                subgrid_output.u_bus = pre_fault_output.u_bus;
+                subgrid_output.branch = pre_fault_output.branch;
+                subgrid_output.source = pre_fault_output.source;
+                subgrid_output.shunt = pre_fault_output.shunt;
+            }
+
+            // the faults that are not active or not connected do not change the output
+            for (Idx const scenario : IdxRange{n_faults}) {
+                if (fault_coup[scenario].group == main_core::isolated_component) {
+                    write_scenario(scenario);
+                }
+            }
+        } catch (...) {
+            state_.comp_coup.fault = fault_coup;
+            throw;
+        }
+        state_.comp_coup.fault = fault_coup;
+    }
+
   public:
+    // Short circuit sweep, e.g., a fault at every node, propagating the results to result_data
+    // Every fault of the model is a separate calculation, in which only that fault is active.
+    // The result data is a batch with one scenario per fault, in the order of the faults in the input data.
+    // Faults that are not active in the model are not swept: their scenario is the calculation without faults.
+    // Instead of factorizing the faulted network per fault, the network without faults is factorized once per subgrid.
+    // The calculation type and symmetry of the options are ignored: the calculation is symmetric if all faults are
+    //    three phase faults, and asymmetric otherwise.
+    void calculate_short_circuit_sweep(Options options, MutableDataset const& result_data, Logger& logger) {
+        assert(construction_complete_);
+
+        if (!result_data.is_batch() || result_data.batch_size() != state_.components.template size<Fault>()) {
+            throw DatasetError{"The result data of a short circuit sweep should be a batch with one scenario per "
+                               "fault!\n"};
+        }
+
+        options.calculation_type = CalculationType::short_circuit;
+        auto const faults = state_.components.template citer<Fault>();
+        auto const is_three_phase = std::ranges::all_of(
+            faults, [](Fault const& fault) { return fault.get_fault_type() == FaultType::three_phase; });
+        options.calculation_symmetry =
+            is_three_phase ? CalculationSymmetry::symmetric : CalculationSymmetry::asymmetric;
+        options.solver_output_request = get_solver_output_request(options, result_data);
+        set_sparse_ordering(options.sparse_ordering);
+
+        calculation_symmetry_func_selector(
+            options.calculation_symmetry,
+            []<symmetry_tag sym>(MainModelImpl& main_model_, Options const& options_,
+                                 MutableDataset const& result_data_, Logger& logger_) {
+                main_model_.calculate_short_circuit_sweep_<sym>(options_, result_data_, logger_);
+            },
+            *this, options, result_data, logger);
+    }
+
+    template <std::derived_from<Logger> LoggerType>
     static auto calculator(Options const& options, MainModelImpl& model, MutableDataset const& target_data,
-                           bool cache_run, Logger& logger) {
+                           bool cache_run, LoggerType& logger) {
         auto sub_opt = options; // copy
         sub_opt.err_tol = cache_run ? std::numeric_limits<double>::max() : options.err_tol;
         sub_opt.max_iter = cache_run ? 1 : options.max_iter;
@@ -439,7 +816,7 @@ class MainModelImpl {
 
   private:
     template <solver_output_type SolverOutputType>
-    void output_result(MathOutput<std::vector<SolverOutputType>> math_output, MutableDataset const& result_data,
+    void output_result(MathOutput<std::vector<SolverOutputType>>& math_output, MutableDataset const& result_data,
                        Logger& logger) const {
         assert(!result_data.is_batch());
 
@@ -448,12 +825,22 @@ class MainModelImpl {
         main_core::solve_topological_nodes(state_, math_output);
 
         auto const output_func = [this, &math_output, &result_data]<typename CT>() {
-            result_data.for_each_component<typename output_type_getter<SolverOutputType>::type, CT>(
+            using OutputGetter = typename output_type_getter<SolverOutputType>::type;
+            using OutputType = typename OutputGetter::template type<CT>;
+
+            result_data.for_each_component<OutputGetter, CT>(
                 [this, &math_output](auto const& span) {
                     if (std::empty(span)) {
                         return;
                     }
-                    main_core::output_result<CT>(state_, math_output, span);
+                    if constexpr (std::ranges::contiguous_range<decltype(span)>) {
+                        main_core::output_result<CT>(state_, math_output, span);
+                    } else {
+                        // columnar buffers are written column-wise from the rows
+                        std::vector<OutputType> rows(std::size(span));
+                        main_core::output_result<CT>(state_, math_output, rows);
+                        span.scatter(rows);
+                    }
                 });
         };
 
@@ -468,9 +855,14 @@ class MainModelImpl {
     SolverPreparationContext solver_preparation_context_;
 
     SolversCacheStatus<ImplType> solvers_cache_status_{};
+    CalculationInputCache<ImplType> calculation_input_cache_{};
 
     OwnedUpdateDataset cached_inverse_update_{};
     UpdateChange cached_state_changes_{};
+    // scratch rows of the columnar updates
+    OwnedUpdateDataset columnar_update_rows_{};
+    // shared by the sparse LU solvers of all subgrids, the subgrids that use them are solved one after the other
+    math_solver::SparseLULevelThreads sparse_lu_level_threads_{};
 #ifndef NDEBUG
     // construction_complete is used for debug assertions only
     bool construction_complete_{false};
@@ -84,7 +84,7 @@ inline void calculate_multiple_source_result(IdxRange const& sources, YBus<symme
                                              PowerFlowInput<symmetric_t> const& input,
                                              ComplexValue<symmetric_t> const& i_inj_t,
                                              SolverOutput<symmetric_t>& output, Idx const& bus_number) {
-    std::vector<SourceCalcParam> const y_ref = y_bus.math_model_param().source_param;
+    std::vector<SourceCalcParam> const& y_ref = y_bus.math_model_param().source_param;
     DoubleComplex const y_ref_t = std::transform_reduce(sources.begin(), sources.end(), DoubleComplex{}, std::plus{},
                                                         [&](Idx const source) { return y_ref[source].y1; });
 
@@ -111,7 +111,7 @@ inline void calculate_multiple_source_result(IdxRange const& sources, YBus<asymm
                                              PowerFlowInput<asymmetric_t> const& input,
                                              ComplexValue<asymmetric_t> const& i_inj_t,
                                              SolverOutput<asymmetric_t>& output, Idx const& bus_number) {
-    std::vector<SourceCalcParam> const y_ref_012 = y_bus.math_model_param().source_param;
+    std::vector<SourceCalcParam> const& y_ref_012 = y_bus.math_model_param().source_param;
     ComplexValue<asymmetric_t> const y_ref_t_012 = std::transform_reduce(
         sources.begin(), sources.end(), ComplexValue<asymmetric_t>{}, std::plus{}, [&](Idx const source) {
             ComplexValue<asymmetric_t> y_012;
@@ -408,26 +408,39 @@ inline void calculate_load_gen_result(IdxRange const& load_gens, Idx bus_number,
     }
 }
 
+// calculate the requested branch and shunt flows from the bus voltages
+template <symmetry_tag sym, solver_output_type SolverOutputType>
+inline void calculate_flow_result(YBus<sym> const& y_bus, ComplexValueVector<sym> const& u, SolverOutputType& output,
+                                  SolverOutputRequest const& output_request) {
+    using BranchOutputType = typename decltype(output.branch)::value_type;
+    using ShuntOutputType = typename decltype(output.shunt)::value_type;
+
+    if (output_request.branch_flow) {
+        output.branch = y_bus.template calculate_branch_flow<BranchOutputType>(u);
+    }
+    if (output_request.shunt_flow) {
+        output.shunt = y_bus.template calculate_shunt_flow<ShuntOutputType>(u);
+    }
+}
+
 template <symmetry_tag sym, typename LoadGenFunc>
     requires std::invocable<std::remove_cvref_t<LoadGenFunc>, Idx> &&
              std::same_as<std::invoke_result_t<LoadGenFunc, Idx>, LoadGenType>
 inline void calculate_pf_result(YBus<sym> const& y_bus, PowerFlowInput<sym> const& input,
                                 grouped_idx_vector_type auto const& sources_per_bus,
                                 grouped_idx_vector_type auto const& load_gens_per_bus, SolverOutput<sym>& output,
-                                LoadGenFunc load_gen_func) {
+                                LoadGenFunc load_gen_func, SolverOutputRequest const& output_request) {
     assert(sources_per_bus.size() == load_gens_per_bus.size());
 
     auto const& voltage_regulators_per_load_gen = y_bus.math_topology().voltage_regulators_per_load_gen;
 
     // call y bus
-    output.branch = y_bus.template calculate_branch_flow<BranchSolverOutput<sym>>(output.u);
-    output.shunt = y_bus.template calculate_shunt_flow<ApplianceSolverOutput<sym>>(output.u);
+    calculate_flow_result(y_bus, output.u, output, output_request);
 
     // prepare source, load gen and node injection
     output.source.resize(sources_per_bus.element_size());
     output.load_gen.resize(load_gens_per_bus.element_size());
     output.voltage_regulator.resize(voltage_regulators_per_load_gen.element_size());
-    output.bus_injection.resize(sources_per_bus.size());
     output.bus_injection = y_bus.calculate_injection(output.u);
 
     std::map<Idx, Idx> loadgen_to_regulator; // save mapping from generator to its regulator
@@ -447,10 +460,9 @@ inline void calculate_pf_result(YBus<sym> const& y_bus, PowerFlowInput<sym> cons
 
 template <symmetry_tag sym>
 inline void calculate_se_result(YBus<sym> const& y_bus, MeasuredValues<sym> const& measured_value,
-                                SolverOutput<sym>& output) {
+                                SolverOutput<sym>& output, SolverOutputRequest const& output_request) {
     // call y bus
-    output.branch = y_bus.template calculate_branch_flow<BranchSolverOutput<sym>>(output.u);
-    output.shunt = y_bus.template calculate_shunt_flow<ApplianceSolverOutput<sym>>(output.u);
+    calculate_flow_result(y_bus, output.u, output, output_request);
     output.bus_injection = y_bus.calculate_injection(output.u);
     std::tie(output.load_gen, output.source) = measured_value.calculate_load_gen_source(output.u, output.bus_injection);
 }
@@ -30,7 +30,8 @@ Steps:
 
     Initialize solver:
         Source admittance is not included in Y bus matrix here. Include that to complete the Y bus matrix.
-        Invalidate prefactorization if parameters change, ie y bus values changes
+        Invalidate prefactorization if parameters change, ie the admittance version of the y bus changes
+        If only a few entries change, e.g., one branch is switched, only the affected part is refactorized
 
     Calculating Injected current:
         Initialize I_inj = 0
@@ -67,6 +68,7 @@ Nomenclature:
 #include <algorithm>
 #include <cmath>
 #include <complex>
+#include <cstdint>
 #include <memory>
 #include <vector>
 
@@ -89,37 +91,20 @@ class IterativeCurrentPFSolver : public IterativePFSolver<sym_type, IterativeCur
     IterativeCurrentPFSolver(YBus<sym> const& y_bus, MathModelTopology const& topo)
         : IterativePFSolver<sym, IterativeCurrentPFSolver>{y_bus, topo},
           rhs_u_(y_bus.size()),
-          sparse_solver_{y_bus.row_indptr_lu(), y_bus.col_indices_lu(), y_bus.lu_diag()} {}
+          sparse_solver_{y_bus.row_indptr_lu(), y_bus.col_indices_lu(), y_bus.lu_diag(), y_bus.lu_symbolic()} {}
 
     // Add source admittance to Y bus and set variable for prepared y bus to true
     void initialize_derived_solver(YBus<sym> const& y_bus, PowerFlowInput<sym> const& input,
                                    SolverOutput<sym>& output) {
         make_flat_start(input, output.u);
+        prefactorize_if_needed(y_bus);
+    }
 
-        auto const& sources_per_bus = this->sources_per_bus_.get();
-        IdxVector const& bus_entry = y_bus.lu_diag();
-        // if Y bus is not up to date
-        // re-build matrix and prefactorize Build y bus data with source admittance
-        if (parameters_changed_) {
-            ComplexTensorVector<sym> mat_data(y_bus.nnz_lu());
-            detail::copy_y_bus<sym>(y_bus, mat_data);
-
-            for (auto const& [bus_number, sources] : enumerated_zip_sequence(sources_per_bus)) {
-                Idx const data_sequence = bus_entry[bus_number];
-                for (auto source_number : sources) {
-                    // YBus_diag += Y_source // NOSONAR
-                    mat_data[data_sequence] +=
-                        y_bus.math_model_param().source_param[source_number].template y_ref<sym>();
-                }
-            }
-            // prefactorize
-            BlockPermArray perm(this->n_bus_);
-            sparse_solver_.prefactorize(mat_data, perm);
-            // move pre-factorized version into shared ptr
-            mat_data_ = std::make_shared<ComplexTensorVector<sym> const>(std::move(mat_data));
-            perm_ = std::make_shared<BlockPermArray const>(std::move(perm));
-        }
-        parameters_changed_ = false;
+    // Same as above, but starting from the voltages already present in the output,
+    // e.g., the converged solution of a previous calculation (warm start).
+    void initialize_derived_solver_from_voltage(YBus<sym> const& y_bus, PowerFlowInput<sym> const& /*input*/,
+                                                SolverOutput<sym>& /*output*/) {
+        prefactorize_if_needed(y_bus);
     }
 
     // Prepare matrix calculates injected current, i.e., RHS of solver for each iteration.
@@ -159,15 +144,75 @@ class IterativeCurrentPFSolver : public IterativePFSolver<sym_type, IterativeCur
         return max_dev;
     }
 
-    void parameters_changed(bool changed) { parameters_changed_ = parameters_changed_ || changed; }
-
   private:
     ComplexValueVector<sym> rhs_u_;
     std::shared_ptr<ComplexTensorVector<sym> const> mat_data_;
+    // matrix before prefactorization, to find the changed entries when the parameters change
+    ComplexTensorVector<sym> unfactorized_mat_data_;
     // sparse solver
     SparseSolverType sparse_solver_;
     std::shared_ptr<BlockPermArray const> perm_;
-    bool parameters_changed_ = true;
+    // the admittance version of the y bus of the prefactorization, see YBus::admittance_version
+    uint64_t prefactorized_admittance_version_{};
+
+    // if Y bus is not up to date, re-build matrix with source admittance and prefactorize
+    void prefactorize_if_needed(YBus<sym> const& y_bus) {
+        sparse_solver_.set_n_threads(y_bus.sparse_lu_threads(), y_bus.sparse_lu_level_threads());
+        auto const& sources_per_bus = this->sources_per_bus_.get();
+        IdxVector const& bus_entry = y_bus.lu_diag();
+        if (mat_data_ == nullptr || y_bus.admittance_version() != prefactorized_admittance_version_) {
+            ComplexTensorVector<sym> mat_data(y_bus.nnz_lu());
+            detail::copy_y_bus<sym>(y_bus, mat_data);
+
+            for (auto const& [bus_number, sources] : enumerated_zip_sequence(sources_per_bus)) {
+                Idx const data_sequence = bus_entry[bus_number];
+                for (auto source_number : sources) {
+                    // YBus_diag += Y_source // NOSONAR
+                    mat_data[data_sequence] +=
+                        y_bus.math_model_param().source_param[source_number].template y_ref<sym>();
+                }
+            }
+            if (mat_data_ != nullptr && unfactorized_mat_data_.size() == mat_data.size()) {
+                refactorize_changed_entries(std::move(mat_data));
+            } else {
+                // prefactorize
+                ComplexTensorVector<sym> unfactorized_mat_data = mat_data;
+                BlockPermArray perm(this->n_bus_);
+                sparse_solver_.prefactorize(mat_data, perm);
+                // move pre-factorized version into shared ptr
+                unfactorized_mat_data_ = std::move(unfactorized_mat_data);
+                mat_data_ = std::make_shared<ComplexTensorVector<sym> const>(std::move(mat_data));
+                perm_ = std::make_shared<BlockPermArray const>(std::move(perm));
+            }
+            prefactorized_admittance_version_ = y_bus.admittance_version();
+        }
+    }
+
+    // only refactorize the part of the matrix affected by the changed entries, e.g., of a switched branch
+    void refactorize_changed_entries(ComplexTensorVector<sym> mat_data) {
+        IdxVector changed_entries;
+        for (Idx const idx : IdxRange{std::ssize(mat_data)}) {
+            bool const changed = [&]() {
+                if constexpr (is_symmetric_v<sym>) {
+                    return mat_data[idx] != unfactorized_mat_data_[idx];
+                } else {
+                    return (mat_data[idx] != unfactorized_mat_data_[idx]).any();
+                }
+            }();
+            if (changed) {
+                changed_entries.push_back(idx);
+            }
+        }
+        if (changed_entries.empty()) {
+            return;
+        }
+        ComplexTensorVector<sym> lu_data = *mat_data_;
+        BlockPermArray perm = *perm_;
+        sparse_solver_.prefactorize_partial(mat_data, changed_entries, lu_data, perm);
+        unfactorized_mat_data_ = std::move(mat_data);
+        mat_data_ = std::make_shared<ComplexTensorVector<sym> const>(std::move(lu_data));
+        perm_ = std::make_shared<BlockPermArray const>(std::move(perm));
+    }
 
     void add_loads(IdxRange const& load_gens, Idx bus_number, PowerFlowInput<sym> const& input,
                    std::vector<LoadGenType> const& load_gen_type, ComplexValueVector<sym> const& u) {
@@ -90,12 +90,16 @@ template <symmetry_tag sym_type> class IterativeLinearSESolver {
         : n_bus_{y_bus.size()},
           math_topo_{topo},
           data_gain_(y_bus.nnz_lu()),
+          unfactorized_gain_(y_bus.nnz_lu()),
+          prefactorized_gain_(y_bus.nnz_lu()),
           x_rhs_(y_bus.size()),
-          sparse_solver_{y_bus.row_indptr_lu(), y_bus.col_indices_lu(), y_bus.lu_diag()},
+          sparse_solver_{y_bus.row_indptr_lu(), y_bus.col_indices_lu(), y_bus.lu_diag(), y_bus.lu_symbolic()},
           perm_(y_bus.size()) {}
 
     SolverOutput<sym> run_state_estimation(YBus<sym> const& y_bus, StateEstimationInput<sym> const& input,
-                                           double err_tol, Idx max_iter, Logger& log) {
+                                           double err_tol, Idx max_iter, Logger& log,
+                                           SolverOutputRequest const& output_request = {}) {
+        sparse_solver_.set_n_threads(y_bus.sparse_lu_threads(), y_bus.sparse_lu_level_threads());
         // prepare
         Timer main_timer;
         Timer sub_timer;
@@ -109,14 +113,14 @@ template <symmetry_tag sym_type> class IterativeLinearSESolver {
         // preprocess measured value
         sub_timer = Timer{log, LogEvent::preprocess_measured_value};
         MeasuredValues<sym> const measured_values{y_bus.math_topology(), input};
-        auto const observability_result =
-            observability::observability_check(measured_values, y_bus.math_topology(), y_bus.y_bus_structure());
+        auto const observability_result = observability_cache_.check(measured_values, y_bus.math_topology(),
+                                                                     y_bus.shared_y_bus_structure(), log);
 
         // prepare matrix
         sub_timer = Timer{log, LogEvent::prepare_matrix_including_prefactorization};
         prepare_matrix(y_bus, measured_values);
-        // prefactorize
-        sparse_solver_.prefactorize(data_gain_, perm_, observability_result.use_perturbation());
+        // prefactorize, if the gain matrix changed
+        prefactorize_if_needed(observability_result.use_perturbation(), log);
 
         // initialize voltage with initial angle
         sub_timer = Timer{log, LogEvent::initialize_voltages}; // TODO(mgovers): make scoped subtimers
@@ -143,7 +147,7 @@ template <symmetry_tag sym_type> class IterativeLinearSESolver {
 
         // calculate math result
         sub_timer = Timer{log, LogEvent::calculate_math_result};
-        detail::calculate_se_result<sym>(y_bus, measured_values, output);
+        detail::calculate_se_result<sym>(y_bus, measured_values, output, output_request);
 
         // Manually stop timers to avoid "Max number of iterations" to be included in the timing.
         sub_timer.stop();
@@ -171,16 +175,44 @@ template <symmetry_tag sym_type> class IterativeLinearSESolver {
 
     // data for gain matrix
     std::vector<ILSEGainBlock<sym>> data_gain_;
+    // gain matrix of this calculation before prefactorization
+    std::vector<ILSEGainBlock<sym>> unfactorized_gain_;
+    // gain matrix before prefactorization of which data_gain_ holds the prefactorization
+    // the gain matrix only depends on the y bus, the sensor availability and the variances, not the measured values
+    // so the prefactorization is reused when only the measured values change
+    std::vector<ILSEGainBlock<sym>> prefactorized_gain_;
+    bool is_prefactorized_{false};
+    bool prefactorized_with_perturbation_{false};
     // unknown and rhs
     std::vector<ILSERhs<sym>> x_rhs_;
     // solver
     SparseLUSolver<ILSEGainBlock<sym>, ILSERhs<sym>, ILSEUnknown<sym>> sparse_solver_;
     SparseLUSolver<ILSEGainBlock<sym>, ILSERhs<sym>, ILSEUnknown<sym>>::BlockPermArray perm_;
+    // observability of the recent sensor availabilities
+    observability::ObservabilityCache observability_cache_;
 
     static auto diagonal_inverse(RealValue<sym> const& value) {
         return ComplexDiagonalTensor<sym>{static_cast<ComplexValue<sym>>(RealValue<sym>{1.0} / value)};
     }
 
+    void prefactorize_if_needed(bool use_perturbation, Logger& log) {
+        if (is_prefactorized_ && use_perturbation == prefactorized_with_perturbation_ &&
+            std::ranges::equal(unfactorized_gain_, prefactorized_gain_,
+                               [](ILSEGainBlock<sym> const& lhs, ILSEGainBlock<sym> const& rhs) {
+                                   return (lhs == rhs).all();
+                               })) {
+            log.log(LogEvent::prefactorization_cache_hit, Idx{1});
+            return;
+        }
+        log.log(LogEvent::prefactorization_cache_miss, Idx{1});
+        is_prefactorized_ = false;
+        data_gain_ = unfactorized_gain_;
+        sparse_solver_.prefactorize(data_gain_, perm_, use_perturbation);
+        std::swap(prefactorized_gain_, unfactorized_gain_);
+        prefactorized_with_perturbation_ = use_perturbation;
+        is_prefactorized_ = true;
+    }
+
     void prepare_matrix(YBus<sym> const& y_bus, MeasuredValues<sym> const& measured_value) {
         MathModelParam<sym> const& param = y_bus.math_model_param();
         IdxVector const& row_indptr = y_bus.row_indptr_lu();
@@ -191,7 +223,7 @@ template <symmetry_tag sym_type> class IterativeLinearSESolver {
             for (Idx data_idx_lu = row_indptr[row]; data_idx_lu != row_indptr[row + 1]; ++data_idx_lu) {
                 Idx const col = col_indices[data_idx_lu];
                 // get a reference and reset block to zero
-                ILSEGainBlock<sym>& block = data_gain_[data_idx_lu];
+                ILSEGainBlock<sym>& block = unfactorized_gain_[data_idx_lu];
                 block.clear();
                 // get data idx of y bus,
                 // skip for a fill-in
@@ -285,7 +317,7 @@ template <symmetry_tag sym_type> class IterativeLinearSESolver {
                 continue;
             }
             Idx const data_idx_tranpose = y_bus.lu_transpose_entry()[data_idx_lu];
-            data_gain_[data_idx_lu].qh() = hermitian_transpose(data_gain_[data_idx_tranpose].q());
+            unfactorized_gain_[data_idx_lu].qh() = hermitian_transpose(unfactorized_gain_[data_idx_tranpose].q());
         }
     }
 
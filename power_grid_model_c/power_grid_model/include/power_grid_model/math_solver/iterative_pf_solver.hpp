@@ -27,51 +27,56 @@
 namespace power_grid_model::math_solver {
 
 // solver
+//
+// State ownership and batching safety:
+//    - the solver instance owns its scratch buffers (e.g., Jacobian, unknowns, right-hand side, permutation) and reuses
+//      them in place across runs; every run re-initializes all per-run state in initialize_derived_solver (or
+//      initialize_derived_solver_from_voltage) before reading it, so nothing leaks from a previous (failed) run
+//    - the only state that deliberately persists across runs are caches with explicit invalidation: the prefactorized
+//      matrix of the iterative current method (see YBus::admittance_version) and the warm start voltages
+//    - a solver instance is never run concurrently: every thread of a batch calculation works on its own copy of the
+//      model, including its math solvers, and the subgrids of a single calculation each have their own solver
 template <symmetry_tag sym, typename DerivedSolver> class IterativePFSolver {
   public:
     friend DerivedSolver;
     SolverOutput<sym> run_power_flow(YBus<sym> const& y_bus, PowerFlowInput<sym> const& input, double err_tol,
-                                     Idx max_iter, bool cache_run, Logger& log) {
-        // keep copy, as reference might break batching
-        auto derived_solver = static_cast<DerivedSolver&>(*this);
+                                     Idx max_iter, bool cache_run, Logger& log,
+                                     PowerFlowInitialization initialization = PowerFlowInitialization::cold_start,
+                                     SolverOutputRequest const& output_request = {}) {
+        // run in place, see the batching safety notes above
+        auto& derived_solver = static_cast<DerivedSolver&>(*this);
 
         // prepare
         SolverOutput<sym> output;
         output.u.resize(n_bus_);
-        double max_dev = std::numeric_limits<double>::infinity();
 
         Timer main_timer{log, LogEvent::math_solver};
 
-        // initialize
-        {
-            Timer const sub_timer{log, LogEvent::initialize_calculation};
-            // Further initialization specific to the derived solver
-            derived_solver.initialize_derived_solver(y_bus, input, output);
-        }
+        // warm start from the last converged solution of this solver instance, if any
+        // the solver instance is re-created on topology change, in which case there is no previous solution
+        bool const use_warm_start = initialization == PowerFlowInitialization::warm_start && has_warm_start();
 
         // start calculation
-        // iteration
         Idx num_iter = 0;
-        while (max_dev > err_tol || num_iter == 0) {
-            if (num_iter++ == max_iter) {
-                throw IterationDiverge{max_iter, max_dev, err_tol};
-            }
-            {
-                // Prepare the matrices of linear equations to be solved
-                Timer const sub_timer{log, LogEvent::prepare_matrices};
-                derived_solver.prepare_matrix_and_rhs(y_bus, input, output.u);
-            }
-            {
-                // Solve the linear equations
-                Timer const sub_timer{log, LogEvent::solve_sparse_linear_equation};
-                derived_solver.solve_matrix();
-            }
-            {
-                // Calculate maximum deviation of voltage at any bus
-                Timer const sub_timer{log, LogEvent::iterate_unknown};
-                max_dev = derived_solver.iterate_unknown(output.u, err_tol, cache_run);
+        if (use_warm_start) {
+            try {
+                initialize(derived_solver, y_bus, input, output, true, log);
+                num_iter = iterate(derived_solver, y_bus, input, output, err_tol, max_iter, cache_run, log);
+            } catch (IterationDiverge const&) {
+                num_iter = 0;
+            } catch (SparseMatrixError const&) {
+                num_iter = 0;
             }
         }
+        if (num_iter == 0) {
+            // cold start, also as fallback for a warm start that did not converge
+            clear_warm_start();
+            initialize(derived_solver, y_bus, input, output, false, log);
+            num_iter = iterate(derived_solver, y_bus, input, output, err_tol, max_iter, cache_run, log);
+        }
+        if (initialization == PowerFlowInitialization::warm_start) {
+            warm_start_u_ = output.u;
+        }
 
         // calculate math result
         {
@@ -79,7 +84,7 @@ template <symmetry_tag sym, typename DerivedSolver> class IterativePFSolver {
             if constexpr (requires { derived_solver.finalize_result(input, output); }) {
                 derived_solver.finalize_result(input, output);
             }
-            calculate_result(y_bus, input, output);
+            calculate_result(y_bus, input, output, output_request);
         }
         // Manually stop timers to avoid "Max number of iterations" to be included in the timing.
         main_timer.stop();
@@ -89,23 +94,71 @@ template <symmetry_tag sym, typename DerivedSolver> class IterativePFSolver {
         return output;
     }
 
-    void calculate_result(YBus<sym> const& y_bus, PowerFlowInput<sym> const& input, SolverOutput<sym>& output) {
-        detail::calculate_pf_result(y_bus, input, sources_per_bus_.get(), load_gens_per_bus_.get(), output,
-                                    [this](Idx i) { return (load_gen_type_.get())[i]; });
+    void calculate_result(YBus<sym> const& y_bus, PowerFlowInput<sym> const& input, SolverOutput<sym>& output,
+                          SolverOutputRequest const& output_request) {
+        detail::calculate_pf_result(
+            y_bus, input, sources_per_bus_.get(), load_gens_per_bus_.get(), output,
+            [this](Idx i) { return (load_gen_type_.get())[i]; }, output_request);
     }
 
+    bool has_warm_start() const { return std::ssize(warm_start_u_) == n_bus_; }
+    void clear_warm_start() { warm_start_u_.clear(); }
+
   private:
     Idx n_bus_;
     std::reference_wrapper<DoubleVector const> phase_shift_;
     std::reference_wrapper<SparseGroupedIdxVector const> load_gens_per_bus_;
     std::reference_wrapper<DenseGroupedIdxVector const> sources_per_bus_;
     std::reference_wrapper<std::vector<LoadGenType> const> load_gen_type_;
+    // converged voltages of the last warm-start enabled run, empty if not available
+    ComplexValueVector<sym> warm_start_u_;
     IterativePFSolver(YBus<sym> const& y_bus, MathModelTopology const& topo)
         : n_bus_{y_bus.size()},
           phase_shift_{std::cref(topo.phase_shift)},
           load_gens_per_bus_{std::cref(topo.load_gens_per_bus)},
           sources_per_bus_{std::cref(topo.sources_per_bus)},
           load_gen_type_{std::cref(topo.load_gen_type)} {}
+
+    void initialize(DerivedSolver& derived_solver, YBus<sym> const& y_bus, PowerFlowInput<sym> const& input,
+                    SolverOutput<sym>& output, bool warm_start, Logger& log) const {
+        Timer const sub_timer{log, LogEvent::initialize_calculation};
+        if (warm_start) {
+            output.u = warm_start_u_;
+            // Further initialization specific to the derived solver, starting from the given voltages
+            derived_solver.initialize_derived_solver_from_voltage(y_bus, input, output);
+        } else {
+            // Further initialization specific to the derived solver
+            derived_solver.initialize_derived_solver(y_bus, input, output);
+        }
+    }
+
+    // iterate until convergence, returns the number of iterations
+    static Idx iterate(DerivedSolver& derived_solver, YBus<sym> const& y_bus, PowerFlowInput<sym> const& input,
+                       SolverOutput<sym>& output, double err_tol, Idx max_iter, bool cache_run, Logger& log) {
+        double max_dev = std::numeric_limits<double>::infinity();
+        Idx num_iter = 0;
+        while (max_dev > err_tol || num_iter == 0) {
+            if (num_iter++ == max_iter) {
+                throw IterationDiverge{max_iter, max_dev, err_tol};
+            }
+            {
+                // Prepare the matrices of linear equations to be solved
+                Timer const sub_timer{log, LogEvent::prepare_matrices};
+                derived_solver.prepare_matrix_and_rhs(y_bus, input, output.u);
+            }
+            {
+                // Solve the linear equations
+                Timer const sub_timer{log, LogEvent::solve_sparse_linear_equation};
+                derived_solver.solve_matrix();
+            }
+            {
+                // Calculate maximum deviation of voltage at any bus
+                Timer const sub_timer{log, LogEvent::iterate_unknown};
+                max_dev = derived_solver.iterate_unknown(output.u, err_tol, cache_run);
+            }
+        }
+        return num_iter;
+    }
 };
 
 } // namespace power_grid_model::math_solver
@@ -61,10 +61,12 @@ template <symmetry_tag sym_type> class LinearPFSolver {
           load_gens_per_bus_{std::cref(topo.load_gens_per_bus)},
           sources_per_bus_{std::cref(topo.sources_per_bus)},
           mat_data_(y_bus.nnz_lu()),
-          sparse_solver_{y_bus.row_indptr_lu(), y_bus.col_indices_lu(), y_bus.lu_diag()},
+          sparse_solver_{y_bus.row_indptr_lu(), y_bus.col_indices_lu(), y_bus.lu_diag(), y_bus.lu_symbolic()},
           perm_(n_bus_) {}
 
-    SolverOutput<sym> run_power_flow(YBus<sym> const& y_bus, PowerFlowInput<sym> const& input, Logger& log) {
+    SolverOutput<sym> run_power_flow(YBus<sym> const& y_bus, PowerFlowInput<sym> const& input, Logger& log,
+                                     SolverOutputRequest const& output_request = {}) {
+        sparse_solver_.set_n_threads(y_bus.sparse_lu_threads(), y_bus.sparse_lu_level_threads());
         using enum LogEvent;
 
         // output
@@ -85,7 +87,7 @@ template <symmetry_tag sym_type> class LinearPFSolver {
 
         // calculate math result
         sub_timer = Timer{log, calculate_math_result};
-        calculate_result(y_bus, input, output);
+        calculate_result(y_bus, input, output, output_request);
 
         // output
         return output;
@@ -107,9 +109,11 @@ template <symmetry_tag sym_type> class LinearPFSolver {
                                               mat_data_);
     }
 
-    void calculate_result(YBus<sym> const& y_bus, PowerFlowInput<sym> const& input, SolverOutput<sym>& output) {
-        detail::calculate_pf_result(y_bus, input, sources_per_bus_.get(), load_gens_per_bus_.get(), output,
-                                    [](Idx /*i*/) { return LoadGenType::const_y; });
+    void calculate_result(YBus<sym> const& y_bus, PowerFlowInput<sym> const& input, SolverOutput<sym>& output,
+                          SolverOutputRequest const& output_request) {
+        detail::calculate_pf_result(
+            y_bus, input, sources_per_bus_.get(), load_gens_per_bus_.get(), output,
+            [](Idx /*i*/) { return LoadGenType::const_y; }, output_request);
     }
 };
 
@@ -8,8 +8,10 @@
 #include "iterative_linear_se_solver.hpp"
 #include "linear_pf_solver.hpp"
 #include "math_solver_dispatch.hpp"
+#include "measured_values.hpp"
 #include "newton_raphson_pf_solver.hpp"
 #include "newton_raphson_se_solver.hpp"
+#include "observability.hpp"
 #include "short_circuit_solver.hpp"
 #include "y_bus.hpp"
 
@@ -21,6 +23,8 @@
 #include "../common/timer.hpp"
 
 #include <algorithm>
+#include <cassert>
+#include <functional>
 #include <limits>
 #include <memory>
 #include <optional>
@@ -41,7 +45,9 @@ template <symmetry_tag sym> class MathSolver : public MathSolverBase<sym> {
     }
 
     SolverOutput<sym> run_power_flow(PowerFlowInput<sym> const& input, double err_tol, Idx max_iter, bool cache_run,
-                                     Logger& log, CalculationMethod calculation_method, YBus<sym> const& y_bus) final {
+                                     Logger& log, CalculationMethod calculation_method, YBus<sym> const& y_bus,
+                                     PowerFlowInitialization initialization,
+                                     SolverOutputRequest const& output_request) final {
         using enum CalculationMethod;
 
         // set method to always linear if all load_gens have const_y
@@ -51,51 +57,61 @@ template <symmetry_tag sym> class MathSolver : public MathSolverBase<sym> {
         case default_method:
             [[fallthrough]]; // use Newton-Raphson by default
         case newton_raphson:
-            return run_power_flow_newton_raphson(input, err_tol, max_iter, cache_run, log, y_bus);
+            return run_power_flow_newton_raphson(input, err_tol, max_iter, cache_run, log, y_bus, initialization,
+                                                 output_request);
         case linear:
-            return run_power_flow_linear(input, err_tol, max_iter, log, y_bus);
+            return run_power_flow_linear(input, err_tol, max_iter, log, y_bus, output_request);
         case linear_current:
-            return run_power_flow_linear_current(input, err_tol, max_iter, cache_run, log, y_bus);
+            return run_power_flow_linear_current(input, err_tol, max_iter, cache_run, log, y_bus, output_request);
         case iterative_current:
-            return run_power_flow_iterative_current(input, err_tol, max_iter, cache_run, log, y_bus);
+            return run_power_flow_iterative_current(input, err_tol, max_iter, cache_run, log, y_bus, initialization,
+                                                    output_request);
         default:
             throw InvalidCalculationMethod{};
         }
     }
 
     SolverOutput<sym> run_state_estimation(StateEstimationInput<sym> const& input, double err_tol, Idx max_iter,
-                                           Logger& log, CalculationMethod calculation_method,
-                                           YBus<sym> const& y_bus) final {
+                                           Logger& log, CalculationMethod calculation_method, YBus<sym> const& y_bus,
+                                           SolverOutputRequest const& output_request) final {
         using enum CalculationMethod;
 
         switch (calculation_method) {
         case default_method:
             [[fallthrough]]; // use iterative linear by default
         case iterative_linear:
-            return run_state_estimation_iterative_linear(input, err_tol, max_iter, log, y_bus);
+            return run_state_estimation_iterative_linear(input, err_tol, max_iter, log, y_bus, output_request);
         case newton_raphson:
-            return run_state_estimation_newton_raphson(input, err_tol, max_iter, log, y_bus);
+            return run_state_estimation_newton_raphson(input, err_tol, max_iter, log, y_bus, output_request);
         default:
             throw InvalidCalculationMethod{};
         }
     }
 
+    void check_observability(StateEstimationInput<sym> const& input, Logger& log, YBus<sym> const& y_bus) final {
+        MeasuredValues<sym> const measured_values{y_bus.math_topology(), input};
+        observability_cache_.check(measured_values, y_bus.math_topology(), y_bus.shared_y_bus_structure(), log);
+    }
+
     ShortCircuitSolverOutput<sym> run_short_circuit(ShortCircuitInput const& input, Logger& log,
-                                                    CalculationMethod calculation_method,
-                                                    YBus<sym> const& y_bus) final {
-        if (calculation_method != CalculationMethod::default_method &&
-            calculation_method != CalculationMethod::iec60909) {
-            throw InvalidCalculationMethod{};
-        }
+                                                    CalculationMethod calculation_method, YBus<sym> const& y_bus,
+                                                    SolverOutputRequest const& output_request) final {
+        return get_short_circuit_solver(log, calculation_method, y_bus).run_short_circuit(y_bus, input, output_request);
+    }
 
-        // construct model if needed
-        if (!iec60909_sc_solver_.has_value()) {
-            Timer const timer{log, LogEvent::create_math_solver};
-            iec60909_sc_solver_.emplace(y_bus, *topo_ptr_);
-        }
+    ShortCircuitSolverOutput<sym> prepare_short_circuit_sweep(ShortCircuitInput const& input, Logger& log,
+                                                              CalculationMethod calculation_method,
+                                                              YBus<sym> const& y_bus,
+                                                              SolverOutputRequest const& output_request) final {
+        return get_short_circuit_solver(log, calculation_method, y_bus)
+            .prepare_short_circuit_sweep(y_bus, input, output_request);
+    }
 
-        // call calculation
-        return iec60909_sc_solver_.value().run_short_circuit(y_bus, input);
+    void run_short_circuit_sweep(ShortCircuitInput const& input, YBus<sym> const& y_bus,
+                                 SolverOutputRequest const& output_request,
+                                 ShortCircuitSweepOutputFn<sym> const& fault_output_fn) final {
+        assert(iec60909_sc_solver_.has_value()); // prepare_short_circuit_sweep is called first
+        iec60909_sc_solver_.value().run_short_circuit_sweep(y_bus, input, std::cref(fault_output_fn), output_request);
     }
 
     void clear_solver() final {
@@ -105,12 +121,6 @@ template <symmetry_tag sym> class MathSolver : public MathSolverBase<sym> {
         iterative_linear_se_solver_.reset();
     }
 
-    void parameters_changed(bool changed) final {
-        if (iterative_current_pf_solver_.has_value()) {
-            iterative_current_pf_solver_->parameters_changed(changed);
-        }
-    }
-
   private:
     std::shared_ptr<MathModelTopology const> topo_ptr_;
     bool all_const_y_; // if all the load_gen is const element_admittance (impedance) type
@@ -120,43 +130,69 @@ template <symmetry_tag sym> class MathSolver : public MathSolverBase<sym> {
     std::optional<IterativeLinearSESolver<sym>> iterative_linear_se_solver_;
     std::optional<NewtonRaphsonSESolver<sym>> newton_raphson_se_solver_;
     std::optional<ShortCircuitSolver<sym>> iec60909_sc_solver_;
+    // observability of the recent sensor availabilities, for the observability check without solving
+    observability::ObservabilityCache observability_cache_;
+
+    ShortCircuitSolver<sym>& get_short_circuit_solver(Logger& log, CalculationMethod calculation_method,
+                                                      YBus<sym> const& y_bus) {
+        if (calculation_method != CalculationMethod::default_method &&
+            calculation_method != CalculationMethod::iec60909) {
+            throw InvalidCalculationMethod{};
+        }
+
+        // construct model if needed
+        if (!iec60909_sc_solver_.has_value()) {
+            Timer const timer{log, LogEvent::create_math_solver};
+            iec60909_sc_solver_.emplace(y_bus, *topo_ptr_);
+        }
+        return iec60909_sc_solver_.value();
+    }
 
     SolverOutput<sym> run_power_flow_newton_raphson(PowerFlowInput<sym> const& input, double err_tol, Idx max_iter,
-                                                    bool cache_run, Logger& log, YBus<sym> const& y_bus) {
+                                                    bool cache_run, Logger& log, YBus<sym> const& y_bus,
+                                                    PowerFlowInitialization initialization,
+                                                    SolverOutputRequest const& output_request) {
         if (!newton_raphson_pf_solver_.has_value()) {
             Timer const timer{log, LogEvent::create_math_solver};
             newton_raphson_pf_solver_.emplace(y_bus, *topo_ptr_);
         }
-        return newton_raphson_pf_solver_.value().run_power_flow(y_bus, input, err_tol, max_iter, cache_run, log);
+        return newton_raphson_pf_solver_.value().run_power_flow(y_bus, input, err_tol, max_iter, cache_run, log,
+                                                                initialization, output_request);
     }
 
     SolverOutput<sym> run_power_flow_linear(PowerFlowInput<sym> const& input, double /* err_tol */, Idx /* max_iter */,
-                                            Logger& log, YBus<sym> const& y_bus) {
+                                            Logger& log, YBus<sym> const& y_bus,
+                                            SolverOutputRequest const& output_request) {
         if (!linear_pf_solver_.has_value()) {
             Timer const timer{log, LogEvent::create_math_solver};
             linear_pf_solver_.emplace(y_bus, *topo_ptr_);
         }
-        return linear_pf_solver_.value().run_power_flow(y_bus, input, log);
+        return linear_pf_solver_.value().run_power_flow(y_bus, input, log, output_request);
     }
 
     SolverOutput<sym> run_power_flow_iterative_current(PowerFlowInput<sym> const& input, double err_tol, Idx max_iter,
-                                                       bool cache_run, Logger& log, YBus<sym> const& y_bus) {
+                                                       bool cache_run, Logger& log, YBus<sym> const& y_bus,
+                                                       PowerFlowInitialization initialization,
+                                                       SolverOutputRequest const& output_request) {
         if (!iterative_current_pf_solver_.has_value()) {
             Timer const timer{log, LogEvent::create_math_solver};
             iterative_current_pf_solver_.emplace(y_bus, *topo_ptr_);
         }
-        return iterative_current_pf_solver_.value().run_power_flow(y_bus, input, err_tol, max_iter, cache_run, log);
+        return iterative_current_pf_solver_.value().run_power_flow(y_bus, input, err_tol, max_iter, cache_run, log,
+                                                                   initialization, output_request);
     }
 
     SolverOutput<sym> run_power_flow_linear_current(PowerFlowInput<sym> const& input, double /* err_tol */,
                                                     Idx /* max_iter */, bool cache_run, Logger& log,
-                                                    YBus<sym> const& y_bus) {
+                                                    YBus<sym> const& y_bus, SolverOutputRequest const& output_request) {
+        // the linear current method is by definition a single iteration from the flat start
         return run_power_flow_iterative_current(input, std::numeric_limits<double>::infinity(), 1, cache_run, log,
-                                                y_bus);
+                                                y_bus, PowerFlowInitialization::cold_start, output_request);
     }
 
     SolverOutput<sym> run_state_estimation_iterative_linear(StateEstimationInput<sym> const& input, double err_tol,
-                                                            Idx max_iter, Logger& log, YBus<sym> const& y_bus) {
+                                                            Idx max_iter, Logger& log, YBus<sym> const& y_bus,
+                                                            SolverOutputRequest const& output_request) {
         // construct model if needed
         if (!iterative_linear_se_solver_.has_value()) {
             Timer const timer{log, LogEvent::create_math_solver};
@@ -164,11 +200,13 @@ template <symmetry_tag sym> class MathSolver : public MathSolverBase<sym> {
         }
 
         // call calculation
-        return iterative_linear_se_solver_.value().run_state_estimation(y_bus, input, err_tol, max_iter, log);
+        return iterative_linear_se_solver_.value().run_state_estimation(y_bus, input, err_tol, max_iter, log,
+                                                                        output_request);
     }
 
     SolverOutput<sym> run_state_estimation_newton_raphson(StateEstimationInput<sym> const& input, double err_tol,
-                                                          Idx max_iter, Logger& log, YBus<sym> const& y_bus) {
+                                                          Idx max_iter, Logger& log, YBus<sym> const& y_bus,
+                                                          SolverOutputRequest const& output_request) {
         // construct model if needed
         if (!newton_raphson_se_solver_.has_value()) {
             Timer const timer{log, LogEvent::create_math_solver};
@@ -176,7 +214,8 @@ template <symmetry_tag sym> class MathSolver : public MathSolverBase<sym> {
         }
 
         // call calculation
-        return newton_raphson_se_solver_.value().run_state_estimation(y_bus, input, err_tol, max_iter, log);
+        return newton_raphson_se_solver_.value().run_state_estimation(y_bus, input, err_tol, max_iter, log,
+                                                                      output_request);
     }
 };
 
@@ -12,6 +12,7 @@
 #include "../common/enum.hpp"
 #include "../common/logging.hpp"
 
+#include <functional>
 #include <memory>
 #include <type_traits>
 
@@ -22,6 +23,10 @@ namespace math_solver {
 // forward declare YBus
 template <symmetry_tag sym> class YBus;
 
+// called for each fault of a short circuit sweep, with the output in which only that fault is active
+template <symmetry_tag sym>
+using ShortCircuitSweepOutputFn = std::function<void(Idx /* fault_number */, ShortCircuitSolverOutput<sym> const&)>;
+
 // abstract base class
 template <symmetry_tag sym> class MathSolverBase {
   public:
@@ -31,15 +36,28 @@ template <symmetry_tag sym> class MathSolverBase {
 
     virtual SolverOutput<sym> run_power_flow(PowerFlowInput<sym> const& input, double err_tol, Idx max_iter,
                                              bool cache_run, Logger& log, CalculationMethod calculation_method,
-                                             YBus<sym> const& y_bus) = 0;
+                                             YBus<sym> const& y_bus, PowerFlowInitialization initialization,
+                                             SolverOutputRequest const& output_request) = 0;
     virtual SolverOutput<sym> run_state_estimation(StateEstimationInput<sym> const& input, double err_tol, Idx max_iter,
                                                    Logger& log, CalculationMethod calculation_method,
-                                                   YBus<sym> const& y_bus) = 0;
+                                                   YBus<sym> const& y_bus,
+                                                   SolverOutputRequest const& output_request) = 0;
+    // only the observability check of the state estimation, throws NotObservableError if not observable
+    virtual void check_observability(StateEstimationInput<sym> const& input, Logger& log,
+                                     YBus<sym> const& y_bus) = 0;
     virtual ShortCircuitSolverOutput<sym> run_short_circuit(ShortCircuitInput const& input, Logger& log,
                                                             CalculationMethod calculation_method,
-                                                            YBus<sym> const& y_bus) = 0;
+                                                            YBus<sym> const& y_bus,
+                                                            SolverOutputRequest const& output_request) = 0;
+    // see ShortCircuitSolver::prepare_short_circuit_sweep and ShortCircuitSolver::run_short_circuit_sweep
+    virtual ShortCircuitSolverOutput<sym> prepare_short_circuit_sweep(ShortCircuitInput const& input, Logger& log,
+                                                                      CalculationMethod calculation_method,
+                                                                      YBus<sym> const& y_bus,
+                                                                      SolverOutputRequest const& output_request) = 0;
+    virtual void run_short_circuit_sweep(ShortCircuitInput const& input, YBus<sym> const& y_bus,
+                                         SolverOutputRequest const& output_request,
+                                         ShortCircuitSweepOutputFn<sym> const& fault_output_fn) = 0;
     virtual void clear_solver() = 0;
-    virtual void parameters_changed(bool changed) = 0;
 
   protected:
     MathSolverBase() = default;
@@ -240,7 +240,7 @@ class NewtonRaphsonPFSolver : public IterativePFSolver<sym_type, NewtonRaphsonPF
           data_jac_(y_bus.nnz_lu()),
           x_(y_bus.size()),
           del_x_pq_(y_bus.size()),
-          sparse_solver_{y_bus.row_indptr_lu(), y_bus.col_indices_lu(), y_bus.lu_diag()},
+          sparse_solver_{y_bus.row_indptr_lu(), y_bus.col_indices_lu(), y_bus.lu_diag(), y_bus.lu_symbolic()},
           perm_(y_bus.size()),
           bus_control_(y_bus.size()),
           voltage_regulators_per_load_gen_{std::ref(topo.voltage_regulators_per_load_gen)},
@@ -254,15 +254,12 @@ class NewtonRaphsonPFSolver : public IterativePFSolver<sym_type, NewtonRaphsonPF
     // This mapping ensures that G aligns with the N/M sub-blocks as in the NR Jacobian.
     void initialize_derived_solver(YBus<sym> const& y_bus, PowerFlowInput<sym> const& input,
                                    SolverOutput<sym>& output) {
+        sparse_solver_.set_n_threads(y_bus.sparse_lu_threads(), y_bus.sparse_lu_level_threads());
         // Reset reused buffers to zero
         std::ranges::fill(data_jac_, PFJacBlock<sym>{});
         std::ranges::fill(del_x_pq_, PolarPhasor<sym>{});
 
-        // initialize bus state, in case solver instance is reused in batching
-        std::ranges::fill(bus_control_, BusControlState{});
-
-        const bool has_usable_limits = set_bus_types_and_q_limits(input);
-        limit_check_countdown_ = has_usable_limits ? limit_check_at_iteration : no_limit_check;
+        initialize_bus_control(input);
 
         // Map network admittance to real-domain system
         IdxVector const& map_lu_y_bus = y_bus.map_lu_y_bus();
@@ -294,12 +291,17 @@ class NewtonRaphsonPFSolver : public IterativePFSolver<sym_type, NewtonRaphsonPF
         }
 
         set_reference_voltage_for_pv_buses(output.u);
+        initialize_unknown(output.u);
+    }
 
-        // get magnitude and angle of start voltage
-        for (Idx i = 0; i != this->n_bus_; ++i) {
-            x_[i].v() = cabs(output.u[i]);
-            x_[i].theta() = arg(output.u[i]);
-        }
+    // Initialize the unknown variable in polar form from the voltages already present in the output,
+    // e.g., the converged solution of a previous calculation (warm start).
+    void initialize_derived_solver_from_voltage(YBus<sym> const& y_bus, PowerFlowInput<sym> const& input,
+                                                SolverOutput<sym>& output) {
+        sparse_solver_.set_n_threads(y_bus.sparse_lu_threads(), y_bus.sparse_lu_level_threads());
+        initialize_bus_control(input);
+        set_reference_voltage_for_pv_buses(output.u);
+        initialize_unknown(output.u);
     }
 
     // Calculate the Jacobian and deviation
@@ -397,6 +399,22 @@ class NewtonRaphsonPFSolver : public IterativePFSolver<sym_type, NewtonRaphsonPF
     // store clamped Q-value for a load_gen in case of a limit violation to avoid recalculation in add_loads()
     std::vector<RealValue<sym>> clamped_regulators_per_load_gen_;
 
+    void initialize_bus_control(PowerFlowInput<sym> const& input) {
+        // initialize bus state, in case solver instance is reused in batching
+        std::ranges::fill(bus_control_, BusControlState{});
+
+        const bool has_usable_limits = set_bus_types_and_q_limits(input);
+        limit_check_countdown_ = has_usable_limits ? limit_check_at_iteration : no_limit_check;
+    }
+
+    // get magnitude and angle of start voltage
+    void initialize_unknown(ComplexValueVector<sym> const& u) {
+        for (Idx i = 0; i != this->n_bus_; ++i) {
+            x_[i].v() = cabs(u[i]);
+            x_[i].theta() = arg(u[i]);
+        }
+    }
+
     auto set_bus_types_and_q_limits(PowerFlowInput<sym> const& input) {
         auto const& voltage_regulators_per_load_gen = voltage_regulators_per_load_gen_.get();
 
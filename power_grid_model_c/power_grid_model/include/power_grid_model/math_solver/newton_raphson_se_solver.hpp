@@ -160,11 +160,13 @@ template <symmetry_tag sym_type> class NewtonRaphsonSESolver {
           data_gain_(y_bus.nnz_lu()),
           delta_x_rhs_(y_bus.size()),
           x_(y_bus.size()),
-          sparse_solver_{y_bus.row_indptr_lu(), y_bus.col_indices_lu(), y_bus.lu_diag()},
+          sparse_solver_{y_bus.row_indptr_lu(), y_bus.col_indices_lu(), y_bus.lu_diag(), y_bus.lu_symbolic()},
           perm_(y_bus.size()) {}
 
     SolverOutput<sym> run_state_estimation(YBus<sym> const& y_bus, StateEstimationInput<sym> const& input,
-                                           double err_tol, Idx max_iter, Logger& log) {
+                                           double err_tol, Idx max_iter, Logger& log,
+                                           SolverOutputRequest const& output_request = {}) {
+        sparse_solver_.set_n_threads(y_bus.sparse_lu_threads(), y_bus.sparse_lu_level_threads());
         // prepare
         Timer main_timer;
         Timer sub_timer;
@@ -178,8 +180,8 @@ template <symmetry_tag sym_type> class NewtonRaphsonSESolver {
         // preprocess measured value
         sub_timer = Timer{log, LogEvent::preprocess_measured_value};
         MeasuredValues<sym> const measured_values{y_bus.math_topology(), input};
-        auto const observability_result =
-            observability::observability_check(measured_values, y_bus.math_topology(), y_bus.y_bus_structure());
+        auto const observability_result = observability_cache_.check(measured_values, y_bus.math_topology(),
+                                                                     y_bus.shared_y_bus_structure(), log);
 
         // initialize voltage with initial angle
         sub_timer = Timer{log, LogEvent::initialize_voltages};
@@ -203,7 +205,7 @@ template <symmetry_tag sym_type> class NewtonRaphsonSESolver {
 
         // calculate math result
         sub_timer = Timer{log, LogEvent::calculate_math_result};
-        detail::calculate_se_result<sym>(y_bus, measured_values, output);
+        detail::calculate_se_result<sym>(y_bus, measured_values, output, output_request);
 
         // Manually stop timers to avoid "Max number of iterations" to be included in the timing.
         sub_timer.stop();
@@ -228,6 +230,8 @@ template <symmetry_tag sym_type> class NewtonRaphsonSESolver {
     // solver
     SparseLUSolver<NRSEGainBlock<sym>, NRSERhs<sym>, NRSEUnknown<sym>> sparse_solver_;
     SparseLUSolver<NRSEGainBlock<sym>, NRSERhs<sym>, NRSEUnknown<sym>>::BlockPermArray perm_;
+    // observability of the recent sensor availabilities
+    observability::ObservabilityCache observability_cache_;
 
     void initialize_unknown(ComplexValueVector<sym>& initial_u, MeasuredValues<sym> const& measured_values) {
         using statistics::detail::cabs_or_real;
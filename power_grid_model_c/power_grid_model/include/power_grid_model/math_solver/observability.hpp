@@ -14,14 +14,17 @@
 #include "y_bus.hpp"
 
 #include "../common/exception.hpp"
+#include "../common/logging.hpp"
 
 #include <algorithm>
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
+#include <exception>
 #include <functional>
 #include <iterator>
 #include <limits>
+#include <memory>
 #include <numeric>
 #include <span>
 #include <utility>
@@ -693,6 +696,97 @@ inline ObservabilityResult observability_check(MeasuredValues<sym> const& measur
                                .is_possibly_ill_conditioned = observability_sensors.is_possibly_ill_conditioned};
 }
 
+// presence of the sensors which the observability check looks at, one byte per bus and per branch
+// the observability only depends on which sensors are present, not on the measured values or variances
+// so scenarios with the same sensor presence on the same y bus structure have the same observability
+template <symmetry_tag sym>
+inline std::vector<uint8_t> sensor_presence(MeasuredValues<sym> const& measured_values,
+                                            MathModelTopology const& topo) {
+    std::vector<uint8_t> presence;
+    presence.reserve(topo.n_bus() + topo.n_branch() + 1);
+    presence.push_back(static_cast<uint8_t>(measured_values.has_voltage_measurements()) |
+                       static_cast<uint8_t>(measured_values.has_global_angle_current() << 1));
+    for (Idx bus = 0; bus != topo.n_bus(); ++bus) {
+        bool const has_voltage = measured_values.has_voltage(bus);
+        presence.push_back(static_cast<uint8_t>(measured_values.has_bus_injection(bus)) |
+                           static_cast<uint8_t>(has_voltage << 1) |
+                           static_cast<uint8_t>((has_voltage && measured_values.has_angle_measurement(bus)) << 2));
+    }
+    for (Idx branch = 0; branch != topo.n_branch(); ++branch) {
+        presence.push_back(static_cast<uint8_t>(
+            measured_values.has_branch_from_power(branch) || measured_values.has_branch_to_power(branch) ||
+            measured_values.has_branch_from_current(branch) || measured_values.has_branch_to_current(branch)));
+    }
+    return presence;
+}
+
+// cache of the observability of the most recent sensor presences on one y bus structure
+// a scenario with the same sensors as a cached one skips the observability check, including the graph search
+// the result of an unobservable scenario is cached as well, the error is thrown again
+class ObservabilityCache {
+  public:
+    static constexpr Idx max_entries = 8;
+
+    template <symmetry_tag sym>
+    ObservabilityResult check(MeasuredValues<sym> const& measured_values, MathModelTopology const& topo,
+                              std::shared_ptr<YBusStructure const> const& y_bus_structure, Logger& log) {
+        assert(y_bus_structure != nullptr);
+        if (y_bus_structure != y_bus_structure_) {
+            entries_.clear();
+            y_bus_structure_ = y_bus_structure;
+        }
+
+        std::vector<uint8_t> presence = sensor_presence(measured_values, topo);
+        uint64_t const key = hash(presence);
+        if (auto const found = std::ranges::find_if(
+                entries_, [&](Entry const& entry) { return entry.key == key && entry.presence == presence; });
+            found != entries_.end()) {
+            log.log(LogEvent::observability_cache_hit, Idx{1});
+            return found->get();
+        }
+
+        log.log(LogEvent::observability_cache_miss, Idx{1});
+        Entry entry{.key = key, .presence = std::move(presence)};
+        try {
+            entry.result = observability_check(measured_values, topo, *y_bus_structure);
+        } catch (NotObservableError const&) {
+            entry.error = std::current_exception();
+        }
+        if (std::ssize(entries_) == max_entries) {
+            entries_.erase(entries_.begin());
+        }
+        entries_.push_back(std::move(entry));
+        return entries_.back().get();
+    }
+
+  private:
+    struct Entry {
+        uint64_t key{};
+        std::vector<uint8_t> presence;
+        ObservabilityResult result{};
+        std::exception_ptr error{};
+
+        ObservabilityResult get() const {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+            return result;
+        }
+    };
+
+    std::shared_ptr<YBusStructure const> y_bus_structure_;
+    std::vector<Entry> entries_;
+
+    // FNV-1a
+    static uint64_t hash(std::span<uint8_t const> presence) {
+        uint64_t result = 14695981039346656037ULL;
+        for (uint8_t const value : presence) {
+            result = (result ^ value) * 1099511628211ULL;
+        }
+        return result;
+    }
+};
+
 } // namespace observability
 
 } // namespace power_grid_model::math_solver
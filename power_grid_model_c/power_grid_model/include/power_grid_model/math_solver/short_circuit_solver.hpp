@@ -16,9 +16,14 @@
 #include "../common/grouped_index_vector.hpp"
 #include "../common/three_phase_tensor.hpp"
 
+#include <Eigen/Core>
+#include <Eigen/LU>
+
 #include <algorithm>
+#include <array>
 #include <cassert>
 #include <cmath>
+#include <concepts>
 #include <functional>
 #include <utility>
 #include <vector>
@@ -31,6 +36,10 @@ namespace short_circuit {
 // solver
 template <symmetry_tag sym> class ShortCircuitSolver {
     using BlockPermArray = SparseLUSolver<ComplexTensor<sym>, ComplexValue<sym>, ComplexValue<sym>>::BlockPermArray;
+    using DenseMatrix = Eigen::Matrix<DoubleComplex, Eigen::Dynamic, Eigen::Dynamic>;
+    using DenseVector = Eigen::Matrix<DoubleComplex, Eigen::Dynamic, 1>;
+
+    static constexpr Idx n_phase = is_symmetric_v<sym> ? 1 : 3;
 
   public:
     ShortCircuitSolver(YBus<sym> const& y_bus, MathModelTopology const& topo)
@@ -38,10 +47,12 @@ template <symmetry_tag sym> class ShortCircuitSolver {
           n_source_{topo.n_source()},
           sources_per_bus_{std::cref(topo.sources_per_bus)},
           mat_data_(y_bus.nnz_lu()),
-          sparse_solver_{y_bus.row_indptr_lu(), y_bus.col_indices_lu(), y_bus.lu_diag()},
+          sparse_solver_{y_bus.row_indptr_lu(), y_bus.col_indices_lu(), y_bus.lu_diag(), y_bus.lu_symbolic()},
           perm_{static_cast<BlockPermArray>(n_bus_)} {}
 
-    ShortCircuitSolverOutput<sym> run_short_circuit(YBus<sym> const& y_bus, ShortCircuitInput const& input) {
+    ShortCircuitSolverOutput<sym> run_short_circuit(YBus<sym> const& y_bus, ShortCircuitInput const& input,
+                                                    SolverOutputRequest const& output_request = {}) {
+        sparse_solver_.set_n_threads(y_bus.sparse_lu_threads(), y_bus.sparse_lu_level_threads());
         check_input_valid(input);
 
         auto const [fault_type, fault_phase] = extract_fault_type_phase(input.faults);
@@ -65,11 +76,92 @@ template <symmetry_tag sym> class ShortCircuitSolver {
         sparse_solver_.prefactorize_and_solve(mat_data_, perm_, output.u_bus, output.u_bus);
 
         // post processing
-        calculate_result(y_bus, input, output, infinite_admittance_fault_counter, fault_type, phase_1, phase_2);
+        calculate_result(y_bus, input, output, infinite_admittance_fault_counter, fault_type, phase_1, phase_2,
+                         output_request);
+
+        return output;
+    }
+
+    // Sweep of independent faults on the same network, e.g., a fault at every bus.
+    // Each fault in the input is a separate calculation in which only that fault is active.
+    //
+    // Instead of factorizing the faulted matrix per fault, the pre-fault matrix is factorized once.
+    // For a fault at bus k, with the pre-fault voltage u_pre and the Thevenin impedance Z_kk = Z[k,k] of the bus,
+    //    the fault current i_f follows from
+    //        i_f = Y_f * u_k + C * lambda      the fault admittance Y_f, and the directions C of infinite admittance
+    //        C^T * u_k = 0                     the bolted part of the fault
+    //        u_k = u_pre_k - Z_kk * i_f
+    //    then the voltage of all buses is
+    //        u = u_pre - Z[:,k] * i_f
+    // The columns Z[:,k] are calculated by solves against the shared factorization.
+    //
+    // prepare_short_circuit_sweep factorizes the pre-fault matrix and returns the output without any active fault.
+    // run_short_circuit_sweep then calls fault_output_fn(fault_number, output) for each fault, grouped per bus.
+    // The output is reused for all faults: output.fault only holds the result of the current fault, and the output
+    //    is only valid during the call.
+    ShortCircuitSolverOutput<sym> prepare_short_circuit_sweep(YBus<sym> const& y_bus, ShortCircuitInput const& input,
+                                                              SolverOutputRequest const& output_request = {}) {
+        sparse_solver_.set_n_threads(y_bus.sparse_lu_threads(), y_bus.sparse_lu_level_threads());
+        std::ranges::for_each(input.faults, check_fault_valid);
+
+        // pre-fault voltage
+        IdxVector const& bus_entry = y_bus.lu_diag();
+        u_pre_.assign(n_bus_, ComplexValue<sym>{});
+        detail::copy_y_bus<sym>(y_bus, mat_data_);
+        for (auto const& [bus_number, sources] : enumerated_zip_sequence(sources_per_bus_.get())) {
+            detail::add_sources<sym>(sources, bus_number, y_bus, input.source, mat_data_[bus_entry[bus_number]],
+                                     u_pre_[bus_number]);
+        }
+        sparse_solver_.prefactorize_and_solve(mat_data_, perm_, u_pre_, u_pre_);
 
+        ShortCircuitSolverOutput<sym> output;
+        output.u_bus = u_pre_;
+        output.source.resize(n_source_);
+        calculate_sweep_result(y_bus, input, output, output_request);
         return output;
     }
 
+    template <typename FaultOutputFn>
+        requires std::invocable<FaultOutputFn&, Idx /* fault_number */, ShortCircuitSolverOutput<sym> const&>
+    void run_short_circuit_sweep(YBus<sym> const& y_bus, ShortCircuitInput const& input,
+                                 FaultOutputFn fault_output_fn, SolverOutputRequest const& output_request = {}) {
+        assert(std::ssize(u_pre_) == n_bus_); // prepare_short_circuit_sweep is called first
+
+        ShortCircuitSolverOutput<sym> output;
+        output.fault.resize(1);
+        output.source.resize(n_source_);
+        std::array<ComplexValueVector<sym>, n_phase> z_columns;
+        for (auto const& [bus_number, faults] : enumerated_zip_sequence(input.fault_buses)) {
+            if (faults.empty()) {
+                continue;
+            }
+            // Z[:,k] per phase, by solving Y * z = e_k
+            DenseMatrix z_kk(n_phase, n_phase);
+            for (Idx phase = 0; phase != n_phase; ++phase) {
+                ComplexValueVector<sym>& z_column = z_columns[phase];
+                z_column.assign(n_bus_, ComplexValue<sym>{});
+                phase_value(z_column[bus_number], phase) = 1.0;
+                sparse_solver_.solve_with_prefactorized_matrix(mat_data_, perm_, z_column, z_column);
+                for (Idx row = 0; row != n_phase; ++row) {
+                    z_kk(row, phase) = phase_value(z_column[bus_number], row);
+                }
+            }
+            for (Idx const fault_number : faults) {
+                DenseVector const i_fault =
+                    calculate_sweep_fault_current(input.faults[fault_number], z_kk, u_pre_[bus_number]);
+                output.u_bus = u_pre_;
+                for (Idx phase = 0; phase != n_phase; ++phase) {
+                    phase_value(output.fault.front().i_fault, phase) = i_fault(phase);
+                    for (Idx bus = 0; bus != n_bus_; ++bus) {
+                        output.u_bus[bus] -= z_columns[phase][bus] * i_fault(phase);
+                    }
+                }
+                calculate_sweep_result(y_bus, input, output, output_request);
+                fault_output_fn(fault_number, std::as_const(output));
+            }
+        }
+    }
+
   private:
     Idx n_bus_;
     Idx n_source_;
@@ -80,6 +172,8 @@ template <symmetry_tag sym> class ShortCircuitSolver {
     // sparse solver
     SparseLUSolver<ComplexTensor<sym>, ComplexValue<sym>, ComplexValue<sym>> sparse_solver_;
     BlockPermArray perm_;
+    // pre-fault voltage of the sweep
+    ComplexValueVector<sym> u_pre_;
 
     void prepare_matrix_and_rhs(YBus<sym> const& y_bus, ShortCircuitInput const& input,
                                 ShortCircuitSolverOutput<sym>& output, IdxVector& infinite_admittance_fault_counter,
@@ -232,7 +326,7 @@ template <symmetry_tag sym> class ShortCircuitSolver {
 
     void calculate_result(YBus<sym> const& y_bus, ShortCircuitInput const& input, ShortCircuitSolverOutput<sym>& output,
                           IdxVector const& infinite_admittance_fault_counter, FaultType const fault_type,
-                          int const phase_1, int const phase_2) const {
+                          int const phase_1, int const phase_2, SolverOutputRequest const& output_request) const {
         using enum FaultType;
 
         auto const& sources_per_bus = sources_per_bus_.get();
@@ -364,8 +458,115 @@ template <symmetry_tag sym> class ShortCircuitSolver {
             }
         }
 
-        output.branch = y_bus.template calculate_branch_flow<BranchShortCircuitSolverOutput<sym>>(output.u_bus);
-        output.shunt = y_bus.template calculate_shunt_flow<ApplianceShortCircuitSolverOutput<sym>>(output.u_bus);
+        detail::calculate_flow_result(y_bus, output.u_bus, output, output_request);
+    }
+
+    // Solve the fault current of a single fault from the Thevenin impedance and the pre-fault voltage of its bus.
+    //    [ I + Y_f * Z_kk    -C ] [ i_f    ]   [ Y_f * u_pre_k ]
+    //    [ C^T * Z_kk         0 ] [ lambda ] = [ C^T * u_pre_k ]
+    static DenseVector calculate_sweep_fault_current(FaultCalcParam const& fault, DenseMatrix const& z_kk,
+                                                     ComplexValue<sym> const& u_pre_bus) {
+        using enum FaultType;
+
+        auto const [phase_1, phase_2] = set_phase_index(fault.fault_phase);
+        bool const is_infinite = std::isinf(fault.y_fault.real());
+        DoubleComplex const y_fault = is_infinite ? DoubleComplex{} : fault.y_fault;
+        DenseMatrix const identity = DenseMatrix::Identity(n_phase, n_phase);
+
+        // admittance of the fault and the directions in which the fault is bolted
+        DenseMatrix y_f = DenseMatrix::Zero(n_phase, n_phase);
+        DenseMatrix constraint(n_phase, 0);
+        if (fault.fault_type == three_phase) {
+            // all phases to ground
+            if (is_infinite) {
+                constraint = identity;
+            } else {
+                y_f = y_fault * identity;
+            }
+        }
+        if constexpr (!is_symmetric_v<sym>) {
+            if (fault.fault_type == single_phase_to_ground) {
+                // phase_1 to ground
+                if (is_infinite) {
+                    constraint = identity.col(phase_1);
+                } else {
+                    y_f(phase_1, phase_1) = y_fault;
+                }
+            } else if (fault.fault_type == two_phase) {
+                // phase_1 to phase_2
+                DenseVector const difference = identity.col(phase_1) - identity.col(phase_2);
+                if (is_infinite) {
+                    constraint = difference;
+                } else {
+                    y_f = y_fault * difference * difference.transpose();
+                }
+            } else if (fault.fault_type == two_phase_to_ground) {
+                // phase_1 bolted to phase_2, both to ground
+                DenseVector const difference = identity.col(phase_1) - identity.col(phase_2);
+                DenseVector const sum = identity.col(phase_1) + identity.col(phase_2);
+                if (is_infinite) {
+                    constraint.resize(n_phase, 2);
+                    constraint << identity.col(phase_1), identity.col(phase_2);
+                } else {
+                    // u_1 = u_2 = u, i_1 + i_2 = y_fault * u
+                    constraint = difference;
+                    y_f = 0.25 * y_fault * sum * sum.transpose();
+                }
+            } else {
+                assert((fault.fault_type == three_phase));
+            }
+        }
+
+        DenseVector u_pre_k(n_phase);
+        for (Idx phase = 0; phase != n_phase; ++phase) {
+            u_pre_k(phase) = phase_value(u_pre_bus, phase);
+        }
+        auto const n_constraint = constraint.cols();
+        DenseMatrix lhs = DenseMatrix::Zero(n_phase + n_constraint, n_phase + n_constraint);
+        lhs.topLeftCorner(n_phase, n_phase) = identity + y_f * z_kk;
+        lhs.topRightCorner(n_phase, n_constraint) = -constraint;
+        lhs.bottomLeftCorner(n_constraint, n_phase) = constraint.transpose() * z_kk;
+        DenseVector rhs(n_phase + n_constraint);
+        rhs.head(n_phase) = y_f * u_pre_k;
+        rhs.tail(n_constraint) = constraint.transpose() * u_pre_k;
+
+        auto const lu = lhs.fullPivLu();
+        if (!lu.isInvertible()) {
+            throw SparseMatrixError{};
+        }
+        DenseVector const solution = lu.solve(rhs);
+        return solution.head(n_phase);
+    }
+
+    void calculate_sweep_result(YBus<sym> const& y_bus, ShortCircuitInput const& input,
+                                ShortCircuitSolverOutput<sym>& output,
+                                SolverOutputRequest const& output_request) const {
+        for (auto const& [bus_number, sources] : enumerated_zip_sequence(sources_per_bus_.get())) {
+            for (Idx const source_number : sources) {
+                ComplexTensor<sym> const y_source =
+                    y_bus.math_model_param().source_param[source_number].template y_ref<sym>();
+                output.source[source_number].i = dot(y_source, ComplexValue<sym>{input.source[source_number]}) -
+                                                 dot(y_source, output.u_bus[bus_number]);
+            }
+        }
+        detail::calculate_flow_result(y_bus, output.u_bus, output, output_request);
+    }
+
+    static DoubleComplex& phase_value(ComplexValue<sym>& value, Idx phase) {
+        if constexpr (is_symmetric_v<sym>) {
+            assert(phase == 0);
+            return value;
+        } else {
+            return value(phase);
+        }
+    }
+    static DoubleComplex const& phase_value(ComplexValue<sym> const& value, Idx phase) {
+        if constexpr (is_symmetric_v<sym>) {
+            assert(phase == 0);
+            return value;
+        } else {
+            return value(phase);
+        }
     }
 
     static constexpr auto set_phase_index(FaultPhase fault_phase) {
@@ -427,11 +628,14 @@ template <symmetry_tag sym> class ShortCircuitSolver {
                 throw InvalidShortCircuitPhaseOrType{};
             }
 
-            auto const& first = input.faults.front();
-            if (first.fault_type == FaultType::nan || first.fault_phase == FaultPhase::default_value ||
-                first.fault_phase == FaultPhase::nan) {
-                throw InvalidShortCircuitPhaseOrType{};
-            }
+            check_fault_valid(input.faults.front());
+        }
+    }
+
+    static void check_fault_valid(FaultCalcParam const& fault) {
+        if (fault.fault_type == FaultType::nan || fault.fault_phase == FaultPhase::default_value ||
+            fault.fault_phase == FaultPhase::nan) {
+            throw InvalidShortCircuitPhaseOrType{};
         }
     }
 
@@ -9,17 +9,24 @@
 #include "../common/exception.hpp"
 #include "../common/three_phase_tensor.hpp"
 #include "../common/typing.hpp"
+#include "../job_worker_pool.hpp"
 
 #include <Eigen/Core>
 
 #include <algorithm>
+#include <atomic>
+#include <barrier>
 #include <cassert>
 #include <cmath>
 #include <concepts>
 #include <cstdint>
+#include <exception>
+#include <functional>
 #include <iterator>
 #include <limits>
+#include <memory>
 #include <optional>
+#include <ranges>
 #include <span>
 #include <type_traits>
 #include <utility>
@@ -274,6 +281,214 @@ struct sparse_lu_entry_trait<Tensor, RHSVector, XVector> {
     using BlockPermArray = std::vector<BlockPerm>;
 };
 
+// Symbolic factorization of a sparse matrix with a symmetric structure which already includes all fill-ins,
+// for the LU factorization with the diagonal as pivots.
+// It only depends on the structure, so it is computed once per structure and shared read-only between solvers and
+// threads. The numeric factorization then runs over the precomputed schedule without any searching or allocation.
+class SparseLUSymbolic {
+  public:
+    SparseLUSymbolic(std::span<Idx const> row_indptr,  // indptr including fill-ins
+                     std::span<Idx const> col_indices, // indices including fill-ins
+                     std::span<Idx const> diag_lu)
+        : size_{static_cast<Idx>(row_indptr.size()) - 1},
+          transpose_entry_(row_indptr.back()),
+          elimination_parent_(size_, -1),
+          schur_update_indptr_(size_ + 1, 0) {
+        // position of the transposed entry
+        // walking all rows in order visits the entries of each column in order
+        IdxVector col_position(row_indptr.begin(), row_indptr.end() - 1);
+        for (Idx row = 0; row != size_; ++row) {
+            for (Idx idx = row_indptr[row]; idx != row_indptr[row + 1]; ++idx) {
+                Idx const transposed_idx = col_position[col_indices[idx]]++;
+                assert(col_indices[transposed_idx] == row);
+                transpose_entry_[idx] = transposed_idx;
+            }
+        }
+
+        for (Idx pivot_row_col = 0; pivot_row_col != size_; ++pivot_row_col) {
+            Idx const u_begin = diag_lu[pivot_row_col] + 1;
+            Idx const u_end = row_indptr[pivot_row_col + 1];
+            // the parent in the elimination tree is the first non-zero in the right of the pivot
+            if (u_begin != u_end) {
+                elimination_parent_[pivot_row_col] = col_indices[u_begin];
+            }
+            // Schur-complement update A_l_row,u_col -= L_l_row,pivot * U_pivot,u_col for all non-zero L and U blocks
+            // record the entry (l_row, u_col) of each update, in the order of the numeric factorization
+            for (Idx l_ref_idx = u_begin; l_ref_idx != u_end; ++l_ref_idx) {
+                Idx const l_row = col_indices[l_ref_idx];
+                // start from L_l_row,pivot, u_col is strictly increasing
+                Idx a_idx = transpose_entry_[l_ref_idx];
+                for (Idx u_idx = u_begin; u_idx != u_end; ++u_idx) {
+                    Idx const u_col = col_indices[u_idx];
+                    while (col_indices[a_idx] != u_col) {
+                        ++a_idx;
+                        // the fill-ins should be pre-allocated
+                        assert(a_idx < row_indptr[l_row + 1]);
+                    }
+                    schur_update_target_.push_back(a_idx);
+                }
+            }
+            schur_update_indptr_[pivot_row_col + 1] = std::ssize(schur_update_target_);
+        }
+
+        build_level_schedule();
+        build_pull_schedule(row_indptr, col_indices, diag_lu);
+    }
+
+    Idx size() const { return size_; }
+    // for entry i, transpose_entry()[i] is the position of the transposed entry
+    IdxVector const& transpose_entry() const { return transpose_entry_; }
+    // parent of each row/column in the elimination tree, -1 for the roots
+    IdxVector const& elimination_parent() const { return elimination_parent_; }
+    // all rows/columns on the paths from the given rows/columns to the roots of the elimination tree, in increasing order
+    // if only the entries owned by the given rows/columns change, only these rows/columns need to be refactorized
+    IdxVector elimination_paths(std::span<Idx const> pivots) const {
+        std::vector<int8_t> on_path(size_, 0);
+        IdxVector result;
+        for (Idx const pivot_row_col : pivots) {
+            for (Idx node = pivot_row_col; node != -1 && on_path[node] == 0; node = elimination_parent_[node]) {
+                on_path[node] = 1;
+                result.push_back(node);
+            }
+        }
+        std::ranges::sort(result);
+        return result;
+    }
+    // entries updated by the Schur complement of the pivot
+    // for each L block below the pivot, for each U block in the right of the pivot (both in column order)
+    std::span<Idx const> schur_update_target(Idx pivot_row_col) const {
+        return std::span<Idx const>{schur_update_target_}.subspan(
+            schur_update_indptr_[pivot_row_col],
+            schur_update_indptr_[pivot_row_col + 1] - schur_update_indptr_[pivot_row_col]);
+    }
+
+    // level of each row/column in the elimination tree: one more than the highest level of its children, 0 for leaves
+    // the rows/columns in the same level do not depend on each other in the factorization and the triangular solves
+    Idx n_levels() const { return std::ssize(level_indptr_) - 1; }
+    std::span<Idx const> level_pivots(Idx level) const {
+        return std::span<Idx const>{level_pivots_}.subspan(level_indptr_[level],
+                                                           level_indptr_[level + 1] - level_indptr_[level]);
+    }
+    // the levels from this level on contain a single row/column each, i.e., the top of the elimination tree is a chain
+    Idx chain_level_begin() const { return chain_level_begin_; }
+
+    // the same Schur-complement updates as above, but grouped by the pivot which owns the updated entry
+    // the pivot min(l_row, u_col) owns the entry (l_row, u_col)
+    // each update is A[target] -= L[l_entry] * U[u_entry]
+    // the updates of an entry are in the same order as in the sequential factorization
+    struct PullUpdate {
+        Idx target;
+        Idx l_entry;
+        Idx u_entry;
+    };
+    std::span<PullUpdate const> pull_updates(Idx pivot_row_col) const {
+        return std::span<PullUpdate const>{pull_updates_}.subspan(
+            pull_update_indptr_[pivot_row_col], pull_update_indptr_[pivot_row_col + 1] - pull_update_indptr_[pivot_row_col]);
+    }
+
+  private:
+    Idx size_;
+    IdxVector transpose_entry_;
+    IdxVector elimination_parent_;
+    IdxVector schur_update_indptr_;
+    IdxVector schur_update_target_;
+    IdxVector level_indptr_;
+    IdxVector level_pivots_;
+    Idx chain_level_begin_{};
+    IdxVector pull_update_indptr_;
+    std::vector<PullUpdate> pull_updates_;
+
+    void build_level_schedule() {
+        // the parent is always after the child, so one forward sweep is enough
+        IdxVector level(size_, 0);
+        Idx n_levels = size_ == 0 ? 0 : 1;
+        for (Idx pivot_row_col = 0; pivot_row_col != size_; ++pivot_row_col) {
+            if (Idx const parent = elimination_parent_[pivot_row_col]; parent != -1) {
+                assert(parent > pivot_row_col);
+                level[parent] = std::max(level[parent], level[pivot_row_col] + 1);
+                n_levels = std::max(n_levels, level[parent] + 1);
+            }
+        }
+        // counting sort, pivots stay in increasing order within a level
+        level_indptr_.assign(n_levels + 1, 0);
+        for (Idx const pivot_level : level) {
+            ++level_indptr_[pivot_level + 1];
+        }
+        for (Idx lvl = 0; lvl != n_levels; ++lvl) {
+            level_indptr_[lvl + 1] += level_indptr_[lvl];
+        }
+        level_pivots_.resize(size_);
+        IdxVector level_position(level_indptr_.begin(), level_indptr_.end() - 1);
+        for (Idx pivot_row_col = 0; pivot_row_col != size_; ++pivot_row_col) {
+            level_pivots_[level_position[level[pivot_row_col]]++] = pivot_row_col;
+        }
+        chain_level_begin_ = n_levels;
+        while (chain_level_begin_ > 0 &&
+               level_indptr_[chain_level_begin_] - level_indptr_[chain_level_begin_ - 1] == 1) {
+            --chain_level_begin_;
+        }
+    }
+
+    void build_pull_schedule(std::span<Idx const> row_indptr, std::span<Idx const> col_indices,
+                             std::span<Idx const> diag_lu) {
+        // count, then fill in the order of the pivots which push the updates
+        pull_update_indptr_.assign(size_ + 1, 0);
+        auto const for_each_update = [&](auto&& func) {
+            for (Idx pivot_row_col = 0; pivot_row_col != size_; ++pivot_row_col) {
+                Idx const u_begin = diag_lu[pivot_row_col] + 1;
+                Idx const u_end = row_indptr[pivot_row_col + 1];
+                auto schur_update_target = schur_update_target_.cbegin() + schur_update_indptr_[pivot_row_col];
+                for (Idx l_ref_idx = u_begin; l_ref_idx != u_end; ++l_ref_idx) {
+                    Idx const l_row = col_indices[l_ref_idx];
+                    for (Idx u_idx = u_begin; u_idx != u_end; ++u_idx) {
+                        Idx const owner = std::min(l_row, col_indices[u_idx]);
+                        func(owner, PullUpdate{.target = *schur_update_target++,
+                                               .l_entry = transpose_entry_[l_ref_idx],
+                                               .u_entry = u_idx});
+                    }
+                }
+            }
+        };
+        for_each_update([this](Idx owner, PullUpdate const& /* update */) { ++pull_update_indptr_[owner + 1]; });
+        for (Idx pivot_row_col = 0; pivot_row_col != size_; ++pivot_row_col) {
+            pull_update_indptr_[pivot_row_col + 1] += pull_update_indptr_[pivot_row_col];
+        }
+        pull_updates_.resize(pull_update_indptr_.back());
+        IdxVector pull_position(pull_update_indptr_.begin(), pull_update_indptr_.end() - 1);
+        for_each_update(
+            [this, &pull_position](Idx owner, PullUpdate const& update) { pull_updates_[pull_position[owner]++] = update; });
+    }
+};
+
+// The worker threads of the parallel levels of the sparse LU solvers of a model, started on first use and kept alive
+//     afterwards. The solvers of the model run their levels on these threads one solver at a time.
+// A copy does not share the threads, because copies of a model are used concurrently by different batch threads.
+class SparseLULevelThreads {
+  public:
+    SparseLULevelThreads() = default;
+    SparseLULevelThreads(SparseLULevelThreads const& /* other */) {}
+    SparseLULevelThreads& operator=(SparseLULevelThreads const& other) {
+        if (this != &other) {
+            thread_pool_.reset();
+        }
+        return *this;
+    }
+    SparseLULevelThreads(SparseLULevelThreads&&) noexcept = default;
+    SparseLULevelThreads& operator=(SparseLULevelThreads&&) noexcept = default;
+    ~SparseLULevelThreads() = default;
+
+    JobThreadPool& get(Idx n_thread) {
+        if (thread_pool_ == nullptr || thread_pool_->n_workers() < n_thread) {
+            thread_pool_.reset(); // join the old threads first
+            thread_pool_ = std::make_unique<JobThreadPool>(n_thread);
+        }
+        return *thread_pool_;
+    }
+
+  private:
+    std::unique_ptr<JobThreadPool> thread_pool_;
+};
+
 template <class Tensor, class RHSVector, class XVector> class SparseLUSolver {
   public:
     using entry_trait = sparse_lu_entry_trait<Tensor, RHSVector, XVector>;
@@ -288,11 +503,22 @@ template <class Tensor, class RHSVector, class XVector> class SparseLUSolver {
     SparseLUSolver(std::span<Idx const> row_indptr,  // indptr including fill-ins
                    std::span<Idx const> col_indices, // indices including fill-ins
                    std::span<Idx const> diag_lu)
+        : SparseLUSolver{row_indptr, col_indices, diag_lu,
+                         std::make_shared<SparseLUSymbolic const>(row_indptr, col_indices, diag_lu)} {}
+
+    // use a symbolic factorization of the same structure, e.g., shared between all solvers of a y bus structure
+    SparseLUSolver(std::span<Idx const> row_indptr,  // indptr including fill-ins
+                   std::span<Idx const> col_indices, // indices including fill-ins
+                   std::span<Idx const> diag_lu, std::shared_ptr<SparseLUSymbolic const> symbolic)
         : size_{static_cast<Idx>(row_indptr.size()) - 1},
           nnz_{row_indptr.back()},
           row_indptr_{row_indptr},
           col_indices_{col_indices},
-          diag_lu_{diag_lu} {}
+          diag_lu_{diag_lu},
+          symbolic_{std::move(symbolic)} {
+        assert(symbolic_ != nullptr);
+        assert(symbolic_->size() == size_);
+    }
 
     // solve with new matrix data, need to factorize first
     void
@@ -343,6 +569,7 @@ template <class Tensor, class RHSVector, class XVector> class SparseLUSolver {
     // diagonals of U have values
     // fill-ins should be pre-allocated with zero
     // block permutation array should be pre-allocated
+    // the numeric factorization follows the schedule of the symbolic factorization
     void prefactorize(std::vector<Tensor>& data, BlockPermArray& block_perm_array,
                       bool use_pivot_perturbation = false) {
         reset_matrix_cache();
@@ -351,165 +578,344 @@ template <class Tensor, class RHSVector, class XVector> class SparseLUSolver {
         }
         double const perturb_threshold = epsilon_perturbation * matrix_norm_;
 
-        // local reference
-        auto const& diag_lu = diag_lu_;
-        // lu matrix inplace
-        std::vector<Tensor>& lu_matrix = data;
+        if (Idx const n_thread = effective_n_threads(); n_thread > 1) {
+            prefactorize_parallel(data, block_perm_array, perturb_threshold, use_pivot_perturbation, n_thread);
+        } else {
+            prefactorize_sequential(data, block_perm_array, perturb_threshold, use_pivot_perturbation);
+        }
+        // if no pivot perturbation happened, reset cache
+        if (!has_pivot_perturbation_) {
+            reset_matrix_cache();
+        }
+    }
 
-        // column position idx per row for LU matrix
-        IdxVector col_position_idx(row_indptr_.begin(), row_indptr_.end() - 1);
+    // refactorize after a change of a few entries of the matrix, reusing the factorization of the unchanged part
+    // lu_data and block_perm_array hold the prefactorization of the previous matrix, without pivot perturbation
+    // matrix is the new matrix, which differs from the previous matrix only in the changed entries
+    // only the rows/columns on the paths from the changed entries to the root of the elimination tree are
+    //    refactorized, the result is bitwise identical to prefactorize() of the new matrix
+    // if the paths cover a large part of the matrix, it falls back to the full prefactorization
+    void prefactorize_partial(std::vector<Tensor> const& matrix, std::span<Idx const> changed_entries,
+                              std::vector<Tensor>& lu_data, BlockPermArray& block_perm_array) {
+        assert(std::ssize(matrix) == nnz_);
+        assert(std::ssize(lu_data) == nnz_);
+        assert(!has_pivot_perturbation_);
+
+        // entry (row, col) is owned by pivot min(row, col)
+        IdxVector owners;
+        owners.reserve(changed_entries.size());
+        for (Idx const idx : changed_entries) {
+            Idx const row = std::distance(row_indptr_.begin(), std::ranges::upper_bound(row_indptr_, idx)) - 1;
+            owners.push_back(std::min(row, col_indices_[idx]));
+        }
+        IdxVector const affected_pivots = symbolic_->elimination_paths(owners);
+        if (2 * std::ssize(affected_pivots) > size_) {
+            lu_data = matrix;
+            prefactorize(lu_data, block_perm_array);
+            return;
+        }
+        reset_matrix_cache();
+        refactorize_pivots(matrix, affected_pivots, lu_data, block_perm_array);
+    }
 
-        // start pivoting, it is always the diagonal
-        for (Idx pivot_row_col = 0; pivot_row_col != size_; ++pivot_row_col) {
-            Idx const pivot_idx = diag_lu[pivot_row_col];
+    // number of threads for the factorization and the triangular solves
+    // 1 (default) uses the sequential path
+    // more threads process the independent rows/columns of each level of the elimination tree concurrently
+    // the result is bitwise identical to the sequential path, regardless of the number of threads,
+    //    because every entry receives the same updates in the same order
+    // small matrices always use the sequential path
+    // the levels run on the given level threads, which are shared with the other solvers of the model
+    Idx n_threads() const { return n_threads_; }
+    void set_n_threads(Idx n_threads, SparseLULevelThreads* level_threads) {
+        assert(n_threads >= 1);
+        assert(n_threads == 1 || level_threads != nullptr);
+        n_threads_ = n_threads;
+        level_threads_ = level_threads;
+    }
 
-            // Dense LU factorize pivot for block matrix in-place
-            // A_pivot,pivot, becomes P_pivot^-1 * L_pivot * U_pivot * Q_pivot^-1
-            // return reference to pivot permutation
-            BlockPerm const& block_perm = [&]() -> std::conditional_t<is_block, BlockPerm const&, BlockPerm> {
-                if constexpr (is_block) {
-                    // use machine precision by default
-                    // record block permutation
-                    auto pivot_matrix = lu_matrix[pivot_idx].matrix();
-                    LUFactor::factorize_block_in_place(pivot_matrix, block_perm_array[pivot_row_col], perturb_threshold,
-                                                       use_pivot_perturbation, has_pivot_perturbation_);
-                    return block_perm_array[pivot_row_col];
-                } else {
-                    if (use_pivot_perturbation) {
-                        // use machine precision by default
-                        // record pivot perturbation
-                        double abs_pivot = cabs(lu_matrix[pivot_idx]);
-                        perturb_pivot_if_needed(perturb_threshold, lu_matrix[pivot_idx], abs_pivot,
-                                                has_pivot_perturbation_);
-                    }
-                    if (!is_normal(lu_matrix[pivot_idx])) {
-                        throw SparseMatrixError{};
-                    }
-                    return {};
-                }
-            }();
-            // reference to pivot
-            Tensor const& pivot = lu_matrix[pivot_idx];
-
-            // for block matrix
-            // permute rows of L's in the left of the pivot
-            // L_k,pivot = P_pivot * L_k,pivot    k < pivot
-            // permute columns of U's above the pivot
-            // U_pivot,k = U_pivot,k * Q_pivot    k < pivot
-            if constexpr (is_block) {
-                // loop rows and columns at the same time
-                // since the matrix is symmetric
-                for (Idx l_idx = row_indptr_[pivot_row_col]; l_idx < pivot_idx; ++l_idx) {
-                    // permute rows of L_k,pivot
-                    lu_matrix[l_idx] = (block_perm.p * lu_matrix[l_idx].matrix()).array();
-                    // get row and idx of u
-                    Idx const u_row = col_indices_[l_idx];
-                    Idx const u_idx = col_position_idx[u_row];
-                    // we should exactly find the current column
-                    assert(col_indices_[u_idx] == pivot_row_col);
-                    // permute columns of U_pivot,k
-                    lu_matrix[u_idx] = (lu_matrix[u_idx].matrix() * block_perm.q).array();
-                    // increment column position
-                    ++col_position_idx[u_row];
-                }
-            }
+  private:
+    static constexpr Idx linear_search_threshold = 16;
+    // minimum number of rows/columns to use the parallel path, the synchronization per level does not pay off below
+    static constexpr Idx parallel_min_size = 512;
 
-            // for block matrix
-            // calculate U blocks in the right of the pivot, in-place
-            // L_pivot * U_pivot,k = P_pivot * A_pivot,k       k > pivot
-            if constexpr (is_block) {
-                for (Idx u_idx = pivot_idx + 1; u_idx < row_indptr_[pivot_row_col + 1]; ++u_idx) {
-                    Tensor& u = lu_matrix[u_idx];
-                    // permutation
-                    u = (block_perm.p * u.matrix()).array();
-                    // forward substitution (left,lower solve), per row in u
-                    LUFactor::template triangular_solve_inplace<TriangularSolveSide::left, TriangularFactor::lower>(
-                        pivot.matrix(), u);
-                }
-            }
+    Idx size_;
+    Idx nnz_; // number of non zeroes (in block)
+    std::span<Idx const> row_indptr_;
+    std::span<Idx const> col_indices_;
+    std::span<Idx const> diag_lu_;
+    std::shared_ptr<SparseLUSymbolic const> symbolic_;
+    Idx n_threads_{1};
+    // not owned, the level threads of the model
+    SparseLULevelThreads* level_threads_{};
+    // cache value for pivot perturbation for the factorize step
+    bool has_pivot_perturbation_{false};
+    double matrix_norm_{};
+    std::optional<std::vector<Tensor>> original_matrix_;
+    // cache value for iterative refinement for the solve step
+    std::optional<std::vector<XVector>> dx_;
+    std::optional<std::vector<RHSVector>> residual_;
+    std::optional<std::vector<RHSVector>> rhs_;
 
-            // Calculate L blocks below the pivot and apply the sparse Schur-complement update:
+    Idx effective_n_threads() const {
+        if (n_threads_ <= 1 || size_ < parallel_min_size) {
+            return 1;
+        }
+        // the levels in the chain at the top of the elimination tree are done by one thread anyway
+        SparseLUSymbolic const& symbolic = *symbolic_;
+        Idx max_level_size{};
+        for (Idx level = 0; level != symbolic.chain_level_begin(); ++level) {
+            max_level_size = std::max(max_level_size, std::ssize(symbolic.level_pivots(level)));
+        }
+        return std::min(n_threads_, max_level_size);
+    }
+
+    void prefactorize_sequential(std::vector<Tensor>& lu_matrix, BlockPermArray& block_perm_array,
+                                 double perturb_threshold, bool use_pivot_perturbation) {
+        SparseLUSymbolic const& symbolic = *symbolic_;
+        IdxVector const& transpose_entry = symbolic.transpose_entry();
+
+        // start pivoting, it is always the diagonal
+        for (Idx pivot_row_col = 0; pivot_row_col != size_; ++pivot_row_col) {
+            Idx const pivot_idx = diag_lu_[pivot_row_col];
+            factorize_pivot(lu_matrix, block_perm_array, pivot_row_col, perturb_threshold, use_pivot_perturbation,
+                            has_pivot_perturbation_);
+
+            // Apply the sparse Schur-complement update:
             // A_k,j = A_k,j - L_k,pivot * U_pivot,j    k, j > pivot
             // The outer and inner loops visit only structurally non-zero blocks of L_k,pivot and U_pivot,j.
             // Because the matrix is symmetric,
             //    looking for col_indices at pivot_row_col, starting from the diagonal (pivot_row_col, pivot_row_col)
             //    we get also the non-zero row indices under the pivot
+            auto schur_update_target = symbolic.schur_update_target(pivot_row_col).begin();
             for (Idx l_ref_idx = pivot_idx + 1; l_ref_idx < row_indptr_[pivot_row_col + 1]; ++l_ref_idx) {
-                // find index of l in corresponding row
-                Idx const l_row = col_indices_[l_ref_idx];
-                Idx const l_idx = col_position_idx[l_row];
-                // we should exactly find the current column
-                assert(col_indices_[l_idx] == pivot_row_col);
-                // calculating l at (l_row, pivot_row_col)
-                if constexpr (is_block) {
-                    // for block matrix
-                    // calculate L blocks below the pivot, in-place
-                    // L_k,pivot * U_pivot = A_k_pivot * Q_pivot    k > pivot
-                    Tensor& l = lu_matrix[l_idx];
-                    // permutation
-                    l = (l.matrix() * block_perm.q).array();
-                    // forward substitution, per column in l
-                    // l0 = [l00, l10]^T
-                    // l1 = [l01, l11]^T
-                    // l = [l0, l1]
-                    // a = [a0, a1]
-                    // u = [[u00, u01]
-                    //      [0  , u11]]
-                    // l * u = a
-                    // l0 * u00 = a0
-                    // l0 * u01 + l1 * u11 = a1
-                    LUFactor::template triangular_solve_inplace<TriangularSolveSide::right, TriangularFactor::upper>(
-                        pivot.matrix(), l);
-                } else {
-                    // for scalar matrix, just divide
-                    // L_k,pivot = A_k,pivot / U_pivot    k > pivot
-                    lu_matrix[l_idx] = lu_matrix[l_idx] / pivot;
-                }
-                Tensor const& l = lu_matrix[l_idx];
+                Tensor const& l = lu_matrix[transpose_entry[l_ref_idx]];
 
                 // Perform Schur-complement update for row l_row of the trailing unfactorized block. For each
-                // structurally non-zero U entry to the right of the pivot, find the corresponding entry in l_row and
-                // apply A(l_row, u_col) -= l * U(pivot_row_col, u_col). it can create fill-ins, but the fill-ins are
-                // pre-allocated it is guaranteed to have an entry at (l_row, u_col), if (pivot_row_col, u_col) is
-                // non-zero
-                Idx a_idx = l_idx;
+                // structurally non-zero U entry to the right of the pivot, apply
+                // A(l_row, u_col) -= l * U(pivot_row_col, u_col) at the entry found by the symbolic factorization.
+                // it can create fill-ins, but the fill-ins are pre-allocated
                 // loop all columns in the right of (pivot_row_col, pivot_row_col), at pivot_row
                 for (Idx u_idx = pivot_idx + 1; u_idx < row_indptr_[pivot_row_col + 1]; ++u_idx) {
-                    Idx const u_col = col_indices_[u_idx];
-                    assert(u_col > pivot_row_col);
-                    // u_col is strictly increasing, so continue after the previous match.
-                    a_idx = find_entry(l_row, u_col, a_idx + 1, row_indptr_[l_row + 1]);
+                    Idx const a_idx = *schur_update_target++;
+                    assert(col_indices_[a_idx] == col_indices_[u_idx]);
                     // subtract
                     lu_matrix[a_idx] -= dot(l, lu_matrix[u_idx]);
                 }
-                // iterate column position
-                ++col_position_idx[l_row];
             }
-            // iterate column position for the pivot
-            ++col_position_idx[pivot_row_col];
+            assert(schur_update_target == symbolic.schur_update_target(pivot_row_col).end());
         }
-        // if no pivot perturbation happened, reset cache
-        if (!has_pivot_perturbation_) {
-            reset_matrix_cache();
+    }
+
+    // Factorize level by level of the elimination tree.
+    // Instead of pushing the Schur-complement updates of a pivot to the trailing matrix, each pivot first pulls all
+    // updates of its own row and column from its descendants, which are all in lower levels. Then the pivots in one
+    // level only touch their own rows and columns and can be factorized concurrently.
+    // The chain at the top of the elimination tree is finished by the calling thread.
+    void prefactorize_parallel(std::vector<Tensor>& lu_matrix, BlockPermArray& block_perm_array,
+                               double perturb_threshold, bool use_pivot_perturbation, Idx n_thread) {
+        SparseLUSymbolic const& symbolic = *symbolic_;
+        std::vector<uint8_t> thread_has_pivot_perturbation(n_thread, 0);
+
+        auto const factorize_pulled_pivot = [&](Idx pivot_row_col, bool& has_pivot_perturbation) {
+            for (auto const& update : symbolic.pull_updates(pivot_row_col)) {
+                lu_matrix[update.target] -= dot(lu_matrix[update.l_entry], lu_matrix[update.u_entry]);
+            }
+            factorize_pivot(lu_matrix, block_perm_array, pivot_row_col, perturb_threshold, use_pivot_perturbation,
+                            has_pivot_perturbation);
+        };
+
+        run_levels_parallel(n_thread, IdxRange{symbolic.chain_level_begin()}, [&](Idx pivot_row_col, Idx thread_number) {
+            bool has_pivot_perturbation{false};
+            factorize_pulled_pivot(pivot_row_col, has_pivot_perturbation);
+            thread_has_pivot_perturbation[thread_number] |= static_cast<uint8_t>(has_pivot_perturbation);
+        });
+        for (Idx level = symbolic.chain_level_begin(); level != symbolic.n_levels(); ++level) {
+            for (Idx const pivot_row_col : symbolic.level_pivots(level)) {
+                factorize_pulled_pivot(pivot_row_col, has_pivot_perturbation_);
+            }
         }
+        has_pivot_perturbation_ =
+            has_pivot_perturbation_ || std::ranges::any_of(thread_has_pivot_perturbation, std::identity{});
     }
 
-  private:
-    static constexpr Idx linear_search_threshold = 16;
+    // Refactorize the given pivots, which are closed under the parent in the elimination tree.
+    // All rows and columns used by the updates of these pivots belong to these pivots as well.
+    // The other pivots keep their factors, because none of their descendants changed.
+    void refactorize_pivots(std::vector<Tensor> const& matrix, IdxVector const& pivots, std::vector<Tensor>& lu_matrix,
+                            BlockPermArray& block_perm_array) {
+        SparseLUSymbolic const& symbolic = *symbolic_;
+        IdxVector const& transpose_entry = symbolic.transpose_entry();
+
+        // for block matrix
+        // undo the permutation of the L's in the left of the pivot and the U's above the pivot
+        // L_k,pivot = P_pivot^-1 * L_k,pivot    k < pivot
+        // U_pivot,k = U_pivot,k * Q_pivot^-1    k < pivot
+        if constexpr (is_block) {
+            for (Idx const pivot_row_col : pivots) {
+                BlockPerm const& block_perm = block_perm_array[pivot_row_col];
+                for (Idx l_idx = row_indptr_[pivot_row_col]; l_idx < diag_lu_[pivot_row_col]; ++l_idx) {
+                    lu_matrix[l_idx] = (block_perm.p.transpose() * lu_matrix[l_idx].matrix()).array();
+                    Idx const u_idx = transpose_entry[l_idx];
+                    lu_matrix[u_idx] = (lu_matrix[u_idx].matrix() * block_perm.q.transpose()).array();
+                }
+            }
+        }
+        for (Idx const pivot_row_col : pivots) {
+            // restore the entries owned by the pivot from the new matrix
+            for (Idx u_idx = diag_lu_[pivot_row_col]; u_idx < row_indptr_[pivot_row_col + 1]; ++u_idx) {
+                lu_matrix[u_idx] = matrix[u_idx];
+                lu_matrix[transpose_entry[u_idx]] = matrix[transpose_entry[u_idx]];
+            }
+        }
+        for (Idx const pivot_row_col : pivots) {
+            for (auto const& update : symbolic.pull_updates(pivot_row_col)) {
+                lu_matrix[update.target] -= dot(lu_matrix[update.l_entry], lu_matrix[update.u_entry]);
+            }
+            factorize_pivot(lu_matrix, block_perm_array, pivot_row_col, 0.0, false, has_pivot_perturbation_);
+        }
+    }
 
-    Idx size_;
-    Idx nnz_; // number of non zeroes (in block)
-    std::span<Idx const> row_indptr_;
-    std::span<Idx const> col_indices_;
-    std::span<Idx const> diag_lu_;
-    // cache value for pivot perturbation for the factorize step
-    bool has_pivot_perturbation_{false};
-    double matrix_norm_{};
-    std::optional<std::vector<Tensor>> original_matrix_;
-    // cache value for iterative refinement for the solve step
-    std::optional<std::vector<XVector>> dx_;
-    std::optional<std::vector<RHSVector>> residual_;
-    std::optional<std::vector<RHSVector>> rhs_;
+    // Run the function for all rows/columns in the levels, in the order of the levels.
+    // The rows/columns of a level are distributed round-robin over the threads. The threads wait for each other
+    // between the levels. The first exception is re-thrown after all threads are finished.
+    // The threads are kept alive between the calls, because this runs for every factorization and every solve.
+    template <std::ranges::range Levels, typename Func>
+    void run_levels_parallel(Idx n_thread, Levels const& levels, Func const& func) const {
+        SparseLUSymbolic const& symbolic = *symbolic_;
+        std::barrier level_barrier{static_cast<std::ptrdiff_t>(n_thread)};
+        std::vector<std::exception_ptr> thread_exceptions(n_thread);
+        std::atomic<bool> failed{false};
+
+        auto const run_thread = [&](Idx thread_number) {
+            for (Idx const level : levels) {
+                if (!failed.load(std::memory_order_relaxed)) {
+                    try {
+                        auto const pivots = symbolic.level_pivots(level);
+                        for (Idx position = thread_number; position < std::ssize(pivots); position += n_thread) {
+                            func(pivots[position], thread_number);
+                        }
+                    } catch (...) { // NOSONAR(S2738)
+                        thread_exceptions[thread_number] = std::current_exception();
+                        failed.store(true, std::memory_order_relaxed);
+                    }
+                }
+                level_barrier.arrive_and_wait();
+            }
+        };
+        std::atomic<Idx> next_thread_number{0};
+        level_threads_->get(n_thread).run(
+            n_thread, [&] { run_thread(next_thread_number.fetch_add(1, std::memory_order_relaxed)); });
+
+        if (auto const first_failed =
+                std::ranges::find_if(thread_exceptions, [](auto const& ex) { return ex != nullptr; });
+            first_failed != thread_exceptions.end()) {
+            std::rethrow_exception(*first_failed);
+        }
+    }
+
+    // Factorize the pivot of which all Schur-complement updates are already applied.
+    // This calculates the pivot block itself, the U blocks in the right of it and the L blocks below it.
+    void factorize_pivot(std::vector<Tensor>& lu_matrix, BlockPermArray& block_perm_array, Idx pivot_row_col,
+                         double perturb_threshold, bool use_pivot_perturbation, bool& has_pivot_perturbation) const {
+        Idx const pivot_idx = diag_lu_[pivot_row_col];
+        IdxVector const& transpose_entry = symbolic_->transpose_entry();
+
+        // Dense LU factorize pivot for block matrix in-place
+        // A_pivot,pivot, becomes P_pivot^-1 * L_pivot * U_pivot * Q_pivot^-1
+        // return reference to pivot permutation
+        BlockPerm const& block_perm = [&]() -> std::conditional_t<is_block, BlockPerm const&, BlockPerm> {
+            if constexpr (is_block) {
+                // use machine precision by default
+                // record block permutation
+                auto pivot_matrix = lu_matrix[pivot_idx].matrix();
+                LUFactor::factorize_block_in_place(pivot_matrix, block_perm_array[pivot_row_col], perturb_threshold,
+                                                   use_pivot_perturbation, has_pivot_perturbation);
+                return block_perm_array[pivot_row_col];
+            } else {
+                if (use_pivot_perturbation) {
+                    // use machine precision by default
+                    // record pivot perturbation
+                    double abs_pivot = cabs(lu_matrix[pivot_idx]);
+                    perturb_pivot_if_needed(perturb_threshold, lu_matrix[pivot_idx], abs_pivot,
+                                            has_pivot_perturbation);
+                }
+                if (!is_normal(lu_matrix[pivot_idx])) {
+                    throw SparseMatrixError{};
+                }
+                return {};
+            }
+        }();
+        // reference to pivot
+        Tensor const& pivot = lu_matrix[pivot_idx];
+
+        // for block matrix
+        // permute rows of L's in the left of the pivot
+        // L_k,pivot = P_pivot * L_k,pivot    k < pivot
+        // permute columns of U's above the pivot
+        // U_pivot,k = U_pivot,k * Q_pivot    k < pivot
+        if constexpr (is_block) {
+            // loop rows and columns at the same time
+            // since the matrix is symmetric
+            for (Idx l_idx = row_indptr_[pivot_row_col]; l_idx < pivot_idx; ++l_idx) {
+                // permute rows of L_k,pivot
+                lu_matrix[l_idx] = (block_perm.p * lu_matrix[l_idx].matrix()).array();
+                // get idx of u
+                Idx const u_idx = transpose_entry[l_idx];
+                assert(col_indices_[u_idx] == pivot_row_col);
+                // permute columns of U_pivot,k
+                lu_matrix[u_idx] = (lu_matrix[u_idx].matrix() * block_perm.q).array();
+            }
+        }
+
+        // for block matrix
+        // calculate U blocks in the right of the pivot, in-place
+        // L_pivot * U_pivot,k = P_pivot * A_pivot,k       k > pivot
+        if constexpr (is_block) {
+            for (Idx u_idx = pivot_idx + 1; u_idx < row_indptr_[pivot_row_col + 1]; ++u_idx) {
+                Tensor& u = lu_matrix[u_idx];
+                // permutation
+                u = (block_perm.p * u.matrix()).array();
+                // forward substitution (left,lower solve), per row in u
+                LUFactor::template triangular_solve_inplace<TriangularSolveSide::left, TriangularFactor::lower>(
+                    pivot.matrix(), u);
+            }
+        }
+
+        // Calculate L blocks below the pivot
+        // Because the matrix is symmetric,
+        //    looking for col_indices at pivot_row_col, starting from the diagonal (pivot_row_col, pivot_row_col)
+        //    we get also the non-zero row indices under the pivot
+        for (Idx l_ref_idx = pivot_idx + 1; l_ref_idx < row_indptr_[pivot_row_col + 1]; ++l_ref_idx) {
+            // index of l in corresponding row
+            Idx const l_idx = transpose_entry[l_ref_idx];
+            assert(col_indices_[l_idx] == pivot_row_col);
+            // calculating l at (l_row, pivot_row_col)
+            if constexpr (is_block) {
+                // for block matrix
+                // calculate L blocks below the pivot, in-place
+                // L_k,pivot * U_pivot = A_k_pivot * Q_pivot    k > pivot
+                Tensor& l = lu_matrix[l_idx];
+                // permutation
+                l = (l.matrix() * block_perm.q).array();
+                // forward substitution, per column in l
+                // l0 = [l00, l10]^T
+                // l1 = [l01, l11]^T
+                // l = [l0, l1]
+                // a = [a0, a1]
+                // u = [[u00, u01]
+                //      [0  , u11]]
+                // l * u = a
+                // l0 * u00 = a0
+                // l0 * u01 + l1 * u11 = a1
+                LUFactor::template triangular_solve_inplace<TriangularSolveSide::right, TriangularFactor::upper>(
+                    pivot.matrix(), l);
+            } else {
+                // for scalar matrix, just divide
+                // L_k,pivot = A_k,pivot / U_pivot    k > pivot
+                lu_matrix[l_idx] = lu_matrix[l_idx] / pivot;
+            }
+        }
+    }
 
     void solve_with_refinement(std::vector<Tensor> const& data,        // pre-factorized data, const ref
                                BlockPermArray const& block_perm_array, // pre-calculated permutation, const ref
@@ -774,7 +1180,7 @@ template <class Tensor, class RHSVector, class XVector> class SparseLUSolver {
         auto const& lu_matrix = data;
 
         // forward substitution with L
-        for (Idx row = 0; row != size_; ++row) {
+        auto const forward_substitute_row = [&](Idx row) {
             // permutation if needed
             if constexpr (is_block) {
                 x[row] = (block_perm_array[row].p * rhs[row].matrix()).array();
@@ -796,10 +1202,10 @@ template <class Tensor, class RHSVector, class XVector> class SparseLUSolver {
                 LUFactor::template triangular_solve_inplace<TriangularSolveSide::left, TriangularFactor::lower>(
                     pivot.matrix(), x[row]);
             }
-        }
+        };
 
         // backward substitution with U
-        for (Idx row = size_ - 1; row != -1; --row) {
+        auto const backward_substitute_row = [&](Idx row) {
             // loop all columns from diagonal
             for (Idx u_idx = row_indptr_[row + 1] - 1; u_idx > diag_lu[row]; --u_idx) {
                 Idx const col = col_indices_[u_idx];
@@ -817,6 +1223,31 @@ template <class Tensor, class RHSVector, class XVector> class SparseLUSolver {
             } else {
                 x[row] = x[row] / lu_matrix[diag_lu[row]];
             }
+        };
+
+        if (Idx const n_thread = effective_n_threads(); n_thread > 1) {
+            // a row only depends on its descendants in the elimination tree in the forward substitution
+            //    and on its ancestors in the backward substitution
+            SparseLUSymbolic const& symbolic = *symbolic_;
+            IdxRange const chain_levels{symbolic.chain_level_begin(), symbolic.n_levels()};
+            IdxRange const parallel_levels{symbolic.chain_level_begin()};
+            run_levels_parallel(n_thread, parallel_levels,
+                                [&](Idx row, Idx /* thread_number */) { forward_substitute_row(row); });
+            for (Idx const level : chain_levels) {
+                std::ranges::for_each(symbolic.level_pivots(level), forward_substitute_row);
+            }
+            for (Idx const level : chain_levels | std::views::reverse) {
+                std::ranges::for_each(symbolic.level_pivots(level), backward_substitute_row);
+            }
+            run_levels_parallel(n_thread, parallel_levels | std::views::reverse,
+                                [&](Idx row, Idx /* thread_number */) { backward_substitute_row(row); });
+        } else {
+            for (Idx row = 0; row != size_; ++row) {
+                forward_substitute_row(row);
+            }
+            for (Idx row = size_ - 1; row != -1; --row) {
+                backward_substitute_row(row);
+            }
         }
         // restore permutation for block matrix
         if constexpr (is_block) {
@@ -10,9 +10,11 @@
 #include "../common/enum.hpp"
 #include "../common/grouped_index_vector.hpp"
 #include "../common/three_phase_tensor.hpp"
+#include "sparse_lu_solver.hpp"
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cassert>
 #include <concepts>
 #include <cstddef>
@@ -22,7 +24,6 @@
 #include <memory>
 #include <numeric>
 #include <ranges>
-#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -117,6 +118,8 @@ struct YBusStructure {
     // for lu_transpose_entry[i] indicates the position i-th element in transposed lu matrix in CSR form
     // for entry in the diagonal lu_transpose_entry[i] = i
     IdxVector lu_transpose_entry;
+    // symbolic factorization of the LU structure, shared by all sparse LU solvers of this structure
+    std::shared_ptr<SparseLUSymbolic const> lu_symbolic;
 
     // construct ybus structure
     explicit YBusStructure(MathModelTopology const& topo) {
@@ -290,14 +293,14 @@ struct YBusStructure {
             lu_transpose_entry[entry_1] = entry_2;
             lu_transpose_entry[entry_2] = entry_1;
         }
+
+        lu_symbolic = std::make_shared<SparseLUSymbolic const>(row_indptr_lu, col_indices_lu, diag_lu);
     }
 };
 
 // See also "Node Admittance Matrix" in "State Estimation Alliander"
 template <symmetry_tag sym> class YBus {
   public:
-    using ParamChangedCallback = std::function<void(bool param_changed)>;
-
     YBus(MathModelTopology const& topo, MathModelParam<sym> param,
          std::shared_ptr<YBusStructure const> const& y_bus_struct = {})
         : math_topology_{topo} {
@@ -333,12 +336,29 @@ template <symmetry_tag sym> class YBus {
     IdxVector const& bus_entry() const { return y_bus_structure().bus_entry; }
     IdxVector const& lu_diag() const { return y_bus_structure().diag_lu; }
     IdxVector const& map_lu_y_bus() const { return y_bus_structure().map_lu_y_bus; }
+    std::shared_ptr<SparseLUSymbolic const> const& lu_symbolic() const { return y_bus_structure().lu_symbolic; }
 
     std::shared_ptr<YBusStructure const> shared_y_bus_structure() const {
         assert(y_bus_struct_ != nullptr);
         return y_bus_struct_;
     }
 
+    // identifies the admittance values, including the source admittances which are not part of the y bus entries
+    // every change gets a new, unique version, and a copy of the y bus keeps the version of the original
+    // so a solver that caches a factorization can detect a change by comparing the version, also when the y bus and
+    //    the solver are copied together, e.g., for another thread of a batch calculation
+    uint64_t admittance_version() const { return admittance_version_; }
+
+    // number of threads the sparse LU solvers of this y bus may use, 1 for sequential
+    // the threads are the level threads of the model, see SparseLULevelThreads
+    Idx sparse_lu_threads() const { return sparse_lu_threads_; }
+    SparseLULevelThreads* sparse_lu_level_threads() const { return sparse_lu_level_threads_; }
+    void set_sparse_lu_threads(Idx n_threads, SparseLULevelThreads& level_threads) {
+        assert(n_threads >= 1);
+        sparse_lu_threads_ = n_threads;
+        sparse_lu_level_threads_ = &level_threads;
+    }
+
     void update_admittance(MathModelParam<sym> math_model_param) {
         assert(y_bus_struct_ != nullptr);
 
@@ -390,6 +410,10 @@ template <symmetry_tag sym> class YBus {
              std::views::zip(math_model_param_incrmt.source_param_to_change, math_model_param_incrmt.source_param)) {
             math_model_param_.source_param[idx_to_change] = params;
         }
+        // source admittances are not part of the y bus entries, but solvers may include them in their matrices
+        if (!math_model_param_incrmt.source_param_to_change.empty()) {
+            admittance_changed();
+        }
 
         // process and update affected entries
         update_admittance_entries(by_ref(get_affected_admittance_entries(math_model_param_incrmt)));
@@ -406,7 +430,7 @@ template <symmetry_tag sym> class YBus {
         auto const& math_param_branch = math_model_param_.branch_param;
 
         if (!std::ranges::empty(y_bus_entries)) {
-            parameters_changed(true);
+            admittance_changed();
         }
 
         for (auto const entry : y_bus_entries) {
@@ -545,27 +569,6 @@ template <symmetry_tag sym> class YBus {
         return shunt_flow;
     }
 
-    /// @brief register a new callback to signal a parameter change
-    /// @param callback the callback to register
-    /// @return the unique key referencing this callback (used for unregistering)
-    uint64_t register_parameters_changed_callback(ParamChangedCallback callback) {
-        static uint64_t num_added = 0;
-
-        auto const new_key = num_added;
-        ++num_added;
-
-        assert(!parameters_changed_callbacks_.contains(new_key));
-        parameters_changed_callbacks_.emplace_hint(parameters_changed_callbacks_.cend(), new_key, std::move(callback));
-        return new_key;
-    }
-
-    /// @brief unregister a callback to signal a parameter change
-    /// @param key the unique key referencing the callback (returned by register_parameters_changed_callback)
-    void unregister_parameters_changed_callback(uint64_t key) {
-        assert(parameters_changed_callbacks_.contains(key));
-        parameters_changed_callbacks_.erase(key);
-    }
-
   private:
     // csr structure
     std::shared_ptr<YBusStructure const> y_bus_struct_;
@@ -582,12 +585,14 @@ template <symmetry_tag sym> class YBus {
     std::vector<IdxVector> y_bus_entries_per_branch_;
     std::vector<IdxVector> y_bus_entries_per_shunt_;
 
-    std::unordered_map<uint64_t, ParamChangedCallback> parameters_changed_callbacks_;
+    uint64_t admittance_version_{};
+
+    Idx sparse_lu_threads_{1};
+    SparseLULevelThreads* sparse_lu_level_threads_{};
 
-    void parameters_changed(bool param_changed) const {
-        std::ranges::for_each(parameters_changed_callbacks_, [param_changed](auto const& key_and_callback) {
-            key_and_callback.second(param_changed);
-        });
+    void admittance_changed() {
+        static std::atomic<uint64_t> last_admittance_version{0};
+        admittance_version_ = last_admittance_version.fetch_add(1, std::memory_order_relaxed) + 1;
     }
 };
 
@@ -6,10 +6,14 @@
 
 #include "common/common.hpp"
 #include "common/counting_iterator.hpp"
+#include "common/enum.hpp"
+#include "common/exception.hpp"
 
 #include <algorithm>
 #include <cassert>
+#include <iterator>
 #include <map>
+#include <numeric>
 #include <set>
 #include <tuple>
 #include <utility>
@@ -178,6 +182,382 @@ inline IdxVector remove_vertices_update_degrees(Idx const u, std::map<Idx, IdxVe
 
     return alpha;
 }
+
+// symmetric adjacency of a graph in compressed sparse row format, without self loops
+// vertices are referred to by their position in the sorted list of original vertex ids
+struct CompressedGraph {
+    IdxVector vertices;
+    IdxVector indptr;
+    IdxVector indices;
+
+    Idx size() const { return std::ssize(vertices); }
+};
+
+inline CompressedGraph compress_graph(std::map<Idx, IdxVector> const& d) {
+    CompressedGraph graph;
+    std::vector<std::pair<Idx, Idx>> edges;
+    for (auto const& [k, adjacent] : d) {
+        graph.vertices.push_back(k);
+        for (Idx const e : adjacent) {
+            graph.vertices.push_back(e);
+            if (e != k) {
+                edges.emplace_back(k, e);
+                edges.emplace_back(e, k);
+            }
+        }
+    }
+    std::ranges::sort(graph.vertices);
+    auto const duplicate_vertices = std::ranges::unique(graph.vertices);
+    graph.vertices.erase(duplicate_vertices.begin(), duplicate_vertices.end());
+
+    auto const position = [&vertices = graph.vertices](Idx id) {
+        return static_cast<Idx>(std::ranges::lower_bound(vertices, id) - vertices.begin());
+    };
+    for (auto& [from, to] : edges) {
+        from = position(from);
+        to = position(to);
+    }
+    std::ranges::sort(edges);
+    auto const duplicate_edges = std::ranges::unique(edges);
+    edges.erase(duplicate_edges.begin(), duplicate_edges.end());
+
+    graph.indptr.assign(graph.size() + 1, 0);
+    graph.indices.reserve(edges.size());
+    for (auto const& [from, to] : edges) {
+        ++graph.indptr[from + 1];
+        graph.indices.push_back(to);
+    }
+    std::partial_sum(graph.indptr.cbegin(), graph.indptr.cend(), graph.indptr.begin());
+    return graph;
+}
+
+// Approximate minimum degree ordering (Amestoy, Davis and Duff) on a quotient graph in flat arrays.
+//
+// Eliminated variables become elements, representing the clique they would create, so no fill-in is ever
+// constructed explicitly. The list of a variable contains its adjacent elements first, then its adjacent variables;
+// the lists of all vertices live in one contiguous array. On elimination of a pivot:
+//    - the elements adjacent to the pivot are absorbed into the new element
+//    - other elements that are completely covered by the new element are absorbed as well (aggressive absorption)
+//    - variables that are only adjacent to the new element are eliminated together with the pivot (mass elimination)
+//    - indistinguishable variables are merged into supervariables that are eliminated at once
+//    - the degrees of the affected variables are updated with the approximate (upper bound) external degree
+class ApproximateMinimumDegree {
+  public:
+    explicit ApproximateMinimumDegree(CompressedGraph const& graph)
+        : n_{graph.size()},
+          list_{graph.indices},
+          begin_(graph.indptr.cbegin(), graph.indptr.cend() - 1),
+          length_(n_),
+          n_elements_(n_, 0),
+          status_(n_, VertexStatus::variable),
+          weight_(n_, 1),
+          degree_(n_),
+          external_degree_(n_, 0),
+          outside_(n_, 0),
+          mark_(n_, none),
+          head_(n_ + 1, none),
+          next_(n_, none),
+          prev_(n_, none),
+          member_next_(n_, none),
+          member_tail_(n_) {
+        std::iota(member_tail_.begin(), member_tail_.end(), Idx{0});
+        for (Idx const i : IdxRange{n_}) {
+            length_[i] = graph.indptr[i + 1] - graph.indptr[i];
+            degree_[i] = length_[i];
+            insert_degree(i);
+        }
+    }
+
+    // elimination order, by vertex position in the compressed graph
+    IdxVector run() && {
+        IdxVector order;
+        order.reserve(n_);
+        Idx min_degree = 0;
+        while (std::ssize(order) < n_) {
+            while (head_[min_degree] == none) {
+                ++min_degree;
+            }
+            Idx const pivot = head_[min_degree];
+            remove_degree(pivot);
+            append_members(pivot, order);
+
+            create_element(pivot);
+            update_element_variables(pivot, order);
+            merge_indistinguishable_variables(pivot);
+            min_degree = std::min(min_degree, finalize_element(pivot, std::ssize(order)));
+        }
+        return order;
+    }
+
+  private:
+    enum class VertexStatus : IntS { variable, element, absorbed, merged, eliminated };
+
+    static constexpr Idx none{-1};
+
+    Idx n_;
+    IdxVector list_; // adjacency lists of all vertices, new elements are appended at the end
+    IdxVector begin_;
+    IdxVector length_;
+    IdxVector n_elements_; // number of elements at the front of the list of a variable
+    std::vector<VertexStatus> status_;
+    IdxVector weight_;          // number of original variables in a supervariable, negative if in the new element
+    IdxVector degree_;          // approximate external degree of a variable, size of an element
+    IdxVector external_degree_; // degree of a variable outside of the new element
+    IdxVector outside_;         // size of an element outside of the new element
+    IdxVector mark_;
+    Idx stamp_{0};
+    // doubly linked lists of variables per degree
+    IdxVector head_;
+    IdxVector next_;
+    IdxVector prev_;
+    // singly linked lists of original variables per supervariable
+    IdxVector member_next_;
+    IdxVector member_tail_;
+    std::vector<std::pair<Idx, Idx>> hashes_;
+
+    void insert_degree(Idx i) {
+        Idx const first = head_[degree_[i]];
+        next_[i] = first;
+        prev_[i] = none;
+        if (first != none) {
+            prev_[first] = i;
+        }
+        head_[degree_[i]] = i;
+    }
+
+    void remove_degree(Idx i) {
+        if (prev_[i] != none) {
+            next_[prev_[i]] = next_[i];
+        } else {
+            head_[degree_[i]] = next_[i];
+        }
+        if (next_[i] != none) {
+            prev_[next_[i]] = prev_[i];
+        }
+    }
+
+    void append_members(Idx i, IdxVector& order) const {
+        for (Idx member = i; member != none; member = member_next_[member]) {
+            order.push_back(member);
+        }
+    }
+
+    void add_to_new_element(Idx i) {
+        if (status_[i] == VertexStatus::variable && weight_[i] > 0) {
+            weight_[i] = -weight_[i];
+            remove_degree(i);
+            list_.push_back(i);
+        }
+    }
+
+    // the new element is the union of the variables adjacent to the pivot and the variables of its adjacent elements
+    void create_element(Idx pivot) {
+        Idx const new_begin = std::ssize(list_);
+        weight_[pivot] = -weight_[pivot];
+        for (Idx k = begin_[pivot]; k != begin_[pivot] + length_[pivot]; ++k) {
+            Idx const vertex = list_[k];
+            if (k >= begin_[pivot] + n_elements_[pivot]) {
+                add_to_new_element(vertex);
+            } else if (status_[vertex] == VertexStatus::element) {
+                for (Idx m = begin_[vertex]; m != begin_[vertex] + length_[vertex]; ++m) {
+                    add_to_new_element(list_[m]);
+                }
+                status_[vertex] = VertexStatus::absorbed;
+            }
+        }
+        status_[pivot] = VertexStatus::element;
+        begin_[pivot] = new_begin;
+        length_[pivot] = std::ssize(list_) - new_begin;
+        n_elements_[pivot] = 0;
+    }
+
+    // prune the lists of the variables in the new element, compute their external degrees and mass eliminate
+    void update_element_variables(Idx pivot, IdxVector& order) {
+        Idx const element_begin = begin_[pivot];
+        Idx const element_end = element_begin + length_[pivot];
+
+        // sizes of the other adjacent elements outside of the new element
+        ++stamp_;
+        for (Idx k = element_begin; k != element_end; ++k) {
+            Idx const i = list_[k];
+            for (Idx m = begin_[i]; m != begin_[i] + n_elements_[i]; ++m) {
+                Idx const e = list_[m];
+                if (status_[e] != VertexStatus::element) {
+                    continue;
+                }
+                if (mark_[e] != stamp_) {
+                    mark_[e] = stamp_;
+                    outside_[e] = degree_[e];
+                }
+                outside_[e] += weight_[i]; // weight is negative inside the new element
+            }
+        }
+
+        for (Idx k = element_begin; k != element_end; ++k) {
+            Idx const i = list_[k];
+            Idx const first = begin_[i];
+            Idx out = first;
+            Idx external_degree = 0;
+            for (Idx m = first; m != first + n_elements_[i]; ++m) {
+                Idx const e = list_[m];
+                if (status_[e] != VertexStatus::element) {
+                    continue;
+                }
+                if (outside_[e] == 0) {
+                    status_[e] = VertexStatus::absorbed;
+                    continue;
+                }
+                external_degree += outside_[e];
+                list_[out++] = e;
+            }
+            Idx const n_elements = out - first;
+            for (Idx m = first + n_elements_[i]; m != first + length_[i]; ++m) {
+                Idx const j = list_[m];
+                // variables in the new element are reachable through it
+                if (status_[j] != VertexStatus::variable || weight_[j] <= 0) {
+                    continue;
+                }
+                external_degree += weight_[j];
+                list_[out++] = j;
+            }
+            // the pivot or an absorbed element was removed from the list, which leaves room for the new element
+            assert(out < first + length_[i]);
+            std::shift_right(list_.begin() + first + n_elements, list_.begin() + out + 1, 1);
+            list_[first + n_elements] = pivot;
+            n_elements_[i] = n_elements + 1;
+            length_[i] = out + 1 - first;
+            external_degree_[i] = external_degree;
+
+            if (length_[i] == 1) {
+                // only adjacent to the new element: indistinguishable from the pivot
+                append_members(i, order);
+                status_[i] = VertexStatus::eliminated;
+                weight_[i] = 0;
+            }
+        }
+    }
+
+    void merge_indistinguishable_variables(Idx pivot) {
+        Idx const element_begin = begin_[pivot];
+        Idx const element_end = element_begin + length_[pivot];
+
+        hashes_.clear();
+        for (Idx k = element_begin; k != element_end; ++k) {
+            Idx const i = list_[k];
+            if (status_[i] == VertexStatus::variable) {
+                hashes_.emplace_back(std::reduce(list_.cbegin() + begin_[i], list_.cbegin() + begin_[i] + length_[i]),
+                                     i);
+            }
+        }
+        std::ranges::sort(hashes_);
+
+        for (auto same_hash_begin = hashes_.cbegin(); same_hash_begin != hashes_.cend();) {
+            auto const same_hash_end = std::find_if(same_hash_begin, hashes_.cend(), [&same_hash_begin](auto const& h) {
+                return h.first != same_hash_begin->first;
+            });
+            for (auto it = same_hash_begin; it != same_hash_end; ++it) {
+                Idx const i = it->second;
+                if (status_[i] != VertexStatus::variable) {
+                    continue;
+                }
+                ++stamp_;
+                for (Idx m = begin_[i]; m != begin_[i] + length_[i]; ++m) {
+                    mark_[list_[m]] = stamp_;
+                }
+                for (auto other = std::next(it); other != same_hash_end; ++other) {
+                    Idx const j = other->second;
+                    if (status_[j] == VertexStatus::variable && length_[j] == length_[i] &&
+                        n_elements_[j] == n_elements_[i] &&
+                        std::all_of(list_.cbegin() + begin_[j], list_.cbegin() + begin_[j] + length_[j],
+                                    [this](Idx v) { return mark_[v] == stamp_; })) {
+                        merge_variable(i, j);
+                    }
+                }
+            }
+            same_hash_begin = same_hash_end;
+        }
+    }
+
+    void merge_variable(Idx into, Idx from) {
+        weight_[into] += weight_[from];
+        weight_[from] = 0;
+        status_[from] = VertexStatus::merged;
+        length_[from] = 0;
+        n_elements_[from] = 0;
+        member_next_[member_tail_[into]] = from;
+        member_tail_[into] = member_tail_[from];
+    }
+
+    // keep the principal variables in the new element and update their degrees, returns the lowest new degree
+    Idx finalize_element(Idx pivot, Idx n_eliminated) {
+        Idx const element_begin = begin_[pivot];
+        Idx out = element_begin;
+        Idx element_size = 0;
+        for (Idx k = element_begin; k != element_begin + length_[pivot]; ++k) {
+            Idx const i = list_[k];
+            if (status_[i] == VertexStatus::variable) {
+                list_[out++] = i;
+                element_size -= weight_[i];
+            }
+        }
+        length_[pivot] = out - element_begin;
+        degree_[pivot] = element_size;
+
+        Idx min_degree = n_;
+        for (Idx k = element_begin; k != out; ++k) {
+            Idx const i = list_[k];
+            weight_[i] = -weight_[i];
+            Idx const rest_of_element = element_size - weight_[i];
+            degree_[i] = std::max(Idx{0}, std::min({degree_[i] + rest_of_element,
+                                                    external_degree_[i] + rest_of_element,
+                                                    n_ - n_eliminated - weight_[i]}));
+            insert_degree(i);
+            min_degree = std::min(min_degree, degree_[i]);
+        }
+        return min_degree;
+    }
+};
+
+// exact symbolic elimination of the graph in the given order, using the elimination tree
+// returns the fill-in edges as pairs of vertex positions, the first one being eliminated first
+inline std::vector<std::pair<Idx, Idx>> symbolic_fill_in(CompressedGraph const& graph, IdxVector const& order) {
+    Idx const n = graph.size();
+    IdxVector position(n);
+    for (Idx const k : IdxRange{n}) {
+        position[order[k]] = k;
+    }
+
+    std::vector<IdxVector> inherited(n); // structure inherited from the children in the elimination tree
+    IdxVector mark(n, -1);
+    IdxVector structure;
+    std::vector<std::pair<Idx, Idx>> fills;
+    for (Idx const k : IdxRange{n}) {
+        Idx const vertex = order[k];
+        structure.clear();
+        for (Idx m = graph.indptr[vertex]; m != graph.indptr[vertex + 1]; ++m) {
+            if (Idx const later = position[graph.indices[m]]; later > k) {
+                mark[later] = k;
+                structure.push_back(later);
+            }
+        }
+        for (Idx const later : inherited[k]) {
+            if (mark[later] != k) {
+                mark[later] = k;
+                structure.push_back(later);
+                fills.emplace_back(vertex, order[later]);
+            }
+        }
+        IdxVector{}.swap(inherited[k]);
+
+        if (structure.empty()) {
+            continue;
+        }
+        Idx const parent = std::ranges::min(structure);
+        std::ranges::copy_if(structure, std::back_inserter(inherited[parent]),
+                             [parent](Idx later) { return later != parent; });
+    }
+    return fills;
+}
 } // namespace detail
 
 inline std::pair<IdxVector, std::vector<std::pair<Idx, Idx>>> minimum_degree_ordering(std::map<Idx, IdxVector> d) {
@@ -217,4 +597,36 @@ inline std::pair<IdxVector, std::vector<std::pair<Idx, Idx>>> minimum_degree_ord
     }
     return {alpha, fills};
 }
+
+inline std::pair<IdxVector, std::vector<std::pair<Idx, Idx>>>
+approximate_minimum_degree_ordering(std::map<Idx, IdxVector> const& d) {
+    detail::CompressedGraph const graph = detail::compress_graph(d);
+
+    IdxVector alpha = detail::ApproximateMinimumDegree{graph}.run();
+    std::vector<std::pair<Idx, Idx>> fills = detail::symbolic_fill_in(graph, alpha);
+
+    // back to the original vertex ids
+    for (Idx& vertex : alpha) {
+        vertex = graph.vertices[vertex];
+    }
+    for (auto& [from, to] : fills) {
+        from = graph.vertices[from];
+        to = graph.vertices[to];
+    }
+    return {std::move(alpha), std::move(fills)};
+}
+
+inline std::pair<IdxVector, std::vector<std::pair<Idx, Idx>>> sparse_ordering(std::map<Idx, IdxVector> d,
+                                                                              SparseOrderingMethod method) {
+    using enum SparseOrderingMethod;
+
+    switch (method) {
+    case minimum_degree:
+        return minimum_degree_ordering(std::move(d));
+    case approximate_minimum_degree:
+        return approximate_minimum_degree_ordering(d);
+    default:
+        throw MissingCaseForEnumError{"sparse_ordering", method};
+    }
+}
 } // namespace power_grid_model
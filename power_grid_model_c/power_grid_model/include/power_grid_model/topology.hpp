@@ -124,9 +124,11 @@ class Topology {
     };
 
   public:
-    Topology(ReducedComponentTopology const& comp_topo, ComponentConnections const& comp_conn)
+    Topology(ReducedComponentTopology const& comp_topo, ComponentConnections const& comp_conn,
+             SparseOrderingMethod sparse_ordering_method = SparseOrderingMethod::minimum_degree)
         : comp_topo_{comp_topo},
           comp_conn_{comp_conn},
+          sparse_ordering_method_{sparse_ordering_method},
           phase_shift_(comp_topo_.n_node_total(), 0.0),
           predecessors_(
               boost::counting_iterator<GraphIdx>{0}, // Predecessors is initialized as 0, 1, 2, ..., n_node_total() - 1
@@ -159,6 +161,7 @@ class Topology {
     // input
     ReducedComponentTopology const& comp_topo_; // NOLINT(cppcoreguidelines-avoid-const-or-ref-data-members)
     ComponentConnections const& comp_conn_;     // NOLINT(cppcoreguidelines-avoid-const-or-ref-data-members)
+    SparseOrderingMethod sparse_ordering_method_;
 
     // intermediate
     GlobalGraph global_graph_;
@@ -297,7 +300,7 @@ class Topology {
         }
     }
 
-    // re-order dfs_node using minimum degree
+    // re-order dfs_node using the (approximate) minimum degree ordering
     // return list of fill-ins when factorize the matrix
     std::vector<BranchIdx> reorder_node(std::vector<Idx>& dfs_node,
                                         std::vector<std::pair<GraphIdx, GraphIdx>> const& back_edges) {
@@ -349,7 +352,7 @@ class Topology {
             }
         }
 
-        auto [reordered, fills] = minimum_degree_ordering(std::move(unique_nearest_neighbours));
+        auto [reordered, fills] = sparse_ordering(std::move(unique_nearest_neighbours), sparse_ordering_method_);
 
         const auto n_non_cyclic_nodes = static_cast<Idx>(dfs_node.size());
         std::map<Idx, Idx> permuted_node_indices;
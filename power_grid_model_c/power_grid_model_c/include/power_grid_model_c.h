@@ -29,12 +29,14 @@
 // IWYU pragma: begin_keep
 #include "power_grid_model_c/basics.h"
 #include "power_grid_model_c/buffer.h"
+#include "power_grid_model_c/calculation_info.h"
 #include "power_grid_model_c/dataset.h"
 #include "power_grid_model_c/handle.h"
 #include "power_grid_model_c/meta_data.h"
 #include "power_grid_model_c/model.h"
 #include "power_grid_model_c/options.h"
 #include "power_grid_model_c/serialization.h"
+#include "power_grid_model_c/tracer.h"
 // IWYU pragma: end_keep
 
 #endif // POWER_GRID_MODEL_C_H
@@ -141,6 +141,18 @@ typedef struct PGM_WritableDataset PGM_WritableDataset;
  */
 typedef struct PGM_DatasetInfo PGM_DatasetInfo;
 
+/**
+ * @brief Opaque struct for the calculation info class.
+ * The calculation info collects the profiling information of the calculations of a model.
+ */
+typedef struct PGM_CalculationInfo PGM_CalculationInfo;
+
+/**
+ * @brief Opaque struct for the tracer class.
+ * The tracer records the timeline of the calculations of a model.
+ */
+typedef struct PGM_Tracer PGM_Tracer;
+
 // NOLINTEND(modernize-use-using)
 
 // NOLINTBEGIN(performance-enum-size,cppcoreguidelines-use-enum-class)
@@ -234,6 +246,26 @@ enum PGM_TapChangingStrategy {
         4, /**< adjust tap position automatically; optimize for any value in the voltage band; binary search */
 };
 
+/**
+ * @brief Enumeration of power flow initialization modes.
+ *
+ */
+enum PGM_PowerFlowInitialization {
+    PGM_pf_initialization_cold_start = 0, /**< start from the initial guess of the calculation method */
+    PGM_pf_initialization_warm_start =
+        1, /**< start from the previous converged solution of the same (sub)grid, if available */
+};
+
+/**
+ * @brief Enumeration of fill-reducing orderings of the sparse matrices.
+ *
+ */
+enum PGM_SparseOrdering {
+    PGM_sparse_ordering_minimum_degree = 0, /**< exact minimum degree ordering */
+    PGM_sparse_ordering_approximate_minimum_degree =
+        1, /**< approximate minimum degree ordering, faster to compute on large meshed grids */
+};
+
 /**
  * @brief Enumeration of experimental features.
  *
@@ -0,0 +1,125 @@
+// SPDX-FileCopyrightText: Contributors to the Power Grid Model project <powergridmodel@lfenergy.org>
+//
+// SPDX-License-Identifier: MPL-2.0
+
+/**
+ * @brief header file which includes calculation info functions
+ *
+ * The calculation info collects the profiling information of the calculations of a model,
+ * e.g., the time spent in each phase of the calculation and the number of iterations.
+ * Each entry is a pair of an event code and a value.
+ * The times are in seconds, the maximum number of iterations are kept for the iteration events
+ * and the values of all other events are summed.
+ * For batch calculations, the entries are also reported per scenario.
+ */
+
+#pragma once
+#ifndef POWER_GRID_MODEL_C_CALCULATION_INFO_H
+#define POWER_GRID_MODEL_C_CALCULATION_INFO_H
+
+#include "basics.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Create a calculation info instance.
+ *
+ * Use PGM_set_model_calculation_info() to collect the information of the calculations of a model.
+ *
+ * @param handle
+ * @return The pointer to the calculation info instance. Should be freed by PGM_destroy_calculation_info().
+ *     Returns NULL if errors occured (check the handle for error information).
+ */
+PGM_API PGM_CalculationInfo* PGM_create_calculation_info(PGM_Handle* handle) PGM_NOEXCEPT;
+
+/**
+ * @brief Free a calculation info instance.
+ *
+ * The calculation info should be detached from the models first.
+ *
+ * @param info The pointer to the calculation info instance created by PGM_create_calculation_info().
+ */
+PGM_API void PGM_destroy_calculation_info(PGM_CalculationInfo* info) PGM_NOEXCEPT;
+
+/**
+ * @brief Remove all collected information.
+ *
+ * @param handle
+ * @param info The pointer to the calculation info instance.
+ * @return
+ */
+PGM_API void PGM_calculation_info_clear(PGM_Handle* handle, PGM_CalculationInfo* info) PGM_NOEXCEPT;
+
+/**
+ * @brief Get the number of entries of the information aggregated over all calculations.
+ *
+ * @param handle
+ * @param info The pointer to the calculation info instance.
+ * @return The number of entries.
+ */
+PGM_API PGM_Idx PGM_calculation_info_n_entries(PGM_Handle* handle, PGM_CalculationInfo const* info) PGM_NOEXCEPT;
+
+/**
+ * @brief Get the entries of the information aggregated over all calculations.
+ *
+ * The entries are sorted by event code.
+ *
+ * @param handle
+ * @param info The pointer to the calculation info instance.
+ * @param events A pointer to the buffer of event codes,
+ * with at least PGM_calculation_info_n_entries() elements.
+ * @param values A pointer to the buffer of values,
+ * with at least PGM_calculation_info_n_entries() elements.
+ * @return
+ */
+PGM_API void PGM_calculation_info_get_entries(PGM_Handle* handle, PGM_CalculationInfo const* info, PGM_Idx* events,
+                                              double* values) PGM_NOEXCEPT;
+
+/**
+ * @brief Get the number of entries of the information per scenario of the batch calculations.
+ *
+ * @param handle
+ * @param info The pointer to the calculation info instance.
+ * @return The number of entries, summed over all scenarios.
+ */
+PGM_API PGM_Idx PGM_calculation_info_n_scenario_entries(PGM_Handle* handle,
+                                                        PGM_CalculationInfo const* info) PGM_NOEXCEPT;
+
+/**
+ * @brief Get the entries of the information per scenario of the batch calculations.
+ *
+ * The entries are a table in long format, i.e., one row of (scenario, event, value) for each entry.
+ * The rows are sorted by scenario, and by event code within a scenario.
+ * The scenarios of multiple batch calculations are reported in order of calculation.
+ *
+ * @param handle
+ * @param info The pointer to the calculation info instance.
+ * @param scenarios A pointer to the buffer of scenario indices,
+ * with at least PGM_calculation_info_n_scenario_entries() elements.
+ * @param events A pointer to the buffer of event codes,
+ * with at least PGM_calculation_info_n_scenario_entries() elements.
+ * @param values A pointer to the buffer of values,
+ * with at least PGM_calculation_info_n_scenario_entries() elements.
+ * @return
+ */
+PGM_API void PGM_calculation_info_get_scenario_entries(PGM_Handle* handle, PGM_CalculationInfo const* info,
+                                                       PGM_Idx* scenarios, PGM_Idx* events,
+                                                       double* values) PGM_NOEXCEPT;
+
+/**
+ * @brief Get the name of an event code.
+ *
+ * @param handle
+ * @param event The event code.
+ * @return The name of the event, "unknown" for an unknown event code.
+ * The pointer is valid for the lifetime of the library.
+ */
+PGM_API char const* PGM_calculation_info_event_name(PGM_Handle* handle, PGM_Idx event) PGM_NOEXCEPT;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -60,6 +60,126 @@ PGM_API void PGM_update_model(PGM_Handle* handle, PGM_PowerGridModel* model,
  */
 PGM_API PGM_PowerGridModel* PGM_copy_model(PGM_Handle* handle, PGM_PowerGridModel const* model) PGM_NOEXCEPT;
 
+/**
+ * @brief Keep worker threads and copies of the model alive between batch calculations of the model.
+ *
+ * Without a worker pool, every batch calculation creates its threads and copies the model for every thread.
+ * With a worker pool, the threads and the copies of the model are reused by the next batch calculation.
+ * The copies of the model are discarded when the model is updated by PGM_update_model().
+ * The number of threads of a batch calculation is limited by the number of workers.
+ * The worker pool is not copied by PGM_copy_model().
+ *
+ * @param handle
+ * @param model A pointer to an existing model.
+ * @param n_workers Number of worker threads.
+ * -1 to remove the worker pool, 0 to use the number of hardware threads.
+ * @return
+ */
+PGM_API void PGM_set_model_worker_pool(PGM_Handle* handle, PGM_PowerGridModel* model, PGM_Idx n_workers) PGM_NOEXCEPT;
+
+/**
+ * @brief Collect the profiling information of the calculations of the model in a calculation info instance.
+ *
+ * The information of all following calculations is accumulated in the calculation info,
+ * including a breakdown per scenario of batch calculations.
+ * Setting a calculation info replaces the tracer set by PGM_set_model_tracer(), and vice versa.
+ * The calculation info is not owned by the model and should outlive the model, or be detached first.
+ * The calculation info is shared with the copies of the model made by PGM_copy_model().
+ * The calculation info is not thread-safe: the model and its copies should not calculate concurrently
+ * while they share it. Use a separate calculation info for each copy in that case.
+ *
+ * @param handle
+ * @param model A pointer to an existing model.
+ * @param info A pointer to the calculation info created by PGM_create_calculation_info().
+ * NULL to stop collecting the profiling information.
+ * @return
+ */
+PGM_API void PGM_set_model_calculation_info(PGM_Handle* handle, PGM_PowerGridModel* model,
+                                            PGM_CalculationInfo* info) PGM_NOEXCEPT;
+
+/**
+ * @brief Record the timeline of the calculations of the model in a tracer.
+ *
+ * A model collects the information in either a calculation info or a tracer.
+ * Setting a tracer replaces the calculation info set by PGM_set_model_calculation_info(), and vice versa.
+ * The tracer is not owned by the model and should outlive the model, or be detached first.
+ * The tracer is shared with the copies of the model made by PGM_copy_model().
+ * The tracer is not thread-safe: the model and its copies should not calculate concurrently
+ * while they share it. Use a separate tracer for each copy in that case.
+ *
+ * @param handle
+ * @param model A pointer to an existing model.
+ * @param tracer A pointer to the tracer created by PGM_create_tracer().
+ * NULL to stop tracing.
+ * @return
+ */
+PGM_API void PGM_set_model_tracer(PGM_Handle* handle, PGM_PowerGridModel* model, PGM_Tracer* tracer) PGM_NOEXCEPT;
+
+/**
+ * @brief Get the size of the binary snapshot of the topology of the model.
+ *
+ * The topology is built first if needed.
+ * The size stays valid as long as the model is not updated.
+ *
+ * @param handle
+ * @param model A pointer to an existing model.
+ * @return The size of the snapshot in bytes, to allocate the buffer of PGM_save_model_topology_snapshot().
+ */
+PGM_API PGM_Idx PGM_get_model_topology_snapshot_size(PGM_Handle* handle, PGM_PowerGridModel* model) PGM_NOEXCEPT;
+
+/**
+ * @brief Save the topology of the model to a binary snapshot in a buffer of the caller.
+ *
+ * The snapshot contains the built topology of the model, i.e., the ordering of the buses, the fill-in of the sparse
+ * matrices and the coupling of the components to the (electrically isolated) subgrids.
+ * The topology is built first if needed.
+ * The snapshot does not contain the components themselves.
+ * The sparse ordering method of the fill-in is part of the snapshot.
+ *
+ * The snapshot is only valid on a machine with the same byte order and integer size.
+ * Check the handle for a PGM_serialization_error if the buffer is too small.
+ *
+ * @param handle
+ * @param model A pointer to an existing model.
+ * @param buffer A pointer to the buffer to write the snapshot to.
+ * @param size The size of the buffer in bytes, at least PGM_get_model_topology_snapshot_size().
+ * @return
+ */
+PGM_API void PGM_save_model_topology_snapshot(PGM_Handle* handle, PGM_PowerGridModel* model, char* buffer,
+                                              PGM_Idx size) PGM_NOEXCEPT;
+
+/**
+ * @brief Save the topology of the model to a binary snapshot file.
+ *
+ * This is the same snapshot as saved by PGM_save_model_topology_snapshot(), written to a file.
+ * Check the handle for a PGM_serialization_error if the file cannot be written.
+ *
+ * @param handle
+ * @param model A pointer to an existing model.
+ * @param file_path The path of the snapshot file, which is overwritten.
+ * @return
+ */
+PGM_API void PGM_save_model_topology_snapshot_to_file(PGM_Handle* handle, PGM_PowerGridModel* model,
+                                                      char const* file_path) PGM_NOEXCEPT;
+
+/**
+ * @brief Restore the topology of the model from a binary snapshot, instead of building it in the next calculation.
+ *
+ * The model should be created from the same input data as the model of the snapshot,
+ * or at least with the same components and switching states, and use the same sparse ordering method.
+ * This is checked exactly; a PGM_serialization_error is set if it does not match or if the snapshot is corrupted.
+ * The model is not changed in that case.
+ * The buffer is only read during this call, so a memory-mapped snapshot file can be passed without copying it first.
+ *
+ * @param handle
+ * @param model A pointer to an existing model.
+ * @param data A pointer to the snapshot, as saved by PGM_save_model_topology_snapshot().
+ * @param size The size of the snapshot in bytes.
+ * @return
+ */
+PGM_API void PGM_load_model_topology_snapshot(PGM_Handle* handle, PGM_PowerGridModel* model, char const* data,
+                                              PGM_Idx size) PGM_NOEXCEPT;
+
 /**
  * @brief Get the sequence numbers based on list of ids in a given component.
  *
@@ -117,6 +237,31 @@ PGM_API void PGM_calculate(PGM_Handle* handle, PGM_PowerGridModel* model, PGM_Op
                            PGM_MutableDataset const* output_dataset,
                            PGM_ConstDataset const* batch_dataset) PGM_NOEXCEPT;
 
+/**
+ * @brief Execute a short circuit sweep.
+ *
+ * Every fault in the model is calculated separately, as if only that fault is active.
+ * The network without faults is factorized only once, which is faster than a batch calculation
+ * that activates one fault per scenario.
+ * Faults that are not active in the model are not swept: their scenario is the calculation without faults.
+ *
+ * The calculation type and symmetry in the options are ignored.
+ * The calculation is symmetric if all faults are three phase faults, and asymmetric otherwise.
+ *
+ * Use PGM_error_code() and PGM_error_message() to check the error.
+ *
+ * @param handle
+ * @param model A pointer to an existing model.
+ * @param opt A pointer to options, the calculation method should be a short circuit calculation method.
+ * @param output_dataset A pointer to an instance of PGM_MutableDataset.
+ *   The dataset should have type "sc_output" and be a batch with one scenario per fault,
+ *   in the order of the faults in the input data.
+ *   You need to pre-allocate all output memory buffers.
+ * @return
+ */
+PGM_API void PGM_calculate_short_circuit_sweep(PGM_Handle* handle, PGM_PowerGridModel* model, PGM_Options const* opt,
+                                               PGM_MutableDataset const* output_dataset) PGM_NOEXCEPT;
+
 /**
  * @brief Destroy the model returned by PGM_create_model() or PGM_copy_model().
  *
@@ -29,6 +29,10 @@ extern "C" {
  *   - max_iter: 20
  *   - threading: -1
  *   - short_circuit_voltage_scaling: PGM_short_circuit_voltage_scaling_maximum
+ *   - tap_changing_strategy: PGM_tap_changing_strategy_disabled
+ *   - pf_initialization: PGM_pf_initialization_cold_start
+ *   - sparse_ordering: PGM_sparse_ordering_minimum_degree
+ *   - observability_check_only: 0
  *   - experimental_features: PGM_experimental_features_disabled
  *
  * @param handle
@@ -92,7 +96,9 @@ PGM_API void PGM_set_err_tol(PGM_Handle* handle, PGM_Options* opt, double err_to
 PGM_API void PGM_set_max_iter(PGM_Handle* handle, PGM_Options* opt, PGM_Idx max_iter) PGM_NOEXCEPT;
 
 /**
- * @brief Specify the multi-threading strategy. Only applicable for batch calculation.
+ * @brief Specify the multi-threading strategy.
+ * For batch calculation, the scenarios are calculated in parallel.
+ * For a single calculation, the electrically isolated subgrids (islands) of the grid are solved in parallel.
  *
  * @param handle
  * @param opt The pointer to the option instance.
@@ -123,6 +129,52 @@ PGM_API void PGM_set_short_circuit_voltage_scaling(PGM_Handle* handle, PGM_Optio
 PGM_API void PGM_set_tap_changing_strategy(PGM_Handle* handle, PGM_Options* opt,
                                            PGM_Idx tap_changing_strategy) PGM_NOEXCEPT;
 
+/**
+ * @brief Specify the initialization of iterative power flow calculations.
+ * Only applicable to the Newton-Raphson and iterative current methods.
+ *
+ * With warm start, the initial voltages of a calculation are the converged solution of the previous calculation of the
+ * same (sub)grid in the same thread, e.g., the previous scenario in a batch time series.
+ * This typically reduces the number of iterations if consecutive scenarios are similar.
+ * The calculation falls back to the cold start if there is no previous solution, if the topology has changed,
+ * or if the warm start does not converge.
+ * The results are equal to the cold start results within the error tolerance, but not necessarily bitwise identical.
+ *
+ * @param handle
+ * @param opt pointer to option instance
+ * @param pf_initialization See #PGM_PowerFlowInitialization
+ */
+PGM_API void PGM_set_pf_initialization(PGM_Handle* handle, PGM_Options* opt, PGM_Idx pf_initialization) PGM_NOEXCEPT;
+
+/**
+ * @brief Specify the fill-reducing ordering of the sparse matrices of meshed grids.
+ *
+ * The ordering is part of the topology of the model.
+ * If a calculation requests another ordering than the previous calculation, the topology is rebuilt.
+ * The approximate minimum degree ordering is faster to compute on large meshed grids, at the cost of a possibly
+ * slightly larger fill-in.
+ *
+ * @param handle
+ * @param opt pointer to option instance
+ * @param sparse_ordering See #PGM_SparseOrdering
+ */
+PGM_API void PGM_set_sparse_ordering(PGM_Handle* handle, PGM_Options* opt, PGM_Idx sparse_ordering) PGM_NOEXCEPT;
+
+/**
+ * @brief Specify if a state estimation only checks the observability, without solving.
+ *
+ * Only valid for state estimation.
+ * A scenario that is not observable raises an error, as in a normal state estimation.
+ * In a batch calculation, the failed scenarios are the scenarios that are not observable.
+ * The output dataset is not written.
+ *
+ * @param handle
+ * @param opt pointer to option instance
+ * @param observability_check_only 1 for only the observability check, 0 for the full state estimation
+ */
+PGM_API void PGM_set_observability_check_only(PGM_Handle* handle, PGM_Options* opt,
+                                              PGM_Idx observability_check_only) PGM_NOEXCEPT;
+
 /**
  * @brief Enable/disable experimental features.
  *
@@ -53,6 +53,21 @@ PGM_create_deserializer_from_null_terminated_string(PGM_Handle* handle, char con
 PGM_API PGM_WritableDataset* PGM_deserializer_get_dataset(PGM_Handle* handle,
                                                           PGM_Deserializer* deserializer) PGM_NOEXCEPT;
 
+/**
+ * @brief Specify the multi-threading strategy of PGM_deserializer_parse_to_buffer().
+ * The scenarios of the components are parsed in parallel.
+ *
+ * @param handle
+ * @param deserializer The pointer to the deserializer.
+ * @param threading The value of the threading setting. See below:
+ *   - -1: No multi-threading, parse sequentially. This is the default.
+ *   - 0: use number of machine available threads.
+ *   - >0: specify number of threads you want to parse in parallel.
+ * @return No return value; check handle for error.
+ */
+PGM_API void PGM_deserializer_set_threading(PGM_Handle* handle, PGM_Deserializer* deserializer,
+                                            PGM_Idx threading) PGM_NOEXCEPT;
+
 /**
  * @brief Parse the dataset and write to the user-provided buffers.
  *     The buffers must be set through PGM_writable_dataset_set_buffer().
@@ -0,0 +1,92 @@
+// SPDX-FileCopyrightText: Contributors to the Power Grid Model project <powergridmodel@lfenergy.org>
+//
+// SPDX-License-Identifier: MPL-2.0
+
+/**
+ * @brief header file which includes tracer functions
+ *
+ * The tracer records the timeline of the calculations of a model, for each thread and scenario.
+ * The phases of the calculations are recorded with their begin and end time,
+ * the iteration counts and the cache hits are recorded at the moment they occur.
+ * Each thread records its events in its own buffer of limited size; if it is full, the oldest events are dropped.
+ * The timeline can be written as a Chrome trace file, which can be viewed in chrome://tracing or Perfetto.
+ */
+
+#pragma once
+#ifndef POWER_GRID_MODEL_C_TRACER_H
+#define POWER_GRID_MODEL_C_TRACER_H
+
+#include "basics.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Create a tracer instance.
+ *
+ * Use PGM_set_model_tracer() to record the timeline of the calculations of a model.
+ *
+ * @param handle
+ * @return The pointer to the tracer instance. Should be freed by PGM_destroy_tracer().
+ *     Returns NULL if errors occured (check the handle for error information).
+ */
+PGM_API PGM_Tracer* PGM_create_tracer(PGM_Handle* handle) PGM_NOEXCEPT;
+
+/**
+ * @brief Free a tracer instance.
+ *
+ * The tracer should be detached from the models first.
+ *
+ * @param tracer The pointer to the tracer instance created by PGM_create_tracer().
+ */
+PGM_API void PGM_destroy_tracer(PGM_Tracer* tracer) PGM_NOEXCEPT;
+
+/**
+ * @brief Remove all recorded events.
+ *
+ * @param handle
+ * @param tracer The pointer to the tracer instance.
+ * @return
+ */
+PGM_API void PGM_tracer_clear(PGM_Handle* handle, PGM_Tracer* tracer) PGM_NOEXCEPT;
+
+/**
+ * @brief Get the number of recorded events.
+ *
+ * @param handle
+ * @param tracer The pointer to the tracer instance.
+ * @return The number of events that are kept.
+ */
+PGM_API PGM_Idx PGM_tracer_n_events(PGM_Handle* handle, PGM_Tracer const* tracer) PGM_NOEXCEPT;
+
+/**
+ * @brief Get the number of events that were dropped because the buffer of a thread was full.
+ *
+ * @param handle
+ * @param tracer The pointer to the tracer instance.
+ * @return The number of dropped events.
+ */
+PGM_API PGM_Idx PGM_tracer_n_dropped_events(PGM_Handle* handle, PGM_Tracer const* tracer) PGM_NOEXCEPT;
+
+/**
+ * @brief Write the recorded events to a file in the Chrome trace event format.
+ *
+ * The file should be written after the calculations have finished.
+ * The threads are numbered in order of appearance, the times are relative to the first event.
+ * The scenario index of batch calculations is given as an argument of the events.
+ *
+ * @param handle
+ * @param tracer The pointer to the tracer instance.
+ * @param file_path The path of the JSON file to write; an existing file is overwritten.
+ * @return No return value; check handle for error.
+ * The error code is PGM_serialization_error if the file cannot be written.
+ */
+PGM_API void PGM_tracer_write_chrome_trace(PGM_Handle* handle, PGM_Tracer const* tracer,
+                                           char const* file_path) PGM_NOEXCEPT;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
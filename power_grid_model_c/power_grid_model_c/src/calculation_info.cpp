@@ -0,0 +1,99 @@
+// SPDX-FileCopyrightText: Contributors to the Power Grid Model project <powergridmodel@lfenergy.org>
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#define PGM_DLL_EXPORTS
+#include "forward_declarations.hpp"
+#include "handle.hpp"
+#include "input_sanitization.hpp"
+#include "safe_memory_handling.hpp"
+
+#include "power_grid_model_c/basics.h"
+#include "power_grid_model_c/calculation_info.h"
+
+#include <power_grid_model/common/calculation_info.hpp>
+#include <power_grid_model/common/common.hpp>
+#include <power_grid_model/common/logging.hpp>
+
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+namespace {
+using namespace power_grid_model;
+using common::logging::LogEvent;
+
+using power_grid_model_c::call_with_catch;
+using power_grid_model_c::cast_to_c;
+using power_grid_model_c::cast_to_cpp;
+using power_grid_model_c::create;
+using power_grid_model_c::destroy;
+using power_grid_model_c::safe_ptr;
+using power_grid_model_c::safe_ptr_get;
+
+constexpr PGM_Idx to_event_code(LogEvent tag) { return static_cast<PGM_Idx>(std::to_underlying(tag)); }
+} // namespace
+
+PGM_CalculationInfo* PGM_create_calculation_info(PGM_Handle* handle) noexcept {
+    return call_with_catch(handle, [] { return cast_to_c(create<MultiThreadedScenarioCalculationInfo>()); });
+}
+
+void PGM_destroy_calculation_info(PGM_CalculationInfo* info) noexcept { destroy(cast_to_cpp(info)); }
+
+void PGM_calculation_info_clear(PGM_Handle* handle, PGM_CalculationInfo* info) noexcept {
+    call_with_catch(handle, [info] { safe_ptr_get(cast_to_cpp(info)).clear(); });
+}
+
+PGM_Idx PGM_calculation_info_n_entries(PGM_Handle* handle, PGM_CalculationInfo const* info) noexcept {
+    return call_with_catch(handle, [info] { return std::ssize(safe_ptr_get(cast_to_cpp(info)).report()); });
+}
+
+void PGM_calculation_info_get_entries(PGM_Handle* handle, PGM_CalculationInfo const* info, PGM_Idx* events,
+                                      double* values) noexcept {
+    call_with_catch(handle, [info, events, values] {
+        auto const& report = safe_ptr_get(cast_to_cpp(info)).report();
+        if (report.empty()) {
+            return;
+        }
+        PGM_Idx* const events_ptr = safe_ptr(events);
+        double* const values_ptr = safe_ptr(values);
+        Idx idx = 0;
+        for (auto const& [tag, value] : report) {
+            events_ptr[idx] = to_event_code(tag);
+            values_ptr[idx] = value;
+            ++idx;
+        }
+    });
+}
+
+PGM_Idx PGM_calculation_info_n_scenario_entries(PGM_Handle* handle, PGM_CalculationInfo const* info) noexcept {
+    return call_with_catch(handle, [info] { return safe_ptr_get(cast_to_cpp(info)).n_scenario_entries(); });
+}
+
+void PGM_calculation_info_get_scenario_entries(PGM_Handle* handle, PGM_CalculationInfo const* info,
+                                               PGM_Idx* scenarios, PGM_Idx* events, double* values) noexcept {
+    call_with_catch(handle, [info, scenarios, events, values] {
+        auto const report = safe_ptr_get(cast_to_cpp(info)).scenario_report();
+        if (report.empty()) {
+            return;
+        }
+        PGM_Idx* const scenarios_ptr = safe_ptr(scenarios);
+        PGM_Idx* const events_ptr = safe_ptr(events);
+        double* const values_ptr = safe_ptr(values);
+        for (Idx idx = 0; idx != std::ssize(report); ++idx) {
+            scenarios_ptr[idx] = report[idx].scenario;
+            events_ptr[idx] = to_event_code(report[idx].tag);
+            values_ptr[idx] = report[idx].value;
+        }
+    });
+}
+
+char const* PGM_calculation_info_event_name(PGM_Handle* handle, PGM_Idx event) noexcept {
+    return call_with_catch(handle, [event] {
+        using EventCode = std::underlying_type_t<LogEvent>;
+        if (!std::in_range<EventCode>(event)) {
+            return common::logging::to_string(LogEvent::unknown).data();
+        }
+        return common::logging::to_string(static_cast<LogEvent>(static_cast<EventCode>(event))).data();
+    });
+}
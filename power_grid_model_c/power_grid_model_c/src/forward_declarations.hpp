@@ -31,6 +31,13 @@ struct DatasetInfo;
 
 } // namespace meta_data
 
+namespace common::logging {
+
+class MultiThreadedScenarioCalculationInfo;
+class MultiThreadedTraceLogger;
+
+} // namespace common::logging
+
 } // namespace power_grid_model
 
 namespace power_grid_model_c {
@@ -70,7 +77,9 @@ using type_mapping_list = type_mapping_list_impl<
     c_cpp_type_map<PGM_ConstDataset, power_grid_model::meta_data::Dataset<power_grid_model::const_dataset_t>>,
     c_cpp_type_map<PGM_MutableDataset, power_grid_model::meta_data::Dataset<power_grid_model::mutable_dataset_t>>,
     c_cpp_type_map<PGM_WritableDataset, power_grid_model::meta_data::Dataset<power_grid_model::writable_dataset_t>>,
-    c_cpp_type_map<PGM_DatasetInfo, power_grid_model::meta_data::DatasetInfo>>;
+    c_cpp_type_map<PGM_DatasetInfo, power_grid_model::meta_data::DatasetInfo>,
+    c_cpp_type_map<PGM_CalculationInfo, power_grid_model::common::logging::MultiThreadedScenarioCalculationInfo>,
+    c_cpp_type_map<PGM_Tracer, power_grid_model::common::logging::MultiThreadedTraceLogger>>;
 
 template <class CTypePtr> struct convert_ptr_to_cpp {
     static constexpr bool is_const = std::is_const_v<std::remove_pointer_t<CTypePtr>>;
@@ -14,9 +14,12 @@
 #include "power_grid_model_c/model.h"
 
 #include <power_grid_model/auxiliary/dataset.hpp>
+#include <power_grid_model/common/calculation_info.hpp>
 #include <power_grid_model/common/common.hpp>
 #include <power_grid_model/common/enum.hpp>
 #include <power_grid_model/common/exception.hpp>
+#include <power_grid_model/common/trace_logger.hpp>
+#include <power_grid_model/job_dispatch.hpp>
 #include <power_grid_model/main_model.hpp>
 #include <power_grid_model/main_model_fwd.hpp>
 
@@ -24,7 +27,11 @@
 #include <cassert>
 #include <concepts>
 #include <exception>
+#include <filesystem>
+#include <fstream>
+#include <ios>
 #include <ranges>
+#include <span>
 #include <string>
 #include <utility>
 
@@ -41,7 +48,16 @@ using power_grid_model_c::safe_enum;
 using power_grid_model_c::safe_ptr;
 using power_grid_model_c::safe_ptr_get;
 using power_grid_model_c::safe_ptr_maybe_nullptr;
+using power_grid_model_c::safe_size;
 using power_grid_model_c::safe_str_view;
+
+struct SnapshotExceptionHandler : public power_grid_model_c::DefaultExceptionHandler {
+    void operator()(PGM_Handle& handle) const noexcept { // NOLINT(bugprone-derived-method-shadowing-base-method)
+        handle_all_errors(handle, PGM_serialization_error);
+    }
+};
+
+constexpr SnapshotExceptionHandler snapshot_exception_handler{};
 } // namespace
 
 // create model
@@ -66,6 +82,73 @@ PGM_PowerGridModel* PGM_copy_model(PGM_Handle* handle, PGM_PowerGridModel const*
     return call_with_catch(handle, [model] { return cast_to_c(create<MainModel>(safe_ptr_get(cast_to_cpp(model)))); });
 }
 
+// set worker pool
+void PGM_set_model_worker_pool(PGM_Handle* handle, PGM_PowerGridModel* model, PGM_Idx n_workers) noexcept {
+    call_with_catch(handle, [model, n_workers] { safe_ptr_get(cast_to_cpp(model)).set_worker_pool(n_workers); });
+}
+
+// set calculation info
+void PGM_set_model_calculation_info(PGM_Handle* handle, PGM_PowerGridModel* model, PGM_CalculationInfo* info) noexcept {
+    call_with_catch(handle, [model, info] {
+        safe_ptr_get(cast_to_cpp(model)).set_logger(safe_ptr_maybe_nullptr(cast_to_cpp(info)));
+    });
+}
+
+// set tracer
+void PGM_set_model_tracer(PGM_Handle* handle, PGM_PowerGridModel* model, PGM_Tracer* tracer) noexcept {
+    call_with_catch(handle, [model, tracer] {
+        safe_ptr_get(cast_to_cpp(model)).set_logger(safe_ptr_maybe_nullptr(cast_to_cpp(tracer)));
+    });
+}
+
+// get topology snapshot size
+PGM_Idx PGM_get_model_topology_snapshot_size(PGM_Handle* handle, PGM_PowerGridModel* model) noexcept {
+    return call_with_catch(
+        handle, [model] { return safe_ptr_get(cast_to_cpp(model)).topology_snapshot_size(); },
+        snapshot_exception_handler);
+}
+
+// save topology snapshot
+void PGM_save_model_topology_snapshot(PGM_Handle* handle, PGM_PowerGridModel* model, char* buffer,
+                                      PGM_Idx size) noexcept {
+    call_with_catch(
+        handle,
+        [model, buffer, size] {
+            safe_ptr_get(cast_to_cpp(model))
+                .save_topology_snapshot(std::span{safe_ptr(buffer), safe_size<size_t>(size)});
+        },
+        snapshot_exception_handler);
+}
+
+// save topology snapshot to file
+void PGM_save_model_topology_snapshot_to_file(PGM_Handle* handle, PGM_PowerGridModel* model,
+                                              char const* file_path) noexcept {
+    call_with_catch(
+        handle,
+        [model, file_path] {
+            std::filesystem::path const path{safe_str_view(file_path)};
+            std::ofstream file{path, std::ios::binary};
+            if (!file) {
+                throw SerializationError{"Cannot open the topology snapshot file for writing: " + path.string() +
+                                         "\n"};
+            }
+            safe_ptr_get(cast_to_cpp(model)).save_topology_snapshot(file);
+        },
+        snapshot_exception_handler);
+}
+
+// load topology snapshot
+void PGM_load_model_topology_snapshot(PGM_Handle* handle, PGM_PowerGridModel* model, char const* data,
+                                      PGM_Idx size) noexcept {
+    call_with_catch(
+        handle,
+        [model, data, size] {
+            safe_ptr_get(cast_to_cpp(model))
+                .load_topology_snapshot(std::span{safe_ptr(data), safe_size<size_t>(size)});
+        },
+        snapshot_exception_handler);
+}
+
 // get indexer
 void PGM_get_indexer(PGM_Handle* handle, PGM_PowerGridModel const* model, char const* component, PGM_Idx size,
                      PGM_ID const* ids, PGM_Idx* indexer) noexcept {
@@ -113,6 +196,12 @@ void check_calculate_valid_options(PGM_Options const& opt) {
                                InvalidArguments::TypeValuePair{.name = "PGM_TapChangingStrategy",
                                                                .value = std::to_string(opt.tap_changing_strategy)}};
     }
+    if (opt.observability_check_only != 0 && opt.calculation_type != PGM_state_estimation) {
+        // the observability check is part of the state estimation
+        throw InvalidArguments{"PGM_calculate",
+                               InvalidArguments::TypeValuePair{.name = "observability_check_only",
+                                                               .value = std::to_string(opt.observability_check_only)}};
+    }
 }
 
 constexpr auto get_calculation_type(PGM_Options const& opt) { return safe_enum<CalculationType>(opt.calculation_type); }
@@ -170,6 +259,32 @@ constexpr auto get_short_circuit_voltage_scaling(PGM_Options const& opt) {
     return safe_enum<ShortCircuitVoltageScaling>(opt.short_circuit_voltage_scaling);
 }
 
+constexpr auto get_pf_initialization(PGM_Options const& opt) {
+    using enum PowerFlowInitialization;
+
+    switch (opt.pf_initialization) {
+    case PGM_pf_initialization_cold_start:
+        return cold_start;
+    case PGM_pf_initialization_warm_start:
+        return warm_start;
+    default:
+        throw MissingCaseForEnumError{"get_pf_initialization", opt.pf_initialization};
+    }
+}
+
+constexpr auto get_sparse_ordering(PGM_Options const& opt) {
+    using enum SparseOrderingMethod;
+
+    switch (opt.sparse_ordering) {
+    case PGM_sparse_ordering_minimum_degree:
+        return minimum_degree;
+    case PGM_sparse_ordering_approximate_minimum_degree:
+        return approximate_minimum_degree;
+    default:
+        throw MissingCaseForEnumError{"get_sparse_ordering", opt.sparse_ordering};
+    }
+}
+
 constexpr auto extract_calculation_options(PGM_Options const& opt) {
     return MainModel::Options{.calculation_type = get_calculation_type(opt),
                               .calculation_symmetry = get_calculation_symmetry(opt),
@@ -179,6 +294,9 @@ constexpr auto extract_calculation_options(PGM_Options const& opt) {
                               .err_tol = opt.err_tol,
                               .max_iter = opt.max_iter,
                               .threading = opt.threading,
+                              .pf_initialization = get_pf_initialization(opt),
+                              .sparse_ordering = get_sparse_ordering(opt),
+                              .observability_check_only = opt.observability_check_only != 0,
                               .short_circuit_voltage_scaling = get_short_circuit_voltage_scaling(opt)};
 }
 
@@ -187,13 +305,22 @@ class BadCalculationRequest : public PowerGridError {
     explicit BadCalculationRequest(std::string msg) : PowerGridError{std::move(msg)} {}
 };
 
-void calculate_single_batch_dimension_impl(MainModel& model, MainModel::Options const& options,
-                                           MutableDataset const& output_dataset, ConstDataset const* batch_dataset) {
+// a multi-dimensional (cartesian product) batch is calculated as one batch of all combined scenarios
+void calculate_batch_impl(MainModel& model, MainModel::Options const& options, MutableDataset const& output_dataset,
+                          ConstDataset const* batch_dataset) {
     // check dataset integrity
-    if ((batch_dataset != nullptr) && (!batch_dataset->is_batch() || !output_dataset.is_batch())) {
+    if ((batch_dataset != nullptr) &&
+        (!output_dataset.is_batch() ||
+         std::ranges::any_of(JobDispatch::batch_dimensions(*batch_dataset),
+                             [](ConstDataset const* dimension) { return !dimension->is_batch(); }))) {
         throw BadCalculationRequest{
             "If batch_dataset is provided. Both batch_dataset and output_dataset should be a batch!\n"};
     }
+    if ((batch_dataset != nullptr) && (batch_dataset->get_next_cartesian_product_dimension() != nullptr) &&
+        (JobDispatch::total_batch_size(*batch_dataset) != output_dataset.batch_size())) {
+        throw BadCalculationRequest{"For a multi-dimensional batch, the batch size of output_dataset should be the "
+                                    "product of the batch sizes of all dimensions!\n"};
+    }
 
     ConstDataset const& exported_update_dataset = batch_dataset != nullptr
                                                       ? safe_ptr_get(batch_dataset)
@@ -221,118 +348,6 @@ struct BatchExceptionHandler : public power_grid_model_c::DefaultExceptionHandle
 
 constexpr BatchExceptionHandler batch_exception_handler{};
 
-template <typename T, non_owning_view_c R>
-    requires std::convertible_to<std::ranges::range_value_t<R>, T>
-void append_range(std::vector<T>& vec, R range) {
-    std::ranges::move(range, std::back_inserter(vec));
-}
-
-class MDBatchExceptionHandler : public power_grid_model_c::DefaultExceptionHandler {
-  public:
-    MDBatchExceptionHandler(Idx scenario_offset, Idx stride_size)
-        : scenario_offset_{scenario_offset}, stride_size_{stride_size} {
-        assert(scenario_offset_ >= 0);
-        assert(stride_size_ > 0);
-    }
-
-    void operator()(PGM_Handle& handle) const noexcept { // NOLINT(bugprone-derived-method-shadowing-base-method)
-        using namespace std::string_literals;
-
-        std::exception_ptr const ex_ptr = std::current_exception();
-        try {
-            std::rethrow_exception(ex_ptr);
-        } catch (BatchCalculationError const& ex) {
-            handle_regular_error(handle, ex, PGM_batch_error);
-            append_range(handle.failed_scenarios,
-                         ex.failed_scenarios() | std::views::transform([scenario_offset = scenario_offset_](Idx idx) {
-                             return idx + scenario_offset;
-                         }));
-
-            append_range(handle.batch_errs, by_ref(ex.err_msgs()));
-        } catch (std::exception const& ex) {
-            handle_regular_error(handle, ex, PGM_batch_error);
-            append_range(handle.failed_scenarios, IdxRange{stride_size_});
-            append_range(handle.batch_errs, std::views::repeat(ex.what(), stride_size_));
-        } catch (...) { // NOSONAR(S2738)
-            handle_unkown_error(handle);
-        }
-    }
-
-  private:
-    Idx scenario_offset_{};
-    Idx stride_size_{};
-};
-
-Idx get_batch_dimension(ConstDataset const* batch_dataset) {
-    Idx dimension = 0;
-    ConstDataset const* safe_batch_dataset = safe_ptr_maybe_nullptr(batch_dataset);
-    while (safe_batch_dataset != nullptr) {
-        ++dimension;
-        safe_batch_dataset =
-            safe_ptr_maybe_nullptr(safe_ptr_get(safe_batch_dataset).get_next_cartesian_product_dimension());
-    }
-    return dimension;
-}
-
-Idx get_stride_size(ConstDataset const* batch_dataset) {
-    Idx size = 1;
-    ConstDataset const* current =
-        safe_ptr_maybe_nullptr(safe_ptr_get(batch_dataset).get_next_cartesian_product_dimension());
-    while (current != nullptr) {
-        auto const& safe_current = safe_ptr_get(current);
-        size *= safe_current.batch_size();
-        current = safe_current.get_next_cartesian_product_dimension();
-    }
-    return size;
-}
-
-// run calculation
-void calculate_multi_dimensional_impl(MainModel& model, MainModel::Options const& options,
-                                      MutableDataset const& output_dataset, ConstDataset const* batch_dataset) {
-    // for dimension < 2 (one-time or 1D batch), call implementation directly
-    if (auto const batch_dimension = get_batch_dimension(batch_dataset); batch_dimension < 2) {
-        calculate_single_batch_dimension_impl(model, options, output_dataset, batch_dataset);
-        return;
-    }
-
-    auto const& safe_batch_dataset = safe_ptr_get(batch_dataset);
-
-    // get stride size of the rest of dimensions
-    Idx const first_batch_size = safe_batch_dataset.batch_size();
-    Idx const stride_size = get_stride_size(batch_dataset);
-
-    PGM_Handle local_handle{};
-
-    // loop over the first dimension batch
-    for (Idx i = 0; i < first_batch_size; ++i) {
-        // a new handle
-        call_with_catch(
-            &local_handle,
-            [&model, &options, &output_dataset, &safe_batch_dataset, i, stride_size] {
-                // create sliced datasets for the rest of dimensions
-                ConstDataset const single_update_dataset = safe_batch_dataset.get_individual_scenario(i);
-                MutableDataset const sliced_output_dataset =
-                    output_dataset.get_slice_scenario(i * stride_size, (i + 1) * stride_size);
-
-                // create a model copy
-                MainModel local_model{model};
-
-                // apply the update
-                local_model.update_components<permanent_update_t>(single_update_dataset);
-
-                // recursive call
-                calculate_multi_dimensional_impl(local_model, options, sliced_output_dataset,
-                                                 safe_batch_dataset.get_next_cartesian_product_dimension());
-            },
-            MDBatchExceptionHandler{i * stride_size, stride_size});
-    }
-
-    if (local_handle.err_code != PGM_no_error) {
-        throw BatchCalculationError{std::move(local_handle.err_msg), std::move(local_handle.failed_scenarios),
-                                    std::move(local_handle.batch_errs)};
-    }
-}
-
 void calculate_impl(MainModel& model, PGM_Options const& options, MutableDataset const& output_dataset,
                     ConstDataset const* batch_dataset) {
     check_calculate_valid_options(options);
@@ -340,7 +355,7 @@ void calculate_impl(MainModel& model, PGM_Options const& options, MutableDataset
 
     check_experimental_support(options.experimental_features, model, extracted_options, batch_dataset);
 
-    calculate_multi_dimensional_impl(model, extracted_options, output_dataset, batch_dataset);
+    calculate_batch_impl(model, extracted_options, output_dataset, batch_dataset);
 }
 
 } // namespace
@@ -358,5 +373,15 @@ void PGM_calculate(PGM_Handle* handle, PGM_PowerGridModel* model, PGM_Options co
         batch_exception_handler);
 }
 
+// run short circuit sweep
+void PGM_calculate_short_circuit_sweep(PGM_Handle* handle, PGM_PowerGridModel* model, PGM_Options const* opt,
+                                       PGM_MutableDataset const* output_dataset) noexcept {
+    call_with_catch(handle, [model, opt, output_dataset] {
+        safe_ptr_get(cast_to_cpp(model))
+            .calculate_short_circuit_sweep(extract_calculation_options(safe_ptr_get(opt)),
+                                           safe_ptr_get(cast_to_cpp(output_dataset)));
+    });
+}
+
 // destroy model
 void PGM_destroy_model(PGM_PowerGridModel* model) noexcept { destroy(cast_to_cpp(model)); }
@@ -54,6 +54,18 @@ void PGM_set_tap_changing_strategy(PGM_Handle* handle, PGM_Options* opt, PGM_Idx
     call_with_catch(handle,
                     [opt, tap_changing_strategy] { safe_ptr_get(opt).tap_changing_strategy = tap_changing_strategy; });
 }
+void PGM_set_pf_initialization(PGM_Handle* handle, PGM_Options* opt, PGM_Idx pf_initialization) noexcept {
+    call_with_catch(handle, [opt, pf_initialization] { safe_ptr_get(opt).pf_initialization = pf_initialization; });
+}
+void PGM_set_sparse_ordering(PGM_Handle* handle, PGM_Options* opt, PGM_Idx sparse_ordering) noexcept {
+    call_with_catch(handle, [opt, sparse_ordering] { safe_ptr_get(opt).sparse_ordering = sparse_ordering; });
+}
+void PGM_set_observability_check_only(PGM_Handle* handle, PGM_Options* opt,
+                                      PGM_Idx observability_check_only) noexcept {
+    call_with_catch(handle, [opt, observability_check_only] {
+        safe_ptr_get(opt).observability_check_only = observability_check_only;
+    });
+}
 void PGM_set_experimental_features(PGM_Handle* handle, PGM_Options* opt, PGM_Idx experimental_features) noexcept {
     call_with_catch(handle,
                     [opt, experimental_features] { safe_ptr_get(opt).experimental_features = experimental_features; });
@@ -23,5 +23,8 @@ struct PGM_Options {
     Idx threading{-1};
     Idx short_circuit_voltage_scaling{PGM_short_circuit_voltage_scaling_maximum};
     Idx tap_changing_strategy{PGM_tap_changing_strategy_disabled};
+    Idx pf_initialization{PGM_pf_initialization_cold_start};
+    Idx sparse_ordering{PGM_sparse_ordering_minimum_degree};
+    Idx observability_check_only{0};
     Idx experimental_features{PGM_experimental_features_disabled};
 };
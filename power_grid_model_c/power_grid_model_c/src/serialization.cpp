@@ -73,6 +73,11 @@ PGM_WritableDataset* PGM_deserializer_get_dataset(PGM_Handle* handle, PGM_Deseri
         handle, [deserializer] { return cast_to_c(&safe_ptr_get(cast_to_cpp(deserializer)).get_dataset_info()); });
 }
 
+void PGM_deserializer_set_threading(PGM_Handle* handle, PGM_Deserializer* deserializer, PGM_Idx threading) noexcept {
+    call_with_catch(handle,
+                    [deserializer, threading] { safe_ptr_get(cast_to_cpp(deserializer)).set_threading(threading); });
+}
+
 void PGM_deserializer_parse_to_buffer(PGM_Handle* handle, PGM_Deserializer* deserializer) noexcept {
     call_with_catch(
         handle, [deserializer] { safe_ptr_get(cast_to_cpp(deserializer)).parse(); }, serialization_exception_handler);
@@ -0,0 +1,63 @@
+// SPDX-FileCopyrightText: Contributors to the Power Grid Model project <powergridmodel@lfenergy.org>
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#define PGM_DLL_EXPORTS
+#include "forward_declarations.hpp"
+#include "handle.hpp"
+#include "input_sanitization.hpp"
+#include "safe_memory_handling.hpp"
+
+#include "power_grid_model_c/basics.h"
+#include "power_grid_model_c/tracer.h"
+
+#include <power_grid_model/common/trace_logger.hpp>
+
+#include <filesystem>
+
+namespace {
+using namespace power_grid_model;
+
+using power_grid_model_c::call_with_catch;
+using power_grid_model_c::cast_to_c;
+using power_grid_model_c::cast_to_cpp;
+using power_grid_model_c::create;
+using power_grid_model_c::destroy;
+using power_grid_model_c::safe_ptr_get;
+using power_grid_model_c::safe_str_view;
+
+struct TracerWriteExceptionHandler : public power_grid_model_c::DefaultExceptionHandler {
+    void operator()(PGM_Handle& handle) const noexcept { // NOLINT(bugprone-derived-method-shadowing-base-method)
+        handle_all_errors(handle, PGM_serialization_error);
+    }
+};
+
+constexpr TracerWriteExceptionHandler tracer_write_exception_handler{};
+} // namespace
+
+PGM_Tracer* PGM_create_tracer(PGM_Handle* handle) noexcept {
+    return call_with_catch(handle, [] { return cast_to_c(create<MultiThreadedTraceLogger>()); });
+}
+
+void PGM_destroy_tracer(PGM_Tracer* tracer) noexcept { destroy(cast_to_cpp(tracer)); }
+
+void PGM_tracer_clear(PGM_Handle* handle, PGM_Tracer* tracer) noexcept {
+    call_with_catch(handle, [tracer] { safe_ptr_get(cast_to_cpp(tracer)).clear(); });
+}
+
+PGM_Idx PGM_tracer_n_events(PGM_Handle* handle, PGM_Tracer const* tracer) noexcept {
+    return call_with_catch(handle, [tracer] { return safe_ptr_get(cast_to_cpp(tracer)).n_events(); });
+}
+
+PGM_Idx PGM_tracer_n_dropped_events(PGM_Handle* handle, PGM_Tracer const* tracer) noexcept {
+    return call_with_catch(handle, [tracer] { return safe_ptr_get(cast_to_cpp(tracer)).n_dropped_events(); });
+}
+
+void PGM_tracer_write_chrome_trace(PGM_Handle* handle, PGM_Tracer const* tracer, char const* file_path) noexcept {
+    call_with_catch(
+        handle,
+        [tracer, file_path] {
+            safe_ptr_get(cast_to_cpp(tracer)).write_chrome_trace(std::filesystem::path{safe_str_view(file_path)});
+        },
+        tracer_write_exception_handler);
+}
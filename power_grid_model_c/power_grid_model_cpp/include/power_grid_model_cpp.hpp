@@ -10,12 +10,14 @@
 
 #include "power_grid_model_cpp/basics.hpp"
 #include "power_grid_model_cpp/buffer.hpp"
+#include "power_grid_model_cpp/calculation_info.hpp"
 #include "power_grid_model_cpp/dataset.hpp"
 #include "power_grid_model_cpp/handle.hpp"
 #include "power_grid_model_cpp/meta_data.hpp"
 #include "power_grid_model_cpp/model.hpp"
 #include "power_grid_model_cpp/options.hpp"
 #include "power_grid_model_cpp/serialization.hpp"
+#include "power_grid_model_cpp/tracer.hpp"
 #include "power_grid_model_cpp/utils.hpp"
 
 #endif // POWER_GRID_MODEL_CPP_HPP
@@ -41,6 +41,8 @@ using RawDatasetInfo = PGM_DatasetInfo;
 using RawOptions = PGM_Options;
 using RawDeserializer = PGM_Deserializer;
 using RawSerializer = PGM_Serializer;
+using RawCalculationInfo = PGM_CalculationInfo;
+using RawTracer = PGM_Tracer;
 
 namespace detail {
 // custom deleter
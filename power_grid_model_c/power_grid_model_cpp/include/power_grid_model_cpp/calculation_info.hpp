@@ -0,0 +1,78 @@
+// SPDX-FileCopyrightText: Contributors to the Power Grid Model project <powergridmodel@lfenergy.org>
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+#ifndef POWER_GRID_MODEL_CPP_CALCULATION_INFO_HPP
+#define POWER_GRID_MODEL_CPP_CALCULATION_INFO_HPP
+
+#include "basics.hpp"
+#include "handle.hpp"
+
+#include "power_grid_model_c/calculation_info.h"
+
+#include <string>
+#include <vector>
+
+namespace power_grid_model_cpp {
+class CalculationInfo {
+  public:
+    struct Entry {
+        Idx event{};
+        double value{};
+    };
+    struct ScenarioEntry {
+        Idx scenario{};
+        Idx event{};
+        double value{};
+    };
+
+    CalculationInfo() : info_{handle_.call_with(PGM_create_calculation_info)} {}
+
+    RawCalculationInfo* get() { return info_.get(); }
+    RawCalculationInfo const* get() const { return info_.get(); }
+
+    void clear() { handle_.call_with(PGM_calculation_info_clear, get()); }
+
+    std::vector<Entry> entries() const {
+        Idx const n_entries = handle_.call_with(PGM_calculation_info_n_entries, get());
+        std::vector<Idx> events(n_entries);
+        std::vector<double> values(n_entries);
+        handle_.call_with(PGM_calculation_info_get_entries, get(), events.data(), values.data());
+
+        std::vector<Entry> result;
+        result.reserve(n_entries);
+        for (Idx idx = 0; idx != n_entries; ++idx) {
+            result.push_back({.event = events[idx], .value = values[idx]});
+        }
+        return result;
+    }
+
+    std::vector<ScenarioEntry> scenario_entries() const {
+        Idx const n_entries = handle_.call_with(PGM_calculation_info_n_scenario_entries, get());
+        std::vector<Idx> scenarios(n_entries);
+        std::vector<Idx> events(n_entries);
+        std::vector<double> values(n_entries);
+        handle_.call_with(PGM_calculation_info_get_scenario_entries, get(), scenarios.data(), events.data(),
+                          values.data());
+
+        std::vector<ScenarioEntry> result;
+        result.reserve(n_entries);
+        for (Idx idx = 0; idx != n_entries; ++idx) {
+            result.push_back({.scenario = scenarios[idx], .event = events[idx], .value = values[idx]});
+        }
+        return result;
+    }
+
+    static std::string event_name(Idx event) {
+        Handle const handle{};
+        return std::string{handle.call_with(PGM_calculation_info_event_name, event)};
+    }
+
+  private:
+    Handle handle_{};
+    detail::UniquePtr<RawCalculationInfo, &PGM_destroy_calculation_info> info_;
+};
+} // namespace power_grid_model_cpp
+
+#endif // POWER_GRID_MODEL_CPP_CALCULATION_INFO_HPP
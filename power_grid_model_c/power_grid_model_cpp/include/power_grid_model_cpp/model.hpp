@@ -7,9 +7,11 @@
 #define POWER_GRID_MODEL_CPP_MODEL_HPP
 
 #include "basics.hpp"
+#include "calculation_info.hpp"
 #include "dataset.hpp"
 #include "handle.hpp"
 #include "options.hpp"
+#include "tracer.hpp"
 
 #include "power_grid_model_c/model.h"
 
@@ -42,6 +44,39 @@ class Model {
         handle_.call_with(PGM_update_model, get(), update_dataset.get());
     }
 
+    void set_worker_pool(Idx n_workers) { handle_.call_with(PGM_set_model_worker_pool, get(), n_workers); }
+
+    // the calculation info should outlive the model, nullptr to stop collecting
+    void set_calculation_info(CalculationInfo* info) {
+        handle_.call_with(PGM_set_model_calculation_info, get(), info == nullptr ? nullptr : info->get());
+    }
+
+    // the tracer should outlive the model, nullptr to stop tracing
+    void set_tracer(Tracer* tracer) {
+        handle_.call_with(PGM_set_model_tracer, get(), tracer == nullptr ? nullptr : tracer->get());
+    }
+
+    Idx get_topology_snapshot_size() { return handle_.call_with(PGM_get_model_topology_snapshot_size, get()); }
+    void save_topology_snapshot(char* buffer, Idx size) {
+        handle_.call_with(PGM_save_model_topology_snapshot, get(), buffer, size);
+    }
+    std::vector<char> save_topology_snapshot() {
+        std::vector<char> snapshot(get_topology_snapshot_size());
+        save_topology_snapshot(snapshot.data(), static_cast<Idx>(snapshot.size()));
+        return snapshot;
+    }
+    void save_topology_snapshot_to_file(std::string const& file_path) {
+        handle_.call_with(PGM_save_model_topology_snapshot_to_file, get(), file_path.c_str());
+    }
+
+    // the data is only read during the call, e.g., a memory-mapped snapshot file
+    void load_topology_snapshot(char const* data, Idx size) {
+        handle_.call_with(PGM_load_model_topology_snapshot, get(), data, size);
+    }
+    void load_topology_snapshot(std::vector<char> const& data) {
+        load_topology_snapshot(data.data(), static_cast<Idx>(data.size()));
+    }
+
     void get_indexer(std::string const& component, Idx size, ID const* ids, Idx* indexer) const {
         handle_.call_with(PGM_get_indexer, get(), component.c_str(), size, ids, indexer);
     }
@@ -54,6 +89,10 @@ class Model {
         handle_.call_with(PGM_calculate, get(), opt.get(), output_dataset.get(), nullptr);
     }
 
+    void calculate_short_circuit_sweep(Options const& opt, DatasetMutable const& output_dataset) {
+        handle_.call_with(PGM_calculate_short_circuit_sweep, get(), opt.get(), output_dataset.get());
+    }
+
   private:
     Handle handle_{};
     detail::UniquePtr<PowerGridModel, &PGM_destroy_model> model_;
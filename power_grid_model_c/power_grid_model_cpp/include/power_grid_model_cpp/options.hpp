@@ -39,6 +39,18 @@ class Options {
         handle_.call_with(PGM_set_tap_changing_strategy, get(), tap_changing_strategy);
     }
 
+    void set_pf_initialization(Idx pf_initialization) {
+        handle_.call_with(PGM_set_pf_initialization, get(), pf_initialization);
+    }
+
+    void set_sparse_ordering(Idx sparse_ordering) {
+        handle_.call_with(PGM_set_sparse_ordering, get(), sparse_ordering);
+    }
+
+    void set_observability_check_only(Idx observability_check_only) {
+        handle_.call_with(PGM_set_observability_check_only, get(), observability_check_only);
+    }
+
     void set_experimental_features(Idx experimental_features) {
         handle_.call_with(PGM_set_experimental_features, get(), experimental_features);
     }
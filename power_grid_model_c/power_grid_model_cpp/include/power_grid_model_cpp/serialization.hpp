@@ -45,6 +45,8 @@ class Deserializer {
 
     DatasetWritable& get_dataset() { return dataset_; }
 
+    void set_threading(Idx threading) { handle_.call_with(PGM_deserializer_set_threading, get(), threading); }
+
     void parse_to_buffer() { handle_.call_with(PGM_deserializer_parse_to_buffer, get()); }
 
   private:
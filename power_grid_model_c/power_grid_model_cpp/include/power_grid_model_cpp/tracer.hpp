@@ -0,0 +1,40 @@
+// SPDX-FileCopyrightText: Contributors to the Power Grid Model project <powergridmodel@lfenergy.org>
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+#ifndef POWER_GRID_MODEL_CPP_TRACER_HPP
+#define POWER_GRID_MODEL_CPP_TRACER_HPP
+
+#include "basics.hpp"
+#include "handle.hpp"
+
+#include "power_grid_model_c/tracer.h"
+
+#include <string>
+
+namespace power_grid_model_cpp {
+class Tracer {
+  public:
+    Tracer() : tracer_{handle_.call_with(PGM_create_tracer)} {}
+
+    RawTracer* get() { return tracer_.get(); }
+    RawTracer const* get() const { return tracer_.get(); }
+
+    void clear() { handle_.call_with(PGM_tracer_clear, get()); }
+
+    Idx n_events() const { return handle_.call_with(PGM_tracer_n_events, get()); }
+
+    Idx n_dropped_events() const { return handle_.call_with(PGM_tracer_n_dropped_events, get()); }
+
+    void write_chrome_trace(std::string const& file_path) const {
+        handle_.call_with(PGM_tracer_write_chrome_trace, get(), file_path.c_str());
+    }
+
+  private:
+    Handle handle_{};
+    detail::UniquePtr<RawTracer, &PGM_destroy_tracer> tracer_;
+};
+} // namespace power_grid_model_cpp
+
+#endif // POWER_GRID_MODEL_CPP_TRACER_HPP
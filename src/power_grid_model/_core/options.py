@@ -44,6 +44,9 @@ class Options:
     threading = OptionSetter(get_pgc().set_threading)
     tap_changing_strategy = OptionSetter(get_pgc().set_tap_changing_strategy)
     short_circuit_voltage_scaling = OptionSetter(get_pgc().set_short_circuit_voltage_scaling)
+    pf_initialization = OptionSetter(get_pgc().set_pf_initialization)
+    sparse_ordering = OptionSetter(get_pgc().set_sparse_ordering)
+    observability_check_only = OptionSetter(get_pgc().set_observability_check_only)
     experimental_features = OptionSetter(get_pgc().set_experimental_features)
 
     @property
@@ -42,6 +42,8 @@ VoidPtr = c_void_p
 """Raw void pointer."""
 VoidDoublePtr = POINTER(c_void_p)
 """Double pointer to void."""
+DoublePtr = POINTER(c_double)
+"""Raw pointer to double."""
 
 # functions with size_t return
 _FUNC_SIZE_T_RES = {"meta_class_size", "meta_class_alignment", "meta_attribute_offset"}
@@ -122,6 +124,18 @@ class SerializerPtr(c_void_p):
     """
 
 
+class CalculationInfoPtr(c_void_p):
+    """
+    Pointer to calculation info
+    """
+
+
+class TracerPtr(c_void_p):
+    """
+    Pointer to tracer
+    """
+
+
 def _load_core() -> CDLL:
     """
 
@@ -325,6 +339,18 @@ class PowerGridCore:
     def set_short_circuit_voltage_scaling(self, opt: OptionsPtr, short_circuit_voltage_scaling: int) -> None:  # type: ignore[empty-body]
         pass  # pragma: no cover
 
+    @make_c_binding
+    def set_pf_initialization(self, opt: OptionsPtr, pf_initialization: int) -> None:  # type: ignore[empty-body]
+        pass  # pragma: no cover
+
+    @make_c_binding
+    def set_sparse_ordering(self, opt: OptionsPtr, sparse_ordering: int) -> None:  # type: ignore[empty-body]
+        pass  # pragma: no cover
+
+    @make_c_binding
+    def set_observability_check_only(self, opt: OptionsPtr, observability_check_only: int) -> None:  # type: ignore[empty-body]
+        pass  # pragma: no cover
+
     @make_c_binding
     def set_experimental_features(self, opt: OptionsPtr, experimental_features: int) -> None:  # type: ignore[empty-body]
         pass  # pragma: no cover
@@ -365,6 +391,109 @@ class PowerGridCore:
     def copy_model(self, model: ModelPtr) -> ModelPtr:  # type: ignore[empty-body]
         pass  # pragma: no cover
 
+    @make_c_binding
+    def set_model_worker_pool(self, model: ModelPtr, n_workers: int) -> None:  # type: ignore[empty-body]
+        pass  # pragma: no cover
+
+    @make_c_binding
+    def set_model_calculation_info(  # type: ignore[empty-body]
+        self, model: ModelPtr, info: CalculationInfoPtr
+    ) -> None:
+        pass  # pragma: no cover
+
+    @make_c_binding
+    def create_calculation_info(self) -> CalculationInfoPtr:  # type: ignore[empty-body]
+        pass  # pragma: no cover
+
+    @make_c_binding
+    def destroy_calculation_info(self, info: CalculationInfoPtr) -> None:  # type: ignore[empty-body]
+        pass  # pragma: no cover
+
+    @make_c_binding
+    def calculation_info_clear(self, info: CalculationInfoPtr) -> None:  # type: ignore[empty-body]
+        pass  # pragma: no cover
+
+    @make_c_binding
+    def calculation_info_n_entries(self, info: CalculationInfoPtr) -> int:  # type: ignore[empty-body]
+        pass  # pragma: no cover
+
+    @make_c_binding
+    def calculation_info_get_entries(  # type: ignore[empty-body]
+        self,
+        info: CalculationInfoPtr,
+        events: IdxPtr,  # type: ignore[valid-type]
+        values: DoublePtr,  # type: ignore[valid-type]
+    ) -> None:
+        pass  # pragma: no cover
+
+    @make_c_binding
+    def calculation_info_n_scenario_entries(self, info: CalculationInfoPtr) -> int:  # type: ignore[empty-body]
+        pass  # pragma: no cover
+
+    @make_c_binding
+    def calculation_info_get_scenario_entries(  # type: ignore[empty-body]
+        self,
+        info: CalculationInfoPtr,
+        scenarios: IdxPtr,  # type: ignore[valid-type]
+        events: IdxPtr,  # type: ignore[valid-type]
+        values: DoublePtr,  # type: ignore[valid-type]
+    ) -> None:
+        pass  # pragma: no cover
+
+    @make_c_binding
+    def calculation_info_event_name(self, event: int) -> str:  # type: ignore[empty-body]
+        pass  # pragma: no cover
+
+    @make_c_binding
+    def set_model_tracer(self, model: ModelPtr, tracer: TracerPtr) -> None:  # type: ignore[empty-body]
+        pass  # pragma: no cover
+
+    @make_c_binding
+    def get_model_topology_snapshot_size(self, model: ModelPtr) -> int:  # type: ignore[empty-body]
+        pass  # pragma: no cover
+
+    @make_c_binding
+    def save_model_topology_snapshot(  # type: ignore[empty-body]
+        self, model: ModelPtr, buffer: CharPtr, size: int
+    ) -> None:
+        pass  # pragma: no cover
+
+    @make_c_binding
+    def save_model_topology_snapshot_to_file(  # type: ignore[empty-body]
+        self, model: ModelPtr, file_path: str
+    ) -> None:
+        pass  # pragma: no cover
+
+    @make_c_binding
+    def load_model_topology_snapshot(  # type: ignore[empty-body]
+        self, model: ModelPtr, data: bytes, size: int
+    ) -> None:
+        pass  # pragma: no cover
+
+    @make_c_binding
+    def create_tracer(self) -> TracerPtr:  # type: ignore[empty-body]
+        pass  # pragma: no cover
+
+    @make_c_binding
+    def destroy_tracer(self, tracer: TracerPtr) -> None:  # type: ignore[empty-body]
+        pass  # pragma: no cover
+
+    @make_c_binding
+    def tracer_clear(self, tracer: TracerPtr) -> None:  # type: ignore[empty-body]
+        pass  # pragma: no cover
+
+    @make_c_binding
+    def tracer_n_events(self, tracer: TracerPtr) -> int:  # type: ignore[empty-body]
+        pass  # pragma: no cover
+
+    @make_c_binding
+    def tracer_n_dropped_events(self, tracer: TracerPtr) -> int:  # type: ignore[empty-body]
+        pass  # pragma: no cover
+
+    @make_c_binding
+    def tracer_write_chrome_trace(self, tracer: TracerPtr, file_path: str) -> None:  # type: ignore[empty-body]
+        pass  # pragma: no cover
+
     @make_c_binding
     def get_indexer(
         self,
@@ -534,6 +663,12 @@ class PowerGridCore:
     def deserializer_get_dataset(self, deserializer: DeserializerPtr) -> WritableDatasetPtr:  # type: ignore[empty-body]
         pass  # pragma: no cover
 
+    @make_c_binding
+    def deserializer_set_threading(  # type: ignore[empty-body]
+        self, deserializer: DeserializerPtr, threading: int
+    ) -> None:
+        pass  # pragma: no cover
+
     @make_c_binding
     def deserializer_parse_to_buffer(self, deserializer: DeserializerPtr) -> None:  # type: ignore[empty-body]
         pass  # pragma: no cover
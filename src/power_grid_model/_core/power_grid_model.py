@@ -618,7 +618,8 @@ class PowerGridModel:
                 in 1D flat structure.
                 E.g., if you have three batch datasets with batch sizes 2, 3, and 4 respectively,
                 and the number of nodes is 5, the final output for nodes will have shape (2*3*4, 5).
-            threading (int, optional): Applicable only for batch calculation.
+            threading (int, optional): For a batch calculation, the scenarios are calculated in parallel.
+                For a single calculation, the electrically isolated subgrids are solved in parallel.
 
                 - < 0: Sequential
                 - = 0: Parallel, use number of hardware threads
@@ -805,7 +806,8 @@ class PowerGridModel:
                 in 1D flat structure.
                 E.g., if you have three batch datasets with batch sizes 2, 3, and 4 respectively,
                 and the number of nodes is 5, the final output for nodes will have shape (2*3*4, 5).
-            threading (int, optional): Applicable only for batch calculation.
+            threading (int, optional): For a batch calculation, the scenarios are calculated in parallel.
+                For a single calculation, the electrically isolated subgrids are solved in parallel.
 
                 - < 0: Sequential
                 - = 0: Parallel, use number of hardware threads
@@ -969,7 +971,8 @@ class PowerGridModel:
                 in 1D flat structure.
                 E.g., if you have three batch datasets with batch sizes 2, 3, and 4 respectively,
                 and the number of nodes is 5, the final output for nodes will have shape (2*3*4, 5).
-            threading (int, optional): Applicable only for batch calculation.
+            threading (int, optional): For a batch calculation, the scenarios are calculated in parallel.
+                For a single calculation, the electrically isolated subgrids are solved in parallel.
 
                 - < 0: Sequential
                 - = 0: Parallel, use number of hardware threads
@@ -10,9 +10,19 @@
 #include <power_grid_model/common/timer.hpp>
 #include <power_grid_model/main_model.hpp>
 #include <power_grid_model/math_solver/math_solver.hpp>
+#include <power_grid_model/sparse_ordering.hpp>
 
+#include <algorithm>
+#include <chrono>
 #include <iomanip>
 #include <iostream>
+#include <map>
+#include <random>
+#include <set>
+#include <span>
+#include <string_view>
+#include <utility>
+#include <vector>
 
 namespace power_grid_model::benchmark {
 namespace {
@@ -44,6 +54,12 @@ constexpr std::string to_string(LogEvent tag) {
         return "Scenario exception"s;
     case recover_from_bad:
         return "Recover from bad"s;
+    case begin_scenario:
+        return "Begin scenario"s;
+    case end_scenario:
+        return "End scenario"s;
+    case begin_batch:
+        return "Begin batch"s;
     case prepare:
         return "Prepare"s;
     case create_math_solver:
@@ -100,7 +116,7 @@ std::string make_key(LogEvent code) {
         }
         key += "\t";
     }
-    key += to_string(code);
+    key += benchmark::to_string(code); // not the to_string of the logging module, the labels differ
     return key;
 }
 
@@ -133,9 +149,91 @@ auto get_benchmark_run_title(Option const& option, MainModelOptions const& model
     return std::format("============= Benchmark case: {}, {}, {} =============\n", mv_ring_type, sym_type, method);
 }
 
+// graph of the nodes in the meshed part of the grid, which is the part that is reordered during topology construction
+std::map<Idx, IdxVector> meshed_node_graph(InputData const& input) {
+    std::map<ID, std::set<ID>> adjacency;
+    auto const add_branches = [&adjacency](auto const& branches) {
+        for (auto const& branch : branches) {
+            if (branch.from_status != 0 && branch.to_status != 0 && branch.from_node != branch.to_node) {
+                adjacency[branch.from_node].insert(branch.to_node);
+                adjacency[branch.to_node].insert(branch.from_node);
+            }
+        }
+    };
+    add_branches(input.line);
+    add_branches(input.transformer);
+
+    // remove the far-end nodes of tree structures until only cycles remain
+    std::vector<ID> far_end_nodes;
+    for (auto const& [node, adjacent] : adjacency) {
+        if (adjacent.size() <= 1) {
+            far_end_nodes.push_back(node);
+        }
+    }
+    while (!far_end_nodes.empty()) {
+        ID const node = far_end_nodes.back();
+        far_end_nodes.pop_back();
+        auto const node_it = adjacency.find(node);
+        if (node_it == adjacency.end()) {
+            continue;
+        }
+        for (ID const other : node_it->second) {
+            auto& other_adjacent = adjacency[other];
+            other_adjacent.erase(node);
+            if (other_adjacent.size() == 1) {
+                far_end_nodes.push_back(other);
+            }
+        }
+        adjacency.erase(node_it);
+    }
+
+    std::map<Idx, IdxVector> graph;
+    for (auto const& [node, adjacent] : adjacency) {
+        graph[node];
+        for (ID const other : adjacent) {
+            if (other > node) {
+                graph[node].push_back(other);
+            }
+        }
+    }
+    return graph;
+}
+
+// calculation info that also keeps the duration of each thread of a batch calculation
+// every thread logs its total once, when it has finished its scenarios
+class ThreadCalculationInfo : public common::logging::CalculationInfo {
+  public:
+    using CalculationInfo::log;
+
+    void log(LogEvent tag, double value) override {
+        if (tag == LogEvent::total_batch_calculation_in_thread) {
+            thread_durations_.push_back(value);
+        }
+        CalculationInfo::log(tag, value);
+    }
+
+    std::vector<double> const& thread_durations() const { return thread_durations_; }
+    void clear() {
+        CalculationInfo::clear();
+        thread_durations_.clear();
+    }
+
+  private:
+    std::vector<double> thread_durations_;
+};
+
+class MultiThreadedThreadCalculationInfo : public common::logging::MultiThreadedLoggerImpl<ThreadCalculationInfo> {
+  public:
+    using MultiThreadedLoggerImpl<ThreadCalculationInfo>::MultiThreadedLoggerImpl;
+
+    CalculationInfo::Report report() const { return get().report(); }
+    std::vector<double> const& thread_durations() const { return get().thread_durations(); }
+    void clear() { get().clear(); }
+};
+
 struct PowerGridBenchmark {
     static constexpr auto single_scenario = -1;
-    power_grid_model::common::logging::MultiThreadedCalculationInfo info{};
+    MultiThreadedThreadCalculationInfo info{};
 
     PowerGridBenchmark()
         : main_model{std::make_unique<MainModel>(50.0, meta_data::meta_data_gen::meta_data,
@@ -148,7 +246,7 @@ struct PowerGridBenchmark {
         }
 
         auto output = generator.generate_output_data<OutputDataType>(batch_size);
-        BatchData const batch_data = generator.generate_batch_input(batch_size, 0);
+        BatchData const batch_data = generator.generate_batch_input(batch_size, 0, heavy_scenario_period);
         std::cout << "Number of nodes: " << generator.input_data().node.size() << '\n';
 
         try {
@@ -200,6 +298,7 @@ struct PowerGridBenchmark {
                 Timer const t_build{info, LogEvent::build_model};
                 main_model =
                     std::make_unique<MainModel>(50.0, input.get_dataset(), get_math_solver_dispatcher(), 0, info);
+                main_model->set_batch_scheduling(batch_scheduling);
             }
             run(single_scenario);
         }
@@ -225,14 +324,116 @@ struct PowerGridBenchmark {
         std::cout << "\n\n";
     }
 
-    static void print_info(MultiThreadedCalculationInfo const& info) {
+    void run_sparse_ordering_benchmark(Option const& option) {
+        using enum SparseOrderingMethod;
+
+        generator.generate_grid(option, 0);
+        auto const graph = meshed_node_graph(generator.input_data());
+
+        std::cout << "============= Benchmark case: sparse ordering of meshed grid =============\n\n";
+        std::cout << "Number of nodes in cycles: " << graph.size() << '\n';
+        for (auto const method : {minimum_degree, approximate_minimum_degree}) {
+            auto const start = std::chrono::high_resolution_clock::now();
+            auto const [alpha, fills] = sparse_ordering(graph, method);
+            auto const stop = std::chrono::high_resolution_clock::now();
+
+            auto const duration = std::chrono::duration_cast<std::chrono::microseconds>(stop - start);
+            std::cout << std::format("{}: {} fill-ins, {} microseconds\n",
+                                     method == minimum_degree ? "Minimum degree" : "Approximate minimum degree",
+                                     fills.size(), duration.count());
+        }
+        std::cout << "\n\n";
+    }
+
+    // model construction and the id lookups of update data of which the sequence cannot be cached
+    void run_id_lookup_benchmark(Option const& option, Idx batch_size) {
+        using enum CalculationType;
+        using enum CalculationSymmetry;
+        using enum CalculationMethod;
+
+        generator.generate_grid(option, 0);
+        InputData const& input = generator.input_data();
+
+        std::cout << "============= Benchmark case: model build and dependent batch update =============\n\n";
+        std::cout << "Number of nodes: " << input.node.size() << '\n';
+
+        auto const time_in_microseconds = [](auto&& func) {
+            auto const start = std::chrono::high_resolution_clock::now();
+            func();
+            auto const stop = std::chrono::high_resolution_clock::now();
+            return std::chrono::duration_cast<std::chrono::microseconds>(stop - start).count();
+        };
+
+        try {
+            constexpr Idx n_repeat = 5;
+            std::chrono::microseconds::rep build_duration{};
+            for (Idx repeat = 0; repeat != n_repeat; ++repeat) {
+                build_duration += time_in_microseconds([this, &input] {
+                    main_model =
+                        std::make_unique<MainModel>(50.0, input.get_dataset(), get_math_solver_dispatcher(), 0, info);
+                });
+            }
+            std::cout << std::format("Build model: {} microseconds\n", build_duration / n_repeat);
+
+            // Deliberately use default seed for reproducability
+            // NOLINTNEXTLINE(cert-msc32-c, cert-msc51-cpp)
+            std::mt19937_64 gen{};
+            std::vector<ID> load_ids(input.sym_load.size());
+            std::ranges::transform(input.sym_load, load_ids.begin(), &SymLoadGenInput::id);
+            std::ranges::shuffle(load_ids, gen);
+            std::vector<Idx> indexer(load_ids.size());
+            auto const indexer_duration = time_in_microseconds([this, &load_ids, &indexer] {
+                main_model->get_indexer("sym_load", load_ids.data(), std::ssize(load_ids), indexer.data());
+            });
+            std::cout << std::format("Get indexer of {} loads: {} microseconds\n", load_ids.size(), indexer_duration);
+
+            // the loads are in a different order in every scenario, so the sequence is looked up for every scenario
+            BatchData const independent_batch = generator.generate_batch_input(batch_size, 0);
+            BatchData dependent_batch = independent_batch;
+            auto const n_load = std::ssize(input.sym_load);
+            for (Idx const batch : IdxRange{batch_size}) {
+                std::span const scenario_loads{dependent_batch.sym_load.begin() + batch * n_load,
+                                               static_cast<size_t>(n_load)};
+                std::ranges::shuffle(scenario_loads, gen);
+            }
+
+            auto output = generator.generate_output_data<OutputData<symmetric_t>>(batch_size);
+            MainModelOptions const model_options{
+                .calculation_type = power_flow, .calculation_symmetry = symmetric, .calculation_method = linear};
+            using NamedBatch = std::pair<std::string_view, BatchData const*>;
+            for (NamedBatch const& named_batch :
+                 {NamedBatch{"independent", &independent_batch}, NamedBatch{"dependent", &dependent_batch}}) {
+                auto const& [name, batch_data] = named_batch;
+                auto const update_data = batch_data->get_dataset();
+                auto const duration = time_in_microseconds([this, &model_options, &output, &update_data] {
+                    main_model->calculate(model_options, output.get_dataset(), update_data);
+                });
+                std::cout << std::format("Batch linear power flow with {} updates: {} microseconds\n", name,
+                                         duration);
+            }
+        } catch (std::exception const& e) {
+            std::cout << std::format("\nAn exception was raised during execution: {}\n", e.what());
+        }
+        info.clear();
+        std::cout << "\n\n";
+    }
+
+    static void print_info(MultiThreadedThreadCalculationInfo const& info) {
         for (auto const& [key, val] : info.report()) {
             std::cout << make_key(key) << ": " << val << '\n';
         }
+        // the threads start together, so the spread of their durations is the time that the fastest thread idles
+        if (auto const& thread_durations = info.thread_durations(); thread_durations.size() > 1) {
+            auto const [fastest, slowest] = std::ranges::minmax(thread_durations);
+            std::cout << "Slowest thread: " << slowest << '\n';
+            std::cout << "Spread of the thread finish times: " << slowest - fastest << '\n';
+        }
     }
 
     std::unique_ptr<MainModel> main_model;
     FictionalGridGenerator generator;
+    Idx heavy_scenario_period{0}; // if positive, every n-th batch scenario is more expensive to calculate
+    JobDispatch::BatchScheduling batch_scheduling{JobDispatch::BatchScheduling::dynamic};
 };
 } // namespace
 } // namespace power_grid_model::benchmark
@@ -242,6 +443,7 @@ int main(int /* argc */, char** /* argv */) {
     using enum power_grid_model::CalculationMethod;
     using enum power_grid_model::CalculationSymmetry;
     using enum power_grid_model::OptimizerType;
+    using BatchScheduling = power_grid_model::JobDispatch::BatchScheduling;
 
     power_grid_model::benchmark::PowerGridBenchmark benchmarker{};
     power_grid_model::benchmark::Option option{};
@@ -262,6 +464,24 @@ int main(int /* argc */, char** /* argv */) {
     power_grid_model::Idx constexpr batch_size = 1000;
 #endif
 
+    std::cout << "\n\n##### BENCHMARK SPARSE ORDERING #####\n\n";
+    option.has_measurements = false;
+    option.has_fault = false;
+    option.has_tap_changer = false;
+    option.has_mv_ring = true;
+    option.has_lv_ring = false;
+    benchmarker.run_sparse_ordering_benchmark(option);
+    option.has_lv_ring = true;
+    benchmarker.run_sparse_ordering_benchmark(option);
+
+    std::cout << "\n\n##### BENCHMARK MODEL BUILD AND ID LOOKUP #####\n\n";
+    option.has_measurements = false;
+    option.has_fault = false;
+    option.has_tap_changer = false;
+    option.has_mv_ring = false;
+    option.has_lv_ring = false;
+    benchmarker.run_id_lookup_benchmark(option, batch_size);
+
     std::cout << "\n\n##### BENCHMARK POWER FLOW #####\n\n";
     option.has_measurements = false;
     option.has_fault = false;
@@ -330,6 +550,37 @@ int main(int /* argc */, char** /* argv */) {
     //                                    .calculation_method = iterative_current,
     //                                    .max_iter = 100});
 
+    std::cout << "\n\n##### BENCHMARK BATCH POWER FLOW WITH UNEQUAL SCENARIO COSTS #####\n\n";
+    option.has_measurements = false;
+    option.has_fault = false;
+    option.has_tap_changer = false;
+
+    // every 6th scenario is heavily loaded and needs more iterations;
+    // with 6 threads, the static round-robin baseline gives all of them to the same thread
+    benchmarker.heavy_scenario_period = 6;
+    option.has_mv_ring = true;
+    option.has_lv_ring = false;
+    for (auto const batch_scheduling : {BatchScheduling::static_round_robin, BatchScheduling::dynamic}) {
+        benchmarker.batch_scheduling = batch_scheduling;
+        std::cout << (batch_scheduling == BatchScheduling::dynamic ? "Dynamic scheduling\n\n"
+                                                                   : "Static round-robin scheduling\n\n");
+        benchmarker.run_benchmark(option,
+                                  {.calculation_type = power_flow,
+                                   .calculation_symmetry = symmetric,
+                                   .calculation_method = newton_raphson,
+                                   .threading = 6},
+                                  batch_size);
+        benchmarker.run_benchmark(option,
+                                  {.calculation_type = power_flow,
+                                   .calculation_symmetry = symmetric,
+                                   .calculation_method = iterative_current,
+                                   .max_iter = 100,
+                                   .threading = 6},
+                                  batch_size);
+    }
+    benchmarker.heavy_scenario_period = 0;
+    benchmarker.batch_scheduling = BatchScheduling::dynamic;
+
     std::cout << "\n\n##### BENCHMARK POWER FLOW WITH AUTOMATIC TAP CHANGER #####\n\n";
     option.has_measurements = false;
     option.has_fault = false;
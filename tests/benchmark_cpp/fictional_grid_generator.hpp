@@ -205,13 +205,16 @@ class FictionalGridGenerator {
 
     BatchData generate_batch_input(Idx batch_size) { return generate_batch_input(batch_size, std::random_device{}()); }
 
-    BatchData generate_batch_input(Idx batch_size, std::random_device::result_type seed) {
+    // every heavy_scenario_period-th scenario (if positive) gets heavily increased loading, which takes more
+    // iterations to solve, so that the scenarios in the batch have unequal costs
+    BatchData generate_batch_input(Idx batch_size, std::random_device::result_type seed,
+                                   Idx heavy_scenario_period = 0) {
         batch_size = std::max(batch_size, Idx{0});
         gen_ = std::mt19937_64{seed};
         BatchData batch_data{};
         batch_data.batch_size = batch_size;
-        generate_load_series(input_.sym_load, batch_data.sym_load, batch_size);
-        generate_load_series(input_.asym_load, batch_data.asym_load, batch_size);
+        generate_load_series(input_.sym_load, batch_data.sym_load, batch_size, heavy_scenario_period);
+        generate_load_series(input_.asym_load, batch_data.asym_load, batch_size, heavy_scenario_period);
         generate_power_sensor_series(input_.sym_power_sensor, batch_data.sym_power_sensor, batch_size);
         generate_power_sensor_series(input_.asym_power_sensor, batch_data.asym_power_sensor, batch_size);
         return batch_data;
@@ -642,11 +645,14 @@ class FictionalGridGenerator {
     }
 
     template <class T, class U>
-    void generate_load_series(std::vector<T> const& input, std::vector<U>& load_series, Idx batch_size) {
-        std::uniform_real_distribution<double> load_scaling_gen{0.0, 1.0};
+    void generate_load_series(std::vector<T> const& input, std::vector<U>& load_series, Idx batch_size,
+                              Idx heavy_scenario_period) {
+        constexpr double heavy_load_scaling = 2.5;
         load_series.resize(input.size() * batch_size);
         auto const n_object = std::ssize(input);
         for (Idx const batch : IdxRange{batch_size}) {
+            bool const is_heavy = heavy_scenario_period > 0 && batch % heavy_scenario_period == 0;
+            std::uniform_real_distribution<double> load_scaling_gen{0.0, is_heavy ? heavy_load_scaling : 1.0};
             for (Idx const object : IdxRange{n_object}) {
                 T const& input_obj = input[object];
                 U& update_obj = load_series[batch * n_object + object];
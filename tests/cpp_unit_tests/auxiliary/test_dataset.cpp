@@ -693,6 +693,14 @@ TEST_CASE_TEMPLATE("Test dataset (common)", DatasetType, ConstDataset, MutableDa
                             CHECK(element.a1 == a1_buffer[idx]);
                             CHECK(is_nan(element.a0));
                         }
+
+                        std::vector<A::InputType> rows(buffer_span.size());
+                        buffer_span.gather(rows);
+                        for (Idx idx = 0; idx < buffer_span.size(); ++idx) {
+                            CHECK(rows[idx].id == id_buffer[idx]);
+                            CHECK(rows[idx].a1 == a1_buffer[idx]);
+                            CHECK(is_nan(rows[idx].a0));
+                        }
                     };
                     auto const check_all_spans = [&] {
                         check_span(dataset.template get_columnar_buffer_span<input_getter_s, A>());
@@ -731,6 +739,20 @@ TEST_CASE_TEMPLATE("Test dataset (common)", DatasetType, ConstDataset, MutableDa
                             CHECK(a1_buffer[idx] == -2.0);
                             check_all_spans();
                         }
+
+                        std::vector<A::InputType> rows(buffer_span.size());
+                        std::ranges::transform(std::ranges::iota_view{ID{0}, total_elements}, rows.begin(),
+                                               [](ID value) {
+                                                   return A::InputType{.id = value + 5,
+                                                                       .a0 = -1.0,
+                                                                       .a1 = static_cast<double>(value) + 0.5};
+                                               });
+                        buffer_span.scatter(rows);
+                        for (Idx idx = 0; idx < buffer_span.size(); ++idx) {
+                            CHECK(id_buffer[idx] == idx + 5);
+                            CHECK(a1_buffer[idx] == static_cast<double>(idx) + 0.5);
+                        }
+                        check_all_spans();
                     }
 
                     double* a0_nullptr = nullptr;
@@ -770,6 +792,14 @@ TEST_CASE_TEMPLATE("Test dataset (common)", DatasetType, ConstDataset, MutableDa
                                 CHECK(element.a1 == a1_buffer[aux_idx + idx]);
                                 CHECK(is_nan(element.a0));
                             }
+
+                            std::vector<A::InputType> rows(buffer_span.size());
+                            buffer_span.gather(rows);
+                            for (Idx idx = 0; idx < buffer_span.size(); ++idx) {
+                                CHECK(rows[idx].id == id_buffer[aux_idx + idx]);
+                                CHECK(rows[idx].a1 == a1_buffer[aux_idx + idx]);
+                                CHECK(is_nan(rows[idx].a0));
+                            }
                         };
                         auto const check_all_spans = [&](auto const& scenario) {
                             check_span(dataset.template get_columnar_buffer_span<input_getter_s, A>());
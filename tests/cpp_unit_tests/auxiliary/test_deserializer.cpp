@@ -253,11 +253,12 @@ constexpr std::string_view json_batch = R"(
 }
 )";
 
-void check_error(std::string_view json, std::string_view err_msg) {
-    std::vector<NodeInput> node(1);
+void check_error(std::string_view json, std::string_view err_msg, Idx threading = -1) {
+    std::vector<NodeInput> node(4);
 
     auto const run = [&]() {
         Deserializer deserializer{from_json, json, meta_data_gen::meta_data};
+        deserializer.set_threading(threading);
         deserializer.get_dataset_info().set_buffer("node", nullptr, node.data());
         deserializer.parse();
     };
@@ -653,6 +654,40 @@ TEST_CASE("Deserializer") {
             CHECK(asym_load_q_specified[3](1) == doctest::Approx(80.0));
             CHECK(asym_load_q_specified[3](2) == std::numeric_limits<double>::infinity());
         }
+
+        SUBCASE("Check parse parallel") {
+            std::vector<SymLoadGenUpdate> sym_load(4);
+            std::vector<ID> asym_load_id(4);
+            std::vector<RealValue<asymmetric_t>> asym_load_q_specified(4);
+            IdxVector sym_load_indptr(deserializer.get_dataset_info().batch_size() + 1);
+            auto& info = deserializer.get_dataset_info();
+            info.set_buffer("sym_load", sym_load_indptr.data(), sym_load.data());
+            info.set_buffer("asym_load", nullptr, nullptr);
+            info.set_attribute_buffer("asym_load", "id", asym_load_id.data());
+            info.set_attribute_buffer("asym_load", "q_specified", asym_load_q_specified.data());
+
+            deserializer.set_threading(3);
+            deserializer.parse();
+
+            // sym_load
+            CHECK(sym_load_indptr == IdxVector{0, 1, 1, 3, 4});
+            CHECK(sym_load[0].id == 7);
+            CHECK(sym_load[0].p_specified == doctest::Approx(20.0));
+            CHECK(sym_load[1].id == 7);
+            CHECK(is_nan(sym_load[1].p_specified));
+            CHECK(sym_load[1].q_specified == doctest::Approx(10.0));
+            CHECK(sym_load[2].id == 8);
+            CHECK(sym_load[2].status == 0);
+            CHECK(sym_load[3].id == 37);
+            CHECK(sym_load[3].q_specified == std::numeric_limits<double>::infinity());
+
+            // asym_load
+            CHECK(asym_load_id == std::vector<ID>{9, 9, 9, 31});
+            CHECK(is_nan(asym_load_q_specified[0]));
+            CHECK(is_nan(asym_load_q_specified[1]));
+            CHECK(asym_load_q_specified[2](1) == doctest::Approx(80.0));
+            CHECK(asym_load_q_specified[3](0) == std::numeric_limits<double>::infinity());
+        }
     }
 }
 
@@ -710,6 +745,15 @@ true}]}]})";
         check_error(wrong_type_dict, "Position of error: data/0/node/0/id");
     }
 
+    SUBCASE("Error in batch data with parallel parsing") {
+        // the error of the first failed scenario is reported
+        constexpr std::string_view wrong_types =
+            R"({"version": "1.0", "type": "input", "is_batch": true, "attributes": {}, "data": [{"node": [{"id": 1}]},
+{"node": [{"id": true}]}, {"node": [{"id": 3}]}, {"node": [{"id": false}]}]})";
+        check_error(wrong_types, "Position of error: data/1/node/0/id", 4);
+        check_error(wrong_types, "Position of error: data/1/node/0/id", 2);
+    }
+
     SUBCASE("Last token") {
         CHECK(detail::JsonSAXVisitor::max_error_message_token_length == 100);
 
@@ -755,6 +799,11 @@ true}]}]})";
         check_error(json_invalid, "Json depth exceeds the limit of 10!\n");
     }
 
+    SUBCASE("Json root is not a map") {
+        check_error(R"([{"data": {}}])", "Json root should be a map!\n");
+        check_error("5", "Json root should be a map!\n");
+    }
+
     SUBCASE("Deeply nested msgpack") {
         constexpr std::string_view msgpack_invalid =
             "\x{81}\x{a4}data\x{91}\x{91}\x{91}\x{91}\x{91}\x{91}\x{91}\x{91}\x{91}\x{91}\x{91}\x{90}"sv;
@@ -0,0 +1,77 @@
+// SPDX-FileCopyrightText: Contributors to the Power Grid Model project <powergridmodel@lfenergy.org>
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include <power_grid_model/common/common.hpp>
+#include <power_grid_model/common/flat_id_index.hpp>
+
+#include <doctest/doctest.h>
+
+#include <vector>
+
+namespace power_grid_model {
+TEST_CASE("Flat ID index") {
+    FlatIdIndex index;
+    CHECK(index.size() == 0);
+    CHECK(index.find(1) == nullptr);
+    CHECK_FALSE(index.contains(na_IntID));
+
+    // enough entries to grow several times
+    constexpr Idx n_entries = 1000;
+    for (Idx pos = 0; pos != n_entries; ++pos) {
+        index.insert(static_cast<ID>(pos * 7), Idx2D{.group = pos % 3, .pos = pos});
+    }
+    index.insert(na_IntID, Idx2D{.group = 5, .pos = 6});
+    CHECK(index.size() == n_entries + 1);
+
+    SUBCASE("Find") {
+        for (Idx pos = 0; pos != n_entries; ++pos) {
+            Idx2D const* const found = index.find(static_cast<ID>(pos * 7));
+            REQUIRE(found != nullptr);
+            CHECK(*found == Idx2D{.group = pos % 3, .pos = pos});
+        }
+        CHECK(index.find(1) == nullptr);
+        CHECK(index.find(-7) == nullptr);
+        CHECK_FALSE(index.contains(n_entries * 7));
+        REQUIRE(index.contains(na_IntID));
+        CHECK(*index.find(na_IntID) == Idx2D{.group = 5, .pos = 6});
+    }
+
+    SUBCASE("Find each") {
+        std::vector<ID> const ids{14, 1, na_IntID, 0, 14};
+        std::vector<ID> found_ids;
+        std::vector<Idx2D const*> found;
+        index.find_each(ids, [&found_ids, &found](ID id, Idx2D const* idx_2d) {
+            found_ids.push_back(id);
+            found.push_back(idx_2d);
+        });
+        CHECK(found_ids == ids);
+        REQUIRE(found.size() == ids.size());
+        CHECK(found[0] == index.find(14));
+        CHECK(found[1] == nullptr);
+        CHECK(found[2] == index.find(na_IntID));
+        CHECK(found[3] == index.find(0));
+        CHECK(found[4] == index.find(14));
+    }
+
+    SUBCASE("Find id") {
+        CHECK(index.find_id(Idx2D{.group = 1, .pos = 4}) == 28);
+        CHECK(index.find_id(Idx2D{.group = 5, .pos = 6}) == na_IntID);
+        CHECK_FALSE(index.find_id(Idx2D{.group = 0, .pos = 1}).has_value());
+    }
+
+    SUBCASE("Reserve keeps entries") {
+        index.reserve(10 * n_entries);
+        CHECK(index.size() == n_entries + 1);
+        CHECK(*index.find(21) == Idx2D{.group = 0, .pos = 3});
+    }
+
+    SUBCASE("Copy") {
+        FlatIdIndex const copy = index;
+        index.insert(1, Idx2D{.group = 0, .pos = 0});
+        CHECK(index.contains(1));
+        CHECK_FALSE(copy.contains(1));
+        CHECK(copy.size() == n_entries + 1);
+    }
+}
+} // namespace power_grid_model
@@ -11,6 +11,7 @@
 
 #include <doctest/doctest.h>
 
+#include <atomic>
 #include <thread>
 #include <utility>
 #include <vector>
@@ -297,4 +298,154 @@ TEST_CASE("Test MultiThreadedCalculationInfo") {
         }
     }
 }
+
+TEST_CASE("Test ScenarioCalculationInfo") {
+    using enum LogEvent;
+    ScenarioCalculationInfo info{};
+
+    SUBCASE("Empty") {
+        CHECK(info.report().empty());
+        CHECK(info.scenario_report().empty());
+        CHECK(info.n_scenario_entries() == 0);
+    }
+
+    SUBCASE("Outside of scenarios") {
+        logger_helper(info);
+        report_checker_helper(info.report());
+        CHECK(info.scenario_report().empty());
+    }
+
+    SUBCASE("Log per scenario") {
+        info.log(build_model, 1.0); // outside of any scenario
+        info.log(begin_scenario, Idx{3});
+        info.log(math_solver, 2.0);
+        info.log(max_num_iter, Idx{4});
+        info.log(end_scenario);
+        info.log(begin_scenario, Idx{1});
+        info.log(math_solver, 5.0);
+        info.log(max_num_iter, Idx{2});
+        info.log(begin_scenario, Idx{2}); // implicitly ends the previous scenario
+        info.log(math_solver, 7.0);
+        info.log(end_scenario);
+        info.log(end_scenario); // ignored outside of a scenario
+
+        auto const& report = info.report();
+        CHECK(report.size() == 3);
+        CHECK(report.at(build_model) == doctest::Approx(1.0));
+        CHECK(report.at(math_solver) == doctest::Approx(14.0));
+        CHECK(report.at(max_num_iter) == doctest::Approx(4.0));
+
+        auto const scenario_report = info.scenario_report();
+        CHECK(info.n_scenario_entries() == 5);
+        REQUIRE(scenario_report.size() == 5);
+        // sorted by scenario, and by event within a scenario
+        CHECK(scenario_report[0].scenario == 1);
+        CHECK(scenario_report[0].tag == math_solver);
+        CHECK(scenario_report[0].value == doctest::Approx(5.0));
+        CHECK(scenario_report[1].scenario == 1);
+        CHECK(scenario_report[1].tag == max_num_iter);
+        CHECK(scenario_report[1].value == doctest::Approx(2.0));
+        CHECK(scenario_report[2].scenario == 2);
+        CHECK(scenario_report[2].tag == math_solver);
+        CHECK(scenario_report[2].value == doctest::Approx(7.0));
+        CHECK(scenario_report[3].scenario == 3);
+        CHECK(scenario_report[3].tag == math_solver);
+        CHECK(scenario_report[4].scenario == 3);
+        CHECK(scenario_report[4].tag == max_num_iter);
+
+        SUBCASE("Merge into other") {
+            ScenarioCalculationInfo other_info{};
+            other_info.log(begin_scenario, Idx{0});
+            other_info.log(math_solver, 1.0);
+            other_info.log(end_scenario);
+
+            info.merge_into(other_info);
+            CHECK(other_info.report().at(math_solver) == doctest::Approx(15.0));
+            auto const merged_report = other_info.scenario_report();
+            REQUIRE(merged_report.size() == 6);
+            CHECK(merged_report[0].scenario == 0);
+            CHECK(merged_report[1].scenario == 1);
+        }
+
+        SUBCASE("Multiple batch calculations") {
+            info.log(begin_batch);
+            info.log(begin_scenario, Idx{0});
+            info.log(math_solver, 11.0);
+            info.log(end_scenario);
+
+            auto const runs_report = info.scenario_report();
+            REQUIRE(runs_report.size() == 6);
+            // the scenarios of the later batch calculation are reported after those of the earlier one
+            CHECK(runs_report[4].scenario == 3);
+            CHECK(runs_report[5].scenario == 0);
+            CHECK(runs_report[5].value == doctest::Approx(11.0));
+
+            SUBCASE("Merge from a thread of the later batch calculation") {
+                ScenarioCalculationInfo thread_info{};
+                thread_info.log(begin_scenario, Idx{1});
+                thread_info.log(math_solver, 13.0);
+                thread_info.log(end_scenario);
+                thread_info.merge_into(info);
+
+                auto const merged_report = info.scenario_report();
+                REQUIRE(merged_report.size() == 7);
+                CHECK(merged_report[4].scenario == 3);
+                CHECK(merged_report[5].scenario == 0);
+                CHECK(merged_report[6].scenario == 1);
+                CHECK(merged_report[6].value == doctest::Approx(13.0));
+            }
+        }
+
+        SUBCASE("Merge into itself") {
+            info.merge_into(info);
+            CHECK(info.n_scenario_entries() == 5);
+        }
+
+        SUBCASE("Clear") {
+            info.clear();
+            CHECK(info.report().empty());
+            CHECK(info.scenario_report().empty());
+        }
+    }
+}
+
+TEST_CASE("Test MultiThreadedScenarioCalculationInfo") {
+    using enum LogEvent;
+    MultiThreadedScenarioCalculationInfo multi_threaded_info{};
+    std::atomic<Idx> next_scenario{0};
+
+    auto single_thread_job = [&multi_threaded_info, &next_scenario](Idx /*n_threads*/) {
+        auto thread_logger_ptr = multi_threaded_info.create_child();
+        Logger& thread_logger = *thread_logger_ptr;
+
+        Idx const scenario = next_scenario++;
+        thread_logger.log(begin_scenario, scenario);
+        thread_logger.log(math_solver, static_cast<double>(scenario));
+        thread_logger.log(end_scenario);
+    };
+
+    run_parallel_jobs(arbitrary_n_threads, single_thread_job);
+
+    CHECK(multi_threaded_info.report().at(math_solver) ==
+          doctest::Approx(static_cast<double>(arbitrary_n_threads * (arbitrary_n_threads - 1) / 2)));
+    CHECK(multi_threaded_info.n_scenario_entries() == arbitrary_n_threads);
+    auto const scenario_report = multi_threaded_info.scenario_report();
+    REQUIRE(std::ssize(scenario_report) == arbitrary_n_threads);
+    for (Idx scenario = 0; scenario != arbitrary_n_threads; ++scenario) {
+        CHECK(scenario_report[scenario].scenario == scenario);
+        CHECK(scenario_report[scenario].tag == math_solver);
+        CHECK(scenario_report[scenario].value == doctest::Approx(static_cast<double>(scenario)));
+    }
+
+    multi_threaded_info.clear();
+    CHECK(multi_threaded_info.report().empty());
+    CHECK(multi_threaded_info.n_scenario_entries() == 0);
+}
+
+TEST_CASE("Test LogEvent to string") {
+    CHECK(to_string(LogEvent::math_solver) == "math_solver");
+    CHECK(to_string(LogEvent::begin_scenario) == "begin_scenario");
+    CHECK(to_string(LogEvent::begin_batch) == "begin_batch");
+    CHECK(to_string(static_cast<LogEvent>(12345)) == "unknown");
+}
 } // namespace power_grid_model::common::logging
@@ -0,0 +1,144 @@
+// SPDX-FileCopyrightText: Contributors to the Power Grid Model project <powergridmodel@lfenergy.org>
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include <power_grid_model/common/trace_logger.hpp>
+
+#include <power_grid_model/common/common.hpp>
+#include <power_grid_model/common/logging.hpp>
+#include <power_grid_model/common/timer.hpp>
+
+#include <doctest/doctest.h>
+
+#include <algorithm>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace power_grid_model::common::logging {
+TEST_CASE("Test TraceLogger") {
+    using enum LogEvent;
+    using EventKind = TraceLogger::EventKind;
+
+    SUBCASE("Record events") {
+        TraceLogger tracer{};
+        CHECK(tracer.events().empty());
+
+        tracer.log(build_model, 0.5); // outside of any scenario
+        tracer.log(begin_scenario, Idx{3});
+        tracer.log(math_solver, 0.25);
+        tracer.log(max_num_iter, Idx{4});
+        tracer.log(math_solver, "should be ignored");
+        tracer.log(end_scenario);
+
+        auto const events = tracer.events();
+        REQUIRE(events.size() == 3);
+        CHECK(tracer.n_events() == 3);
+
+        CHECK(events[0].tag == build_model);
+        CHECK(events[0].kind == EventKind::complete);
+        CHECK(events[0].scenario == TraceLogger::no_scenario);
+        CHECK(Duration(events[0].end - events[0].begin).count() == doctest::Approx(0.5));
+        CHECK(events[0].thread == std::this_thread::get_id());
+
+        CHECK(events[1].tag == math_solver);
+        CHECK(events[1].scenario == 3);
+        CHECK(Duration(events[1].end - events[1].begin).count() == doctest::Approx(0.25));
+
+        CHECK(events[2].tag == max_num_iter);
+        CHECK(events[2].kind == EventKind::instant);
+        CHECK(events[2].scenario == 3);
+        CHECK(events[2].value == 4);
+
+        tracer.clear();
+        CHECK(tracer.events().empty());
+    }
+
+    SUBCASE("Ring buffer keeps the most recent events") {
+        TraceLogger tracer{3};
+        for (Idx idx = 0; idx != 5; ++idx) {
+            tracer.log(max_num_iter, idx);
+        }
+        auto const events = tracer.events();
+        REQUIRE(events.size() == 3);
+        CHECK(events[0].value == 2);
+        CHECK(events[1].value == 3);
+        CHECK(events[2].value == 4);
+        CHECK(tracer.n_dropped_events() == 2);
+
+        TraceLogger other{};
+        tracer.merge_into(other);
+        CHECK(other.n_events() == 3);
+        CHECK(other.events()[0].value == 2);
+        CHECK(other.n_dropped_events() == 2);
+    }
+
+    SUBCASE("Timer") {
+        TraceLogger tracer{};
+        {
+            Timer const timer{tracer, math_calculation};
+        }
+        REQUIRE(tracer.n_events() == 1);
+        auto const event = tracer.events().front();
+        CHECK(event.tag == math_calculation);
+        CHECK(event.begin <= event.end);
+    }
+
+    SUBCASE("Chrome trace") {
+        TraceLogger tracer{};
+        tracer.log(begin_scenario, Idx{1});
+        tracer.log(math_solver, 0.5);
+        tracer.log(max_num_iter, Idx{2});
+        tracer.log(end_scenario);
+
+        std::stringstream stream;
+        tracer.write_chrome_trace(stream);
+        std::string const trace = stream.str();
+        CHECK(trace.starts_with(R"({"displayTimeUnit":"ms","otherData":{"dropped_events":0},"traceEvents":[)"));
+        CHECK(trace.find(R"({"name":"math_solver","cat":"power_grid_model","pid":0,"tid":0,"ts":0.000,"ph":"X",)"
+                         R"("dur":500000.000,"args":{"scenario":1}})") != std::string::npos);
+        CHECK(trace.find(R"("ph":"i","s":"t","args":{"scenario":1,"value":2}})") != std::string::npos);
+        CHECK(trace.ends_with("\n]}\n"));
+    }
+}
+
+TEST_CASE("Test MultiThreadedTraceLogger") {
+    using enum LogEvent;
+    constexpr Idx n_threads = 4;
+
+    MultiThreadedTraceLogger tracer{};
+    {
+        std::vector<std::jthread> threads;
+        threads.reserve(n_threads);
+        for (Idx thread = 0; thread != n_threads; ++thread) {
+            threads.emplace_back([&tracer, thread] {
+                auto thread_logger_ptr = tracer.create_child();
+                Logger& thread_logger = *thread_logger_ptr;
+
+                thread_logger.log(begin_scenario, thread);
+                thread_logger.log(math_solver, 1e-3);
+                thread_logger.log(end_scenario);
+            }); // the events are merged when the thread logger is destroyed
+        }
+    }
+
+    auto const events = tracer.events();
+    REQUIRE(std::ssize(events) == n_threads);
+    for (Idx scenario = 0; scenario != n_threads; ++scenario) {
+        CHECK(std::ranges::count(events, scenario, &TraceLogger::TraceEvent::scenario) == 1);
+    }
+    std::vector<std::thread::id> threads;
+    std::ranges::transform(events, std::back_inserter(threads), &TraceLogger::TraceEvent::thread);
+    std::ranges::sort(threads);
+    CHECK(std::ranges::adjacent_find(threads) == threads.end());
+
+    std::stringstream stream;
+    tracer.write_chrome_trace(stream);
+    CHECK(stream.str().find(R"("tid":3)") != std::string::npos);
+
+    tracer.clear();
+    CHECK(tracer.n_events() == 0);
+}
+} // namespace power_grid_model::common::logging
@@ -0,0 +1,133 @@
+// SPDX-FileCopyrightText: Contributors to the Power Grid Model project <powergridmodel@lfenergy.org>
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include <power_grid_model/main_core/component_columns.hpp>
+#include <power_grid_model/main_core/container_queries.hpp>
+#include <power_grid_model/main_core/state.hpp>
+
+#include <power_grid_model/auxiliary/input.hpp>
+#include <power_grid_model/auxiliary/update.hpp>
+#include <power_grid_model/calculation_parameters.hpp>
+#include <power_grid_model/common/common.hpp>
+#include <power_grid_model/common/component_list.hpp>
+#include <power_grid_model/common/enum.hpp>
+#include <power_grid_model/component/base.hpp>
+#include <power_grid_model/component/branch.hpp>
+#include <power_grid_model/component/branch3.hpp>
+#include <power_grid_model/component/current_sensor.hpp>
+#include <power_grid_model/component/link.hpp>
+#include <power_grid_model/component/load_gen.hpp>
+#include <power_grid_model/component/power_sensor.hpp>
+#include <power_grid_model/component/voltage_sensor.hpp>
+#include <power_grid_model/container.hpp>
+
+#include <doctest/doctest.h>
+
+#include <array>
+
+namespace power_grid_model::main_core {
+namespace {
+using ComponentContainer =
+    Container<ExtraRetrievableTypes<Base, GenericLoadGen, Branch, Branch3, GenericVoltageSensor, GenericPowerSensor,
+                                    GenericCurrentSensor>,
+              SymLoad, SymGenerator, Link>;
+using State = MainModelState<ComponentContainer>;
+
+void check_branch_param(BranchCalcParam<symmetric_t> const& actual, BranchCalcParam<symmetric_t> const& expected) {
+    for (Idx i = 0; i != 4; ++i) {
+        CHECK(actual.value[i] == expected.value[i]);
+    }
+}
+} // namespace
+
+TEST_CASE("Test component columns") {
+    State state;
+    emplace_component<SymLoad>(state.components, 1,
+                               LoadGenInput<symmetric_t>{.id = 1,
+                                                         .node = 0,
+                                                         .status = 1,
+                                                         .type = LoadGenType::const_pq,
+                                                         .p_specified = 3e6,
+                                                         .q_specified = 1e6},
+                               10e3);
+    emplace_component<SymGenerator>(state.components, 2,
+                                    LoadGenInput<symmetric_t>{.id = 2,
+                                                              .node = 0,
+                                                              .status = 1,
+                                                              .type = LoadGenType::const_pq,
+                                                              .p_specified = 2e6,
+                                                              .q_specified = 0.0},
+                                    10e3);
+    emplace_component<Link>(state.components, 3,
+                            LinkInput{.id = 3, .from_node = 0, .to_node = 4, .from_status = 1, .to_status = 1}, 10e3,
+                            10e3);
+    state.components.set_construction_complete();
+
+    auto const& load = state.components.template get_item<GenericLoadGen>(1);
+    auto const& generator = state.components.template get_item<GenericLoadGen>(2);
+    auto const& link = state.components.template get_item<Branch>(3);
+
+    prepare_component_columns<symmetric_t>(state.components, state.columns);
+    REQUIRE(state.columns.sym.has_value());
+    CHECK_FALSE(state.columns.asym.has_value());
+
+    auto const& columns = get_columns<symmetric_t>(state.columns);
+
+    SUBCASE("Columns are filled in sequence order") {
+        REQUIRE(columns.load_gen_status.size() == 2);
+        CHECK(columns.load_gen_status[0] == 1);
+        CHECK(columns.load_gen_status[1] == 1);
+        REQUIRE(columns.load_gen_s_injection.size() == 2);
+        CHECK(columns.load_gen_s_injection[0] == load.calc_param<symmetric_t>());
+        CHECK(columns.load_gen_s_injection[1] == generator.calc_param<symmetric_t>());
+        REQUIRE(columns.branch_param.size() == 1);
+        check_branch_param(columns.branch_param[0], link.calc_param<symmetric_t>());
+        CHECK(columns.branch3_param.empty());
+        CHECK(columns.voltage_sensor_param.empty());
+        CHECK(columns.power_sensor_param.empty());
+        CHECK(columns.current_sensor_param.empty());
+    }
+
+    SUBCASE("Filled columns are kept") {
+        auto const* const s_injection = columns.load_gen_s_injection.data();
+        prepare_component_columns<symmetric_t>(state.components, state.columns);
+        CHECK(get_columns<symmetric_t>(state.columns).load_gen_s_injection.data() == s_injection);
+    }
+
+    SUBCASE("Only the updated components are recalculated") {
+        Idx2D const load_idx = state.components.get_idx_by_id(1);
+        Idx2D const link_idx = state.components.get_idx_by_id(3);
+        auto& mutable_load = state.components.template get_item<SymLoad>(load_idx);
+        auto& mutable_link = state.components.template get_item<Link>(link_idx);
+        mutable_load.update(LoadGenUpdate<symmetric_t>{.id = 1, .status = 0});
+        mutable_link.update(BranchUpdate{.id = 3, .from_status = 0, .to_status = 0});
+
+        // the columns are not updated before the update is recorded
+        CHECK(columns.load_gen_status[0] == 1);
+
+        std::array const updated_loads{load_idx};
+        update_component_columns<SymLoad>(state.components, updated_loads, state.columns);
+        CHECK(columns.load_gen_status[0] == 0);
+        CHECK(columns.load_gen_s_injection[0] == ComplexValue<symmetric_t>{});
+        CHECK(columns.load_gen_status[1] == 1);
+        CHECK(columns.load_gen_s_injection[1] == generator.calc_param<symmetric_t>());
+
+        std::array const updated_links{link_idx};
+        update_component_columns<Link>(state.components, updated_links, state.columns);
+        check_branch_param(columns.branch_param[0], BranchCalcParam<symmetric_t>{});
+
+        // the columns of the other symmetry are filled on demand
+        prepare_component_columns<asymmetric_t>(state.components, state.columns);
+        REQUIRE(state.columns.asym.has_value());
+        CHECK(get_columns<asymmetric_t>(state.columns).load_gen_status[0] == 0);
+    }
+
+    SUBCASE("Clear") {
+        clear(state.columns);
+        CHECK_FALSE(state.columns.sym.has_value());
+        CHECK_FALSE(state.columns.asym.has_value());
+    }
+}
+
+} // namespace power_grid_model::main_core
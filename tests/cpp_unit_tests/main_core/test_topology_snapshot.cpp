@@ -0,0 +1,148 @@
+// SPDX-FileCopyrightText: Contributors to the Power Grid Model project <powergridmodel@lfenergy.org>
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include <power_grid_model/main_core/topology_snapshot.hpp>
+
+#include <power_grid_model/calculation_parameters.hpp>
+#include <power_grid_model/common/common.hpp>
+#include <power_grid_model/common/enum.hpp>
+#include <power_grid_model/common/exception.hpp>
+#include <power_grid_model/common/grouped_index_vector.hpp>
+#include <power_grid_model/topology.hpp>
+
+#include <doctest/doctest.h>
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace power_grid_model::main_core {
+namespace {
+template <grouped_idx_vector_type GroupedIdxVector>
+void check_equal(GroupedIdxVector const& actual, GroupedIdxVector const& expected) {
+    REQUIRE(actual.size() == expected.size());
+    CHECK(actual.element_size() == expected.element_size());
+    for (Idx const group : IdxRange{expected.size()}) {
+        CHECK(std::ranges::equal(actual.get_element_range(group), expected.get_element_range(group)));
+    }
+}
+
+void check_equal(MathModelTopology const& actual, MathModelTopology const& expected) {
+    CHECK(actual.slack_bus == expected.slack_bus);
+    CHECK(actual.is_radial == expected.is_radial);
+    CHECK(actual.phase_shift == expected.phase_shift);
+    CHECK(actual.branch_bus_idx == expected.branch_bus_idx);
+    CHECK(actual.fill_in == expected.fill_in);
+    check_equal(actual.sources_per_bus, expected.sources_per_bus);
+    check_equal(actual.shunts_per_bus, expected.shunts_per_bus);
+    check_equal(actual.load_gens_per_bus, expected.load_gens_per_bus);
+    CHECK(actual.load_gen_type == expected.load_gen_type);
+    check_equal(actual.voltage_sensors_per_bus, expected.voltage_sensors_per_bus);
+    check_equal(actual.power_sensors_per_branch_from, expected.power_sensors_per_branch_from);
+}
+} // namespace
+
+TEST_CASE("Test topology snapshot") {
+    // two subgrids: a meshed one with a source at node 0, and a radial one with a source at node 4
+    //  [0:s0,lg0] --0--> [1+v0] --1--> [2:lg1]      [4:s1] --4--> [5:h0]
+    //      \                           /
+    //       ------------2---> [3] --3--
+    ComponentTopology comp_topo{};
+    comp_topo.n_node = 6;
+    comp_topo.branch_node_idx = {{0, 1}, {1, 2}, {0, 3}, {3, 2}, {4, 5}};
+    comp_topo.source_node_idx = {0, 4};
+    comp_topo.shunt_node_idx = {5};
+    comp_topo.load_gen_node_idx = {0, 2};
+    comp_topo.load_gen_type = {LoadGenType::const_pq, LoadGenType::const_i};
+    comp_topo.voltage_sensor_node_idx = {1};
+    comp_topo.power_sensor_object_idx = {0};
+    comp_topo.power_sensor_terminal_type = {MeasuredTerminalType::branch_from};
+
+    ComponentConnections comp_conn{};
+    comp_conn.branch_connected = std::vector<BranchConnected>(5, {1, 1});
+    comp_conn.branch_phase_shift = std::vector<double>(5, 0.0);
+    comp_conn.source_connected = {1, 1};
+
+    auto const [math_topology, topo_comp_coup] =
+        topology::Topology{ReducedComponentTopology::from_component_topology(comp_topo), comp_conn}.build_topology();
+    REQUIRE(math_topology.size() == 2);
+
+    constexpr auto sparse_ordering_method = SparseOrderingMethod::minimum_degree;
+    std::ostringstream stream;
+    TopologySnapshotStream stream_sink{stream};
+    write_topology_snapshot(stream_sink, comp_topo, comp_conn, math_topology, *topo_comp_coup, sparse_ordering_method);
+    std::string const snapshot = stream.str();
+
+    SUBCASE("Round trip") {
+        auto const restored = read_topology_snapshot(snapshot, comp_topo, comp_conn, sparse_ordering_method);
+
+        REQUIRE(restored.math_topology.size() == math_topology.size());
+        for (Idx const idx : IdxRange{std::ssize(math_topology)}) {
+            check_equal(*restored.math_topology[idx], *math_topology[idx]);
+        }
+        REQUIRE(restored.topo_comp_coup != nullptr);
+        CHECK(restored.topo_comp_coup->node == topo_comp_coup->node);
+        CHECK(restored.topo_comp_coup->branch == topo_comp_coup->branch);
+        CHECK(restored.topo_comp_coup->source == topo_comp_coup->source);
+        CHECK(restored.topo_comp_coup->shunt == topo_comp_coup->shunt);
+        CHECK(restored.topo_comp_coup->load_gen == topo_comp_coup->load_gen);
+        CHECK(restored.topo_comp_coup->voltage_sensor == topo_comp_coup->voltage_sensor);
+        CHECK(restored.topo_comp_coup->power_sensor == topo_comp_coup->power_sensor);
+    }
+
+    SUBCASE("Different grid") {
+        ComponentTopology other_topo = comp_topo;
+        other_topo.branch_node_idx[3] = {3, 1};
+        CHECK_THROWS_AS(read_topology_snapshot(snapshot, other_topo, comp_conn, sparse_ordering_method),
+                        SerializationError);
+    }
+
+    SUBCASE("Different switching state") {
+        ComponentConnections other_conn = comp_conn;
+        other_conn.branch_connected[2] = {1, 0};
+        CHECK_THROWS_AS(read_topology_snapshot(snapshot, comp_topo, other_conn, sparse_ordering_method),
+                        SerializationError);
+    }
+
+    SUBCASE("Different sparse ordering method") {
+        CHECK_THROWS_AS(read_topology_snapshot(snapshot, comp_topo, comp_conn,
+                                               SparseOrderingMethod::approximate_minimum_degree),
+                        SerializationError);
+    }
+
+    SUBCASE("Buffer") {
+        TopologySnapshotSize size_sink;
+        write_topology_snapshot(size_sink, comp_topo, comp_conn, math_topology, *topo_comp_coup,
+                                sparse_ordering_method);
+        CHECK(size_sink.size() == std::ssize(snapshot));
+
+        std::string buffer(snapshot.size(), '\0');
+        TopologySnapshotBuffer buffer_sink{buffer};
+        write_topology_snapshot(buffer_sink, comp_topo, comp_conn, math_topology, *topo_comp_coup,
+                                sparse_ordering_method);
+        CHECK(buffer == snapshot);
+
+        std::string too_small(snapshot.size() - 1, '\0');
+        TopologySnapshotBuffer too_small_sink{too_small};
+        CHECK_THROWS_AS(write_topology_snapshot(too_small_sink, comp_topo, comp_conn, math_topology, *topo_comp_coup,
+                                                sparse_ordering_method),
+                        SerializationError);
+    }
+
+    SUBCASE("Corrupted snapshot") {
+        auto const read = [&comp_topo, &comp_conn](std::string const& data) {
+            return read_topology_snapshot(data, comp_topo, comp_conn, sparse_ordering_method);
+        };
+        CHECK_THROWS_AS(read(std::string{}), SerializationError);
+        CHECK_THROWS_AS(read(snapshot.substr(0, snapshot.size() - 1)), SerializationError);
+        CHECK_THROWS_AS(read(snapshot + '\0'), SerializationError);
+
+        std::string wrong_magic = snapshot;
+        wrong_magic[0] = 'X';
+        CHECK_THROWS_AS(read(wrong_magic), SerializationError);
+    }
+}
+
+} // namespace power_grid_model::main_core
@@ -7,7 +7,9 @@
 #pragma once
 
 #include "power_grid_model/calculation_parameters.hpp"
+#include "power_grid_model/common/calculation_info.hpp"
 #include "power_grid_model/common/common.hpp"
+#include "power_grid_model/common/enum.hpp"
 #include "power_grid_model/common/exception.hpp"
 #include "power_grid_model/common/logging.hpp"
 #include "power_grid_model/common/three_phase_tensor.hpp"
@@ -116,6 +118,25 @@ TEST_CASE_TEMPLATE_DEFINE("Test math solver - PF", SolverType, test_math_solver_
         assert_output(output, grid.output_ref_z()); // for const z, all methods (including linear) should be accurate
     }
 
+    SUBCASE("Test pf solver without branch and shunt flows") {
+        SolverType solver{y_bus, topo};
+        NoLogger log;
+
+        PowerFlowInput<sym> const pf_input_z = grid.pf_input_z();
+        SolverOutputRequest const output_request{.branch_flow = false, .shunt_flow = false};
+        SolverOutput<sym> const output = [&] {
+            if constexpr (SolverType::is_iterative) {
+                return solver.run_power_flow(y_bus, pf_input_z, 1e-12, 20, false, log,
+                                             PowerFlowInitialization::cold_start, output_request);
+            } else {
+                return solver.run_power_flow(y_bus, pf_input_z, log, output_request);
+            }
+        }();
+        CHECK(output.branch.empty());
+        CHECK(output.shunt.empty());
+        assert_output(output, grid.output_ref_z()); // the other results are not affected
+    }
+
     if constexpr (SolverType::is_iterative) {
         SUBCASE("Test pf solver with single iteration") {
             // low precision
@@ -137,6 +158,51 @@ TEST_CASE_TEMPLATE_DEFINE("Test math solver - PF", SolverType, test_math_solver_
             pf_input.s_injection[6] = ComplexValue<sym>{1e6};
             CHECK_THROWS_AS(run_power_flow(solver, y_bus, pf_input, 1e-12, 20, log), IterationDiverge);
         }
+        SUBCASE("Test warm start") {
+            using enum PowerFlowInitialization;
+            constexpr auto error_tolerance{1e-12};
+            constexpr auto num_iter{20};
+            constexpr auto cache_run = false;
+
+            SolverType solver{y_bus, topo};
+            PowerFlowInput<sym> const pf_input = grid.pf_input();
+
+            auto run = [&](PowerFlowInput<sym> const& input, PowerFlowInitialization initialization,
+                           CalculationInfo& info) {
+                return solver.run_power_flow(y_bus, input, error_tolerance, num_iter, cache_run, info, initialization);
+            };
+            auto get_num_iter = [](CalculationInfo const& info) {
+                return info.report().at(LogEvent::iterative_pf_solver_max_num_iter);
+            };
+
+            // first run has no previous solution and starts cold
+            CHECK_FALSE(solver.has_warm_start());
+            CalculationInfo cold_info;
+            assert_output(run(pf_input, warm_start, cold_info), grid.output_ref());
+            CHECK(solver.has_warm_start());
+
+            // second run starts from the converged solution of the first run
+            CalculationInfo warm_info;
+            assert_output(run(pf_input, warm_start, warm_info), grid.output_ref());
+            CHECK(get_num_iter(warm_info) < get_num_iter(cold_info));
+
+            SUBCASE("Cold start ignores previous solution") {
+                CalculationInfo info;
+                assert_output(run(pf_input, cold_start, info), grid.output_ref());
+                CHECK(get_num_iter(info) == get_num_iter(cold_info));
+            }
+            SUBCASE("Fall back to cold start when warm start does not converge") {
+                PowerFlowInput<sym> diverging_input = pf_input;
+                diverging_input.s_injection[6] = ComplexValue<sym>{1e6};
+                CalculationInfo info;
+                CHECK_THROWS_AS(run(diverging_input, warm_start, info), IterationDiverge);
+                CHECK_FALSE(solver.has_warm_start());
+
+                CalculationInfo recovered_info;
+                assert_output(run(pf_input, warm_start, recovered_info), grid.output_ref());
+                CHECK(get_num_iter(recovered_info) == get_num_iter(cold_info));
+            }
+        }
     }
 
     SUBCASE("Test singular ybus") {
@@ -0,0 +1,121 @@
+// SPDX-FileCopyrightText: Contributors to the Power Grid Model project <powergridmodel@lfenergy.org>
+//
+// SPDX-License-Identifier: MPL-2.0
+
+// In this unit test the heap allocations of repeated power flow runs are counted, to make sure that the iterative
+// solvers reuse their state in place instead of re-allocating it for every run or every iteration.
+
+#include "test_math_solver_pf.hpp" // NOLINT(misc-include-cleaner)
+
+#include <power_grid_model/math_solver/iterative_current_pf_solver.hpp>
+#include <power_grid_model/math_solver/newton_raphson_pf_solver.hpp>
+
+#include <power_grid_model/common/common.hpp>
+
+#include <doctest/doctest.h>
+
+#include <cstddef>
+#include <cstdlib>
+#include <limits>
+#include <new>
+#include <utility>
+
+namespace {
+// only count allocations of the current thread, and only when explicitly enabled
+thread_local bool count_allocations_enabled = false;
+thread_local power_grid_model::Idx allocation_count = 0;
+
+void* counted_malloc(std::size_t size) {
+    if (count_allocations_enabled) {
+        ++allocation_count;
+    }
+    if (void* const ptr = std::malloc(size == 0 ? 1 : size); ptr != nullptr) { // NOLINT(cppcoreguidelines-no-malloc)
+        return ptr;
+    }
+    throw std::bad_alloc{};
+}
+
+template <typename Func> power_grid_model::Idx count_allocations(Func&& func) {
+    allocation_count = 0;
+    count_allocations_enabled = true;
+    std::forward<Func>(func)();
+    count_allocations_enabled = false;
+    return allocation_count;
+}
+} // namespace
+
+// replace the global (non-aligned) allocation functions for this test executable,
+// which is therefore kept separate from the other math solver tests
+void* operator new(std::size_t size) { return counted_malloc(size); }
+void* operator new[](std::size_t size) { return counted_malloc(size); }
+// NOLINTBEGIN(cppcoreguidelines-no-malloc)
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t /*size*/) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::size_t /*size*/) noexcept { std::free(ptr); }
+// NOLINTEND(cppcoreguidelines-no-malloc)
+
+TYPE_TO_STRING_AS("NewtonRaphsonPFSolver<symmetric_t>",
+                  power_grid_model::math_solver::NewtonRaphsonPFSolver<power_grid_model::symmetric_t>);
+TYPE_TO_STRING_AS("NewtonRaphsonPFSolver<asymmetric_t>",
+                  power_grid_model::math_solver::NewtonRaphsonPFSolver<power_grid_model::asymmetric_t>);
+TYPE_TO_STRING_AS("IterativeCurrentPFSolver<symmetric_t>",
+                  power_grid_model::math_solver::IterativeCurrentPFSolver<power_grid_model::symmetric_t>);
+TYPE_TO_STRING_AS("IterativeCurrentPFSolver<asymmetric_t>",
+                  power_grid_model::math_solver::IterativeCurrentPFSolver<power_grid_model::asymmetric_t>);
+
+namespace power_grid_model::math_solver {
+TEST_CASE_TEMPLATE("Test math solver - PF allocations", SolverType, NewtonRaphsonPFSolver<symmetric_t>,
+                   NewtonRaphsonPFSolver<asymmetric_t>, IterativeCurrentPFSolver<symmetric_t>,
+                   IterativeCurrentPFSolver<asymmetric_t>) {
+    using sym = typename SolverType::sym;
+    using common::logging::NoLogger;
+
+    PFSolverTestGrid<sym> const grid;
+    auto const topo = grid.topo();
+    YBus<sym> const y_bus{topo, grid.param()};
+    PowerFlowInput<sym> const pf_input = grid.pf_input();
+    NoLogger log;
+
+    SolverType solver{y_bus, topo};
+
+    // first run is allowed to fill caches, e.g., the prefactorization of the iterative current method
+    SolverOutput<sym> const first_output = run_power_flow(solver, y_bus, pf_input, 1e-12, 20, log);
+
+    SolverOutput<sym> output;
+    Idx const n_alloc_converged =
+        count_allocations([&] { output = run_power_flow(solver, y_bus, pf_input, 1e-12, 20, log); });
+    assert_output(output, grid.output_ref());
+
+    SUBCASE("No allocations per iteration") {
+        Idx const n_alloc_single_iteration = count_allocations([&] {
+            output = run_power_flow(solver, y_bus, pf_input, std::numeric_limits<double>::infinity(), 1, log);
+        });
+        CHECK(n_alloc_single_iteration == n_alloc_converged);
+    }
+
+    SUBCASE("No copy of the solver state per run") {
+        Idx const n_alloc_solver_copy = count_allocations([&] {
+            SolverType const solver_copy{solver};
+            (void)solver_copy;
+        });
+        Idx const n_alloc_output_copy = count_allocations([&] {
+            SolverOutput<sym> const output_copy{first_output};
+            (void)output_copy;
+        });
+        // a run only needs to allocate its own output, which is at least as expensive as copying it
+        CHECK(n_alloc_output_copy > 0);
+        CHECK(n_alloc_solver_copy > 0);
+        CHECK(n_alloc_converged < n_alloc_solver_copy + n_alloc_output_copy);
+    }
+
+    SUBCASE("Result of a reused solver is not affected by previous runs") {
+        PowerFlowInput<sym> diverging_input = pf_input;
+        diverging_input.s_injection[6] = ComplexValue<sym>{1e6};
+        CHECK_THROWS_AS(run_power_flow(solver, y_bus, diverging_input, 1e-12, 20, log), IterationDiverge);
+
+        output = run_power_flow(solver, y_bus, pf_input, 1e-12, 20, log);
+        assert_output(output, grid.output_ref());
+    }
+}
+} // namespace power_grid_model::math_solver
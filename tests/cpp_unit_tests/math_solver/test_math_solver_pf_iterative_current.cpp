@@ -18,4 +18,37 @@ TYPE_TO_STRING_AS("IterativeCurrentPFSolver<asymmetric_t>",
 namespace power_grid_model::math_solver {
 TEST_CASE_TEMPLATE_INVOKE(test_math_solver_pf_id, IterativeCurrentPFSolver<symmetric_t>);
 TEST_CASE_TEMPLATE_INVOKE(test_math_solver_pf_id, IterativeCurrentPFSolver<asymmetric_t>);
+
+TEST_CASE_TEMPLATE("Test iterative current PF solver - parameter change", sym, symmetric_t, asymmetric_t) {
+    using common::logging::NoLogger;
+
+    PFSolverTestGrid<sym> const grid;
+    auto const topo = grid.topo();
+    PowerFlowInput<sym> const pf_input = grid.pf_input();
+    NoLogger log;
+
+    YBus<sym> y_bus{topo, grid.param()};
+    IterativeCurrentPFSolver<sym> solver{y_bus, topo};
+    run_power_flow(solver, y_bus, pf_input, 1e-12, 20, log);
+
+    // change one branch, the prefactorization is updated instead of recalculated
+    BranchCalcParam<sym> branch_param = grid.param().branch_param[0];
+    for (auto& value : branch_param.value) {
+        value *= 0.5;
+    }
+    y_bus.update_admittance_increment({.branch_param = {branch_param},
+                                       .shunt_param = {},
+                                       .source_param = {},
+                                       .branch_param_to_change = {0},
+                                       .shunt_param_to_change = {},
+                                       .source_param_to_change = {}});
+    SolverOutput<sym> const output = run_power_flow(solver, y_bus, pf_input, 1e-12, 20, log);
+
+    auto param_ref = grid.param();
+    param_ref.branch_param[0] = branch_param;
+    YBus<sym> const y_bus_ref{topo, param_ref};
+    IterativeCurrentPFSolver<sym> solver_ref{y_bus_ref, topo};
+    SolverOutput<sym> const output_ref = run_power_flow(solver_ref, y_bus_ref, pf_input, 1e-12, 20, log);
+    assert_output(output, output_ref, false, 1e-12);
+}
 } // namespace power_grid_model::math_solver
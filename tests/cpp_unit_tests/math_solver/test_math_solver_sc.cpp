@@ -16,6 +16,7 @@
 
 #include <doctest/doctest.h>
 
+#include <array>
 #include <complex>
 #include <cstddef>
 #include <limits>
@@ -309,6 +310,61 @@ TEST_CASE("Short circuit solver") {
         assert_sc_output<symmetric_t>(sym_output, sym_sc_output_ref);
     }
 
+    SUBCASE("Test short circuit solver sweep") {
+        // one fault on each bus, each fault is a separate calculation
+        DenseGroupedIdxVector const sweep_fault_buses{from_sparse, {0, 1, 2}};
+        DenseGroupedIdxVector const single_fault_buses_0{from_sparse, {0, 1, 1}};
+        DenseGroupedIdxVector const single_fault_buses_1{from_sparse, {0, 0, 1}};
+
+        auto const check_sweep = [&]<symmetry_tag sym>(MathModelParam<sym> const& param, FaultType fault_type,
+                                                       FaultPhase fault_phase, DoubleComplex const& y_f) {
+            YBus<sym> const y_bus{topo_sc, param};
+            ShortCircuitSolver<sym> solver{y_bus, topo_sc};
+            ShortCircuitInput sweep_input = create_sc_test_input(fault_type, fault_phase, y_f, vref, sweep_fault_buses);
+            sweep_input.faults.push_back(sweep_input.faults.front());
+
+            // without any fault, the voltages are the source voltages
+            auto const pre_fault_output = solver.prepare_short_circuit_sweep(y_bus, sweep_input);
+            CHECK(pre_fault_output.fault.empty());
+            assert_sc_output<sym>(pre_fault_output, blank_sc_output<sym>(vref));
+
+            // the output is only valid during the call, so it is copied
+            std::vector<ShortCircuitSolverOutput<sym>> sweep_output(2);
+            IdxVector visited_faults;
+            solver.run_short_circuit_sweep(
+                y_bus, sweep_input, [&](Idx fault_number, ShortCircuitSolverOutput<sym> const& output) {
+                    visited_faults.push_back(fault_number);
+                    sweep_output[fault_number] = output;
+                });
+            CHECK(visited_faults == IdxVector{0, 1});
+
+            for (auto const& [fault_number, single_fault_buses] :
+                 std::array{std::pair{Idx{0}, single_fault_buses_0}, std::pair{Idx{1}, single_fault_buses_1}}) {
+                ShortCircuitSolver<sym> solver_ref{y_bus, topo_sc};
+                auto const output_ref = solver_ref.run_short_circuit(
+                    y_bus, create_sc_test_input(fault_type, fault_phase, y_f, vref, single_fault_buses));
+                auto const& output = sweep_output[fault_number];
+                REQUIRE(output.fault.size() == 1); // only the result of the fault itself
+                assert_sc_output<sym>(output, output_ref);
+            }
+        };
+
+        for (DoubleComplex const& y_f : {y_fault, y_fault_solid}) {
+            check_sweep(param_sc_sym, three_phase, FaultPhase::abc, y_f);
+            check_sweep(param_sc_asym, three_phase, FaultPhase::abc, y_f);
+            check_sweep(param_sc_asym, single_phase_to_ground, FaultPhase::a, y_f);
+            check_sweep(param_sc_asym, two_phase, FaultPhase::bc, y_f);
+            check_sweep(param_sc_asym, two_phase_to_ground, FaultPhase::bc, y_f);
+        }
+
+        YBus<asymmetric_t> const y_bus_asym{topo_sc, param_sc_asym};
+        ShortCircuitSolver<asymmetric_t> solver{y_bus_asym, topo_sc};
+        auto sc_input_default =
+            create_sc_test_input(three_phase, FaultPhase::default_value, y_fault, vref, fault_buses);
+        CHECK_THROWS_AS(solver.prepare_short_circuit_sweep(y_bus_asym, sc_input_default),
+                        InvalidShortCircuitPhaseOrType);
+    }
+
     SUBCASE("Test fault on source bus") {
         // Grid for short circuit
         MathModelTopology topo_comp;
@@ -6,7 +6,9 @@
 
 #include <power_grid_model/math_solver/iterative_linear_se_solver.hpp> // NOLINT(misc-include-cleaner)
 
+#include <power_grid_model/common/calculation_info.hpp>
 #include <power_grid_model/common/common.hpp>
+#include <power_grid_model/common/logging.hpp>
 
 #include <doctest/doctest.h>
 
@@ -20,4 +22,47 @@ TEST_CASE_TEMPLATE_INVOKE(test_math_solver_se_id, IterativeLinearSESolver<symmet
 TEST_CASE_TEMPLATE_INVOKE(test_math_solver_se_id, IterativeLinearSESolver<asymmetric_t>);
 TEST_CASE_TEMPLATE_INVOKE(test_math_solver_se_zero_variance_id, IterativeLinearSESolver<symmetric_t>);
 TEST_CASE_TEMPLATE_INVOKE(test_math_solver_se_measurements_id, IterativeLinearSESolver<symmetric_t>);
+
+TEST_CASE_TEMPLATE("Test iterative linear SE solver - reuse prefactorization", sym, symmetric_t, asymmetric_t) {
+    using enum LogEvent;
+    constexpr auto error_tolerance{1e-10};
+    constexpr auto num_iter{20};
+
+    SESolverTestGrid<sym> const grid;
+    auto const topo = grid.se_topo_power_sensors();
+    YBus<sym> const y_bus{topo, grid.param()};
+    IterativeLinearSESolver<sym> solver{y_bus, topo};
+    CalculationInfo info;
+
+    auto se_input = grid.se_input_angle();
+    SolverOutput<sym> const first_output =
+        run_state_estimation(solver, y_bus, se_input, error_tolerance, num_iter, info);
+    assert_output(first_output, grid.output_ref());
+    CHECK(info.report().at(prefactorization_cache_miss) == 1.0);
+    CHECK_FALSE(info.report().contains(prefactorization_cache_hit));
+
+    auto const check_against_new_solver = [&](SolverOutput<sym> const& output) {
+        IterativeLinearSESolver<sym> solver_ref{y_bus, topo};
+        auto log = get_logger();
+        SolverOutput<sym> const output_ref =
+            run_state_estimation(solver_ref, y_bus, se_input, error_tolerance, num_iter, log);
+        assert_output(output, output_ref);
+    };
+
+    SUBCASE("Only measured values change") {
+        se_input.measured_voltage[0].value *= 1.01;
+        SolverOutput<sym> const output = run_state_estimation(solver, y_bus, se_input, error_tolerance, num_iter, info);
+        CHECK(info.report().at(prefactorization_cache_miss) == 1.0);
+        CHECK(info.report().at(prefactorization_cache_hit) == 1.0);
+        check_against_new_solver(output);
+    }
+
+    SUBCASE("Variance changes") {
+        se_input.measured_voltage[0].variance *= 2.0;
+        SolverOutput<sym> const output = run_state_estimation(solver, y_bus, se_input, error_tolerance, num_iter, info);
+        CHECK(info.report().at(prefactorization_cache_miss) == 2.0);
+        CHECK_FALSE(info.report().contains(prefactorization_cache_hit));
+        check_against_new_solver(output);
+    }
+}
 } // namespace power_grid_model::math_solver
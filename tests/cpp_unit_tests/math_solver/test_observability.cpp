@@ -3,11 +3,13 @@
 // SPDX-License-Identifier: MPL-2.0
 
 #include <power_grid_model/calculation_parameters.hpp>
+#include <power_grid_model/common/calculation_info.hpp>
 #include <power_grid_model/common/common.hpp>
 #include <power_grid_model/common/enum.hpp>
 #include <power_grid_model/common/exception.hpp>
 #include <power_grid_model/common/grouped_index_vector.hpp>
 #include <power_grid_model/common/statistics.hpp>
+#include <power_grid_model/math_solver/math_solver.hpp>
 #include <power_grid_model/math_solver/measured_values.hpp>
 #include <power_grid_model/math_solver/observability.hpp>
 #include <power_grid_model/math_solver/y_bus.hpp>
@@ -19,7 +21,10 @@
 #include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <limits>
+#include <memory>
 #include <ranges>
+#include <span>
 #include <utility>
 #include <vector>
 
@@ -2215,4 +2220,95 @@ TEST_CASE("Test ObservabilityResult - use_perturbation with non-observable netwo
     }
 }
 
+TEST_CASE("Test Observability - cache") {
+    using enum LogEvent;
+    using math_solver::observability::ObservabilityCache;
+
+    MathModelTopology topo;
+    topo.slack_bus = 0;
+    topo.phase_shift = {0.0, 0.0};
+    topo.branch_bus_idx = {{0, 1}};
+    topo.sources_per_bus = {from_dense, {0}, 2};
+    topo.shunts_per_bus = {from_dense, {}, 2};
+    topo.load_gens_per_bus = {from_dense, {1}, 2};
+    topo.power_sensors_per_bus = {from_dense, {}, 2};
+    topo.power_sensors_per_source = {from_dense, {}, 2};
+    topo.power_sensors_per_load_gen = {from_dense, {}, 2};
+    topo.power_sensors_per_shunt = {from_dense, {}, 2};
+    topo.power_sensors_per_branch_from = {from_dense, {0}, 1};
+    topo.power_sensors_per_branch_to = {from_dense, {}, 1};
+    topo.current_sensors_per_branch_from = {from_dense, {}, 1};
+    topo.current_sensors_per_branch_to = {from_dense, {}, 1};
+    topo.voltage_sensors_per_bus = {from_dense, {0}, 2};
+
+    MathModelParam<symmetric_t> param;
+    param.source_param = {SourceCalcParam{.y1 = 1.0, .y0 = 1.0}};
+    param.branch_param = {{1.0, 2.0, 2.0, 1.0}};
+    YBus<symmetric_t> const y_bus{topo, std::move(param)};
+
+    StateEstimationInput<symmetric_t> observable_input;
+    observable_input.source_status = {1};
+    observable_input.load_gen_status = {1};
+    observable_input.measured_voltage = {{.value = 1.0, .variance = 1.0}};
+    observable_input.measured_branch_from_power = {
+        {.real_component = {.value = 1.0, .variance = 1.0}, .imag_component = {.value = 0.0, .variance = 1.0}}};
+
+    // the branch power sensor with infinite variance counts as not measured
+    StateEstimationInput<symmetric_t> not_observable_input = observable_input;
+    not_observable_input.measured_branch_from_power.front().real_component.variance =
+        std::numeric_limits<double>::infinity();
+    not_observable_input.measured_branch_from_power.front().imag_component.variance =
+        std::numeric_limits<double>::infinity();
+
+    SUBCASE("Cache") {
+        ObservabilityCache cache;
+        CalculationInfo info;
+        auto const check = [&](StateEstimationInput<symmetric_t> const& se_input) {
+            math_solver::MeasuredValues<symmetric_t> const measured_values{y_bus.math_topology(), se_input};
+            return cache.check(measured_values, y_bus.math_topology(), y_bus.shared_y_bus_structure(), info);
+        };
+
+        CHECK(check(observable_input).is_observable);
+        CHECK(info.report().at(observability_cache_miss) == 1.0);
+        CHECK_FALSE(info.report().contains(observability_cache_hit));
+
+        // only the measured value changes
+        observable_input.measured_branch_from_power.front().real_component.value = 2.0;
+        CHECK(check(observable_input).is_observable);
+        CHECK(info.report().at(observability_cache_miss) == 1.0);
+        CHECK(info.report().at(observability_cache_hit) == 1.0);
+
+        // the error is cached as well
+        CHECK_THROWS_AS(check(not_observable_input), NotObservableError);
+        CHECK_THROWS_AS(check(not_observable_input), NotObservableError);
+        CHECK(info.report().at(observability_cache_miss) == 2.0);
+        CHECK(info.report().at(observability_cache_hit) == 2.0);
+
+        // another y bus structure invalidates the cache
+        YBus<symmetric_t> const other_y_bus{topo, y_bus.math_model_param()};
+        math_solver::MeasuredValues<symmetric_t> const measured_values{other_y_bus.math_topology(), observable_input};
+        CHECK(cache.check(measured_values, other_y_bus.math_topology(), other_y_bus.shared_y_bus_structure(), info)
+                  .is_observable);
+        CHECK(info.report().at(observability_cache_miss) == 3.0);
+    }
+
+    SUBCASE("Observability check without solving") {
+        MathSolver<symmetric_t> solver{std::make_shared<MathModelTopology const>(topo)};
+        CalculationInfo info;
+
+        CHECK_NOTHROW(solver.check_observability(observable_input, info, y_bus));
+        CHECK_THROWS_AS(solver.check_observability(not_observable_input, info, y_bus), NotObservableError);
+        CHECK_NOTHROW(solver.check_observability(observable_input, info, y_bus));
+        CHECK(info.report().at(observability_cache_miss) == 2.0);
+        CHECK(info.report().at(observability_cache_hit) == 1.0);
+
+        // the copy of the solver in another thread of a batch keeps the cache
+        MathSolver<symmetric_t> copied_solver{solver};
+        CHECK_THROWS_AS(copied_solver.check_observability(not_observable_input, info, y_bus), NotObservableError);
+        CHECK(info.report().at(observability_cache_miss) == 2.0);
+        CHECK(info.report().at(observability_cache_hit) == 2.0);
+    }
+
+}
+
 } // namespace power_grid_model
@@ -15,7 +15,11 @@
 #include <algorithm>
 #include <cstddef>
 #include <iterator>
+#include <memory>
+#include <ranges>
+#include <set>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace power_grid_model::math_solver {
@@ -248,6 +252,59 @@ BlockSparseMatrix four_node_meshed_with_preallocated_fill_in_lu_test_matrix() {
             },
     };
 }
+
+// A radial network of which the buses are ordered from the leaves to the root, with additional meshes to create fill-ins.
+// The elimination tree has many leaves and is wide enough to be factorized in parallel.
+BlockSparseMatrix large_tree_with_fill_ins_lu_test_matrix() {
+    constexpr Idx size = 2000;
+    std::vector<std::set<Idx>> adjacency(size);
+    auto const connect = [&adjacency](Idx from, Idx to) {
+        adjacency[from].insert(to);
+        adjacency[to].insert(from);
+    };
+    IdxVector parent(size, -1);
+    for (Idx bus = 0; bus != size - 1; ++bus) {
+        parent[bus] = std::min(size - 1, bus + 1 + (bus * 37) % 50);
+        connect(bus, parent[bus]);
+        if (bus % 5 == 0 && parent[parent[bus]] != -1) {
+            connect(bus, parent[parent[bus]]);
+        }
+    }
+    // symbolic elimination: the remaining neighbours of each eliminated bus become a clique
+    for (Idx bus = 0; bus != size; ++bus) {
+        IdxVector const higher(adjacency[bus].upper_bound(bus), adjacency[bus].end());
+        for (Idx const from : higher) {
+            for (Idx const to : higher) {
+                if (from != to) {
+                    connect(from, to);
+                }
+            }
+        }
+    }
+
+    BlockSparseMatrix result{.row_indptr = {0}, .col_indices = {}, .diag_lu = {}, .data = {}};
+    for (Idx row = 0; row != size; ++row) {
+        adjacency[row].insert(row);
+        for (Idx const col : adjacency[row]) {
+            if (col == row) {
+                result.diag_lu.push_back(std::ssize(result.col_indices));
+                auto const degree = static_cast<double>(adjacency[row].size());
+                result.data.push_back(Tensor{{4.0 * degree, 1.0}, {-1.0, 5.0 * degree}});
+            } else if (adjacency[row].size() > 0 && (col == parent[row] || row == parent[col] ||
+                                                      (row % 5 == 0 && col == parent[parent[row]]) ||
+                                                      (col % 5 == 0 && row == parent[parent[col]]))) {
+                auto const offset = static_cast<double>((row + 2 * col) % 11) / 10.0;
+                result.data.push_back(Tensor{{-1.0 - offset, 0.5}, {0.25, -1.0 + offset}});
+            } else {
+                // fill-in
+                result.data.push_back(Tensor::Zero());
+            }
+            result.col_indices.push_back(col);
+        }
+        result.row_indptr.push_back(std::ssize(result.col_indices));
+    }
+    return result;
+}
 } // namespace
 
 TEST_CASE("Dense LU factor") {
@@ -465,6 +522,210 @@ TEST_CASE("Test Sparse LU solver") {
     }
 }
 
+TEST_CASE("Sparse LU symbolic factorization") {
+    auto const matrix = four_node_meshed_with_preallocated_fill_in_lu_test_matrix();
+    auto const symbolic =
+        std::make_shared<SparseLUSymbolic const>(matrix.row_indptr, matrix.col_indices, matrix.diag_lu);
+
+    SUBCASE("Structure") {
+        CHECK(symbolic->size() == 4);
+        CHECK(symbolic->transpose_entry() == IdxVector{0, 3, 10, 1, 4, 7, 11, 5, 8, 12, 2, 6, 9, 13});
+        CHECK(symbolic->elimination_parent() == IdxVector{1, 2, 3, -1});
+
+        auto const targets = [&symbolic](Idx pivot) {
+            auto const span = symbolic->schur_update_target(pivot);
+            return IdxVector(span.begin(), span.end());
+        };
+        CHECK(targets(0) == IdxVector{4, 6, 11, 13});
+        CHECK(targets(1) == IdxVector{8, 9, 12, 13});
+        CHECK(targets(2) == IdxVector{13});
+        CHECK(targets(3).empty());
+
+        // the elimination tree is a chain
+        CHECK(symbolic->n_levels() == 4);
+        CHECK(symbolic->chain_level_begin() == 0);
+        for (Idx level = 0; level != 4; ++level) {
+            auto const pivots = symbolic->level_pivots(level);
+            CHECK(IdxVector(pivots.begin(), pivots.end()) == IdxVector{level});
+        }
+
+        auto const pull_targets = [&symbolic](Idx pivot) {
+            IdxVector result;
+            for (auto const& update : symbolic->pull_updates(pivot)) {
+                result.push_back(update.target);
+            }
+            return result;
+        };
+        CHECK(pull_targets(0).empty());
+        CHECK(pull_targets(1) == IdxVector{4, 6, 11});
+        CHECK(pull_targets(2) == IdxVector{8, 9, 12});
+        CHECK(pull_targets(3) == IdxVector{13, 13, 13});
+    }
+
+    SUBCASE("Shared between solvers") {
+        std::vector<Array> const x_ref = {{1, 2}, {-1, 3}, {4, -2}, {2, 1}};
+        std::vector<Array> const rhs = {{21, 40}, {-17, 64}, {82, -47}, {55, 38}};
+
+        for (Idx solver_idx = 0; solver_idx != 2; ++solver_idx) {
+            CAPTURE(solver_idx);
+            std::vector<Tensor> data = matrix.data;
+            std::vector<Array> x(4, Array::Zero());
+            SparseLUSolver<Tensor, Array, Array> solver{matrix.row_indptr, matrix.col_indices, matrix.diag_lu,
+                                                        symbolic};
+            SparseLUSolver<Tensor, Array, Array>::BlockPermArray block_perm(matrix.row_indptr.size() - 1);
+
+            solver.prefactorize_and_solve(data, block_perm, rhs, x);
+            check_result(x, x_ref);
+        }
+    }
+}
+
+TEST_CASE("Sparse LU solver in parallel") {
+    auto matrix = large_tree_with_fill_ins_lu_test_matrix();
+    auto const symbolic =
+        std::make_shared<SparseLUSymbolic const>(matrix.row_indptr, matrix.col_indices, matrix.diag_lu);
+    Idx const size = symbolic->size();
+    REQUIRE(symbolic->chain_level_begin() > 1);
+
+    std::vector<Array> rhs(size);
+    for (Idx row = 0; row != size; ++row) {
+        rhs[row] = Array{static_cast<double>(row % 7) - 3.0, static_cast<double>(row % 5) + 1.0};
+    }
+
+    SparseLULevelThreads level_threads;
+
+    auto const solve = [&](Idx n_threads, std::vector<Tensor>& data, std::vector<Array>& x) {
+        SparseLUSolver<Tensor, Array, Array> solver{matrix.row_indptr, matrix.col_indices, matrix.diag_lu, symbolic};
+        CHECK(solver.n_threads() == 1);
+        solver.set_n_threads(n_threads, &level_threads);
+        SparseLUSolver<Tensor, Array, Array>::BlockPermArray block_perm(size);
+        solver.prefactorize_and_solve(data, block_perm, rhs, x);
+    };
+
+    SUBCASE("Bitwise identical to sequential") {
+        std::vector<Tensor> sequential_data = matrix.data;
+        std::vector<Array> sequential_x(size, Array::Zero());
+        solve(1, sequential_data, sequential_x);
+
+        // residual of the sequential solution
+        for (Idx row = 0; row != size; ++row) {
+            Array residual = rhs[row];
+            for (Idx idx = matrix.row_indptr[row]; idx != matrix.row_indptr[row + 1]; ++idx) {
+                residual -= dot(matrix.data[idx], sequential_x[matrix.col_indices[idx]]);
+            }
+            CHECK((cabs(residual) < numerical_tolerance).all());
+        }
+
+        for (Idx const n_threads : {2, 3, 8}) {
+            CAPTURE(n_threads);
+            std::vector<Tensor> parallel_data = matrix.data;
+            std::vector<Array> parallel_x(size, Array::Zero());
+            solve(n_threads, parallel_data, parallel_x);
+            CHECK(std::ranges::equal(parallel_data, sequential_data,
+                                     [](Tensor const& lhs, Tensor const& rhs_) { return (lhs == rhs_).all(); }));
+            CHECK(std::ranges::equal(parallel_x, sequential_x,
+                                     [](Array const& lhs, Array const& rhs_) { return (lhs == rhs_).all(); }));
+        }
+    }
+
+    SUBCASE("Threads shared between calls, copies and other solvers") {
+        std::vector<Tensor> sequential_data = matrix.data;
+        std::vector<Array> sequential_x(size, Array::Zero());
+        solve(1, sequential_data, sequential_x);
+
+        SparseLUSolver<Tensor, Array, Array> solver{matrix.row_indptr, matrix.col_indices, matrix.diag_lu, symbolic};
+        solver.set_n_threads(3, &level_threads);
+        auto const check_solver = [&](SparseLUSolver<Tensor, Array, Array>& solver_) {
+            for (Idx repeat = 0; repeat != 3; ++repeat) {
+                CAPTURE(repeat);
+                std::vector<Tensor> parallel_data = matrix.data;
+                std::vector<Array> parallel_x(size, Array::Zero());
+                SparseLUSolver<Tensor, Array, Array>::BlockPermArray block_perm(size);
+                solver_.prefactorize_and_solve(parallel_data, block_perm, rhs, parallel_x);
+                CHECK(std::ranges::equal(parallel_x, sequential_x,
+                                         [](Array const& lhs, Array const& rhs_) { return (lhs == rhs_).all(); }));
+            }
+        };
+        check_solver(solver);
+        auto solver_copy = solver;
+        check_solver(solver_copy);
+        check_solver(solver);
+        SparseLUSolver<Tensor, Array, Array> other_solver{matrix.row_indptr, matrix.col_indices, matrix.diag_lu,
+                                                          symbolic};
+        other_solver.set_n_threads(2, &level_threads);
+        check_solver(other_solver);
+    }
+
+    SUBCASE("Singular matrix") {
+        matrix.data[matrix.diag_lu[0]] = Tensor::Zero();
+        std::vector<Array> x(size, Array::Zero());
+        CHECK_THROWS_AS(solve(4, matrix.data, x), SparseMatrixError);
+    }
+}
+
+TEST_CASE("Sparse LU partial refactorization") {
+    auto const matrix = large_tree_with_fill_ins_lu_test_matrix();
+    auto const symbolic =
+        std::make_shared<SparseLUSymbolic const>(matrix.row_indptr, matrix.col_indices, matrix.diag_lu);
+    Idx const size = symbolic->size();
+    using BlockPermArray = SparseLUSolver<Tensor, Array, Array>::BlockPermArray;
+
+    auto const prefactorize = [&](std::vector<Tensor>& data, BlockPermArray& block_perm) {
+        SparseLUSolver<Tensor, Array, Array> solver{matrix.row_indptr, matrix.col_indices, matrix.diag_lu, symbolic};
+        solver.prefactorize(data, block_perm);
+    };
+    auto const find_entry = [&matrix](Idx row, Idx col) {
+        auto const row_begin = matrix.col_indices.begin() + matrix.row_indptr[row];
+        auto const row_end = matrix.col_indices.begin() + matrix.row_indptr[row + 1];
+        return std::distance(matrix.col_indices.begin(), std::find(row_begin, row_end, col));
+    };
+
+    std::vector<Tensor> lu_data = matrix.data;
+    BlockPermArray block_perm(size);
+    prefactorize(lu_data, block_perm);
+
+    // change a branch between two buses
+    std::vector<Tensor> new_matrix = matrix.data;
+    IdxVector changed_entries;
+    Idx const from = 10;
+    Idx const to = symbolic->elimination_parent()[from];
+    REQUIRE(to != -1);
+    for (auto const [row, col] : {std::pair{from, from}, std::pair{from, to}, std::pair{to, from}, std::pair{to, to}}) {
+        Idx const idx = find_entry(row, col);
+        new_matrix[idx] += Tensor{{0.5, -0.25}, {0.125, 0.5}};
+        changed_entries.push_back(idx);
+    }
+    std::ranges::sort(changed_entries);
+    REQUIRE(2 * std::ssize(symbolic->elimination_paths(IdxVector{from})) <= size);
+
+    std::vector<Tensor> expected_lu_data = new_matrix;
+    BlockPermArray expected_block_perm(size);
+    prefactorize(expected_lu_data, expected_block_perm);
+
+    auto const check_partial = [&](std::vector<Tensor>& partial_lu_data, BlockPermArray& partial_block_perm,
+                                   IdxVector const& entries) {
+        SparseLUSolver<Tensor, Array, Array> solver{matrix.row_indptr, matrix.col_indices, matrix.diag_lu, symbolic};
+        solver.prefactorize_partial(new_matrix, entries, partial_lu_data, partial_block_perm);
+        CHECK(std::ranges::equal(partial_lu_data, expected_lu_data,
+                                 [](Tensor const& lhs, Tensor const& rhs) { return (lhs == rhs).all(); }));
+        for (Idx row = 0; row != size; ++row) {
+            CHECK(partial_block_perm[row].p.indices() == expected_block_perm[row].p.indices());
+            CHECK(partial_block_perm[row].q.indices() == expected_block_perm[row].q.indices());
+        }
+    };
+
+    SUBCASE("Only the elimination paths") { check_partial(lu_data, block_perm, changed_entries); }
+
+    SUBCASE("Fall back to full factorization") {
+        // changing all diagonals affects all pivots
+        for (Idx row = 0; row != size; ++row) {
+            changed_entries.push_back(matrix.diag_lu[row]);
+        }
+        std::ranges::sort(changed_entries);
+        check_partial(lu_data, block_perm, changed_entries);
+    }
+}
+
 TEST_CASE("LU solver with ill-conditioned system") {
     // test with ill-conditioned matrix if we do not do numerical pivoting
     // 4*4 matrix, or 2*2 with 2*2 blocks
@@ -13,6 +13,9 @@
 #include <doctest/doctest.h>
 
 #include <algorithm>
+#include <array>
+#include <memory>
+#include <vector>
 
 namespace power_grid_model {
 namespace {
@@ -97,5 +100,101 @@ TEST_CASE("Test SolverPreparationContext") {
     }
 }
 
+TEST_CASE("Test CalculationInputCache") {
+    using PFInput = PowerFlowInput<symmetric_t>;
+    using SEInput = StateEstimationInput<symmetric_t>;
+    using SequenceIdx = MainModelType::SequenceIdx;
+
+    CalculationInputCache<MainModelType> cache{};
+    std::vector<std::shared_ptr<MathModelTopology const>> math_topology{std::make_shared<MathModelTopology const>()};
+    Idx n_prepare_all{};
+    Idx n_update{};
+    SequenceIdx last_updated{};
+
+    auto const prepare = [&]<typename InputType>() -> std::vector<InputType> const& {
+        return cache.prepare<InputType>(
+            math_topology,
+            [&n_prepare_all](std::vector<InputType>& input) {
+                ++n_prepare_all;
+                input.resize(1);
+            },
+            [&n_update, &last_updated](SequenceIdx const& updated, std::vector<InputType>& input) {
+                ++n_update;
+                last_updated = updated;
+                CHECK(input.size() == 1);
+            });
+    };
+    auto const prepare_pf = [&prepare]() -> std::vector<PFInput> const& {
+        return prepare.template operator()<PFInput>();
+    };
+
+    SUBCASE("Nothing is recorded before the first preparation") {
+        std::array const updated{Idx2D{.group = 0, .pos = 0}};
+        cache.record_updated_components<0>(updated, 2);
+        prepare_pf();
+        CHECK(n_prepare_all == 1);
+        CHECK(n_update == 0);
+    }
+
+    SUBCASE("Update only the recorded components") {
+        auto const& input = prepare_pf();
+        CHECK(input.size() == 1);
+
+        std::array const updated{Idx2D{.group = 0, .pos = 1}};
+        cache.record_updated_components<1>(updated, 2);
+        CHECK(&prepare_pf() == &input);
+        CHECK(n_prepare_all == 1);
+        CHECK(n_update == 1);
+        CHECK(std::get<1>(last_updated).size() == 1);
+        CHECK(std::get<1>(last_updated)[0] == Idx2D{.group = 0, .pos = 1});
+
+        // the record is cleared after each preparation
+        prepare_pf();
+        CHECK(n_update == 2);
+        CHECK(std::ranges::all_of(last_updated, [](auto const& vec) { return vec.empty(); }));
+    }
+
+    SUBCASE("Recalculate all when more components are updated than there are") {
+        prepare_pf();
+        std::array const updated{Idx2D{.group = 0, .pos = 0}, Idx2D{.group = 0, .pos = 1}};
+        cache.record_updated_components<0>(updated, 2);
+        cache.record_updated_components<0>(updated, 2);
+        prepare_pf();
+        CHECK(n_prepare_all == 2);
+        CHECK(n_update == 0);
+    }
+
+    SUBCASE("Recalculate all on request") {
+        prepare_pf();
+        std::array const updated{Idx2D{.group = 0, .pos = 0}};
+        cache.record_updated_components<0>(updated, 2);
+        // e.g., an update failed halfway, so the updated components are not known
+        cache.request_full_refresh();
+        prepare_pf();
+        CHECK(n_prepare_all == 2);
+        CHECK(n_update == 0);
+    }
+
+    SUBCASE("Recalculate all when the math topology changes") {
+        prepare_pf();
+        math_topology = {std::make_shared<MathModelTopology const>()};
+        prepare_pf();
+        CHECK(n_prepare_all == 2);
+        CHECK(n_update == 0);
+        prepare_pf();
+        CHECK(n_prepare_all == 2);
+        CHECK(n_update == 1);
+    }
+
+    SUBCASE("Recalculate all when the calculation type changes") {
+        prepare_pf();
+        prepare.template operator()<SEInput>();
+        CHECK(n_prepare_all == 2);
+        prepare_pf();
+        CHECK(n_prepare_all == 3);
+        CHECK(n_update == 0);
+    }
+}
+
 } // namespace
 } // namespace power_grid_model
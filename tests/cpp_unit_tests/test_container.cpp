@@ -11,8 +11,10 @@
 #include <doctest/doctest.h>
 
 #include <cstdint>
+#include <iterator>
 #include <ranges>
 #include <type_traits>
+#include <vector>
 
 namespace power_grid_model {
 
@@ -149,6 +151,20 @@ TEST_CASE("Test component container") {
         CHECK_THROWS_AS(container.template get_item<C>(8), IDNotFound);
     }
 
+    SUBCASE("Test get idx_2d based on a range of ids") {
+        std::vector<ID> const ids{3, 1, 22};
+        std::vector<Idx2D> result;
+        const_container.get_idx_by_id(ids, std::back_inserter(result));
+        CHECK(result == std::vector<Idx2D>{{2, 0}, {0, 0}, {1, 1}});
+
+        result.clear();
+        const_container.template get_idx_by_id<C>(ids, std::back_inserter(result));
+        CHECK(result == std::vector<Idx2D>{{2, 0}, {0, 0}, {1, 1}});
+
+        CHECK_THROWS_AS(const_container.template get_idx_by_id<C1>(ids, std::back_inserter(result)), IDWrongType);
+        CHECK_THROWS_AS(const_container.get_idx_by_id(std::vector<ID>{1, 8}, std::back_inserter(result)), IDNotFound);
+    }
+
     SUBCASE("Test size of a component class collection") {
         CHECK(const_container.size<C>() == 6);
         CHECK(const_container.size<C1>() == 2);
@@ -234,6 +250,34 @@ TEST_CASE("Test component container") {
     }
 #endif // NDEBUG
 
+    SUBCASE("Test register ids in advance") {
+        CompContainer registered;
+        registered.register_ids<C1>(std::vector<ID>{2, 22});
+        registered.register_ids<C>(std::vector<ID>{1, 11, 111});
+        registered.register_ids<C2>(std::vector<ID>{3});
+        CHECK_THROWS_AS(registered.register_ids<C2>(std::vector<ID>{33, 11}), ConflictID);
+
+        // the index is complete before any component is constructed
+        CHECK(registered.get_idx_by_id(111) == Idx2D{0, 2});
+        CHECK(registered.get_idx_by_id(22) == Idx2D{1, 1});
+        CHECK(registered.get_idx_by_id(33) == Idx2D{2, 1});
+
+        registered.emplace_registered<C2>(3, 7, 70);
+        registered.emplace_registered<C>(1, 5);
+        registered.emplace_registered<C>(11, 55);
+        registered.emplace_registered<C>(111, 555);
+        registered.emplace_registered<C1>(2, 6, 60);
+        registered.emplace_registered<C1>(22, 66, 660);
+        registered.emplace_registered<C2>(33, 77, 770);
+        registered.set_construction_complete();
+
+        CHECK(registered.size<C>() == 7);
+        CHECK(registered.get_item<C>(111).a == 555);
+        CHECK(registered.get_item<C1>(22).b == 660);
+        CHECK(registered.get_item<C2>(3).b == 70);
+        CHECK(registered.get_item_by_seq<C>(6).a == 77);
+    }
+
     SUBCASE("Component Container concept") {
         static_assert(common::component_container_c<CompContainer, C>);
         static_assert(common::component_container_c<CompContainer, C1>);
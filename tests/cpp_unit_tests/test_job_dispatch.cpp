@@ -4,9 +4,12 @@
 
 #include <power_grid_model/job_dispatch.hpp>
 #include <power_grid_model/job_interface.hpp>
+#include <power_grid_model/job_worker_pool.hpp>
 
 #include <power_grid_model/batch_parameter.hpp>
 #include <power_grid_model/common/common.hpp>
+#include <power_grid_model/common/counting_iterator.hpp>
+#include <power_grid_model/common/enum.hpp>
 #include <power_grid_model/common/exception.hpp>
 #include <power_grid_model/common/logging.hpp>
 #include <power_grid_model/common/multi_threaded_logging.hpp>
@@ -17,7 +20,6 @@
 #include <algorithm>
 #include <atomic>
 #include <memory>
-#include <mutex>
 #include <ranges>
 #include <stdexcept>
 #include <string>
@@ -32,8 +34,11 @@ struct MockUpdateDataset {
     MockUpdateDataset(bool data, Idx n_scenarios) : data{data}, n_scenarios{n_scenarios} {}
     bool data;
     Idx n_scenarios;
+    MockUpdateDataset const* next{};
+    Idx failing_scenario{-1}; // applying this scenario throws
     bool empty() const { return !data; }
     Idx batch_size() const { return n_scenarios; }
+    MockUpdateDataset const* get_next_cartesian_product_dimension() const { return next; }
 };
 
 struct MockResultDataset {};
@@ -43,6 +48,8 @@ struct CallCounter {
     std::atomic<Idx> cache_calculate_calls{};
     std::atomic<Idx> setup_calls{};
     std::atomic<Idx> winddown_calls{};
+    std::atomic<Idx> apply_update_calls{};
+    std::atomic<Idx> copy_calls{};
     std::atomic<Idx> set_logger_calls{};
     std::atomic<Idx> reset_logger_calls{};
 
@@ -51,20 +58,28 @@ struct CallCounter {
         cache_calculate_calls = 0;
         setup_calls = 0;
         winddown_calls = 0;
+        apply_update_calls = 0;
+        copy_calls = 0;
         set_logger_calls = 0;
         reset_logger_calls = 0;
     }
 };
 
+class SomeTestException : public std::runtime_error {
+  public:
+    using std::runtime_error::runtime_error;
+};
+
 class JobAdapterMock : public JobInterface {
   public:
     JobAdapterMock(std::shared_ptr<CallCounter> counter) : counter_{std::move(counter)} {
         REQUIRE_MESSAGE(counter_ != nullptr, "Counter must not be null or all getters will fail later on");
     }
-    JobAdapterMock(JobAdapterMock const& other) : counter_{other.counter_} {}
+    JobAdapterMock(JobAdapterMock const& other) : counter_{other.counter_} { ++(counter_->copy_calls); }
     JobAdapterMock& operator=(JobAdapterMock const& other) {
         if (this != &other) {
             counter_ = other.counter_;
+            ++(counter_->copy_calls);
         }
         return *this;
     };
@@ -82,6 +97,8 @@ class JobAdapterMock : public JobInterface {
     Idx get_cache_calculate_counter() const { return counter_->cache_calculate_calls; }
     Idx get_setup_counter() const { return counter_->setup_calls; }
     Idx get_winddown_counter() const { return counter_->winddown_calls; }
+    Idx get_apply_update_counter() const { return counter_->apply_update_calls; }
+    Idx get_copy_counter() const { return counter_->copy_calls; }
 
   private:
     friend class JobInterface;
@@ -96,11 +113,12 @@ class JobAdapterMock : public JobInterface {
     void prepare_job_dispatch_impl(MockUpdateDataset const& /*update_data*/) const { /* patch base class function */ }
     void setup_impl(MockUpdateDataset const& /*update_data*/, Idx /*scenario_idx*/) const { ++(counter_->setup_calls); }
     void winddown_impl() const { ++(counter_->winddown_calls); }
-};
-
-class SomeTestException : public std::runtime_error {
-  public:
-    using std::runtime_error::runtime_error;
+    void apply_update_impl(MockUpdateDataset const& update_data, Idx scenario_idx) const {
+        ++(counter_->apply_update_calls);
+        if (scenario_idx == update_data.failing_scenario) {
+            throw SomeTestException{"Apply update error"};
+        }
+    }
 };
 
 using common::logging::MultiThreadedLogger;
@@ -155,6 +173,57 @@ TEST_CASE("Test job dispatch logic") {
             CHECK(adapter.get_cache_calculate_counter() == 1); // cache calculation is done
         }
     }
+    SUBCASE("Test cartesian product batch") {
+        auto counter = std::make_shared<CallCounter>();
+        auto adapter = JobAdapterMock{counter};
+        auto result_data = MockResultDataset{};
+        Idx const n_outer = 3;
+        Idx const n_middle = 2;
+        Idx const n_inner = 4;
+        auto inner_data = MockUpdateDataset(true, n_inner);
+        auto middle_data = MockUpdateDataset(true, n_middle);
+        auto outer_data = MockUpdateDataset(true, n_outer);
+        middle_data.next = &inner_data;
+        outer_data.next = &middle_data;
+
+        CHECK(JobDispatch::total_batch_size(outer_data) == n_outer * n_middle * n_inner);
+        CHECK(JobDispatch::batch_dimensions(outer_data) ==
+              std::vector<MockUpdateDataset const*>{&outer_data, &middle_data, &inner_data});
+
+        SUBCASE("All scenarios in one job space") {
+            adapter.reset_counters();
+            JobDispatch::batch_calculation(adapter, result_data, outer_data, main_core::utils::sequential,
+                                           no_logger());
+            CHECK(adapter.get_calculate_counter() == n_outer * n_middle * n_inner);
+            CHECK(adapter.get_setup_counter() == n_outer * n_middle * n_inner);
+            CHECK(adapter.get_winddown_counter() == n_outer * n_middle * n_inner);
+            // the outer updates are applied once per outer scenario, on a fresh copy of the base model
+            CHECK(adapter.get_apply_update_counter() == n_outer * n_middle * 2);
+            CHECK(adapter.get_copy_counter() == n_outer * n_middle);
+            CHECK(adapter.get_cache_calculate_counter() == 1);
+        }
+        SUBCASE("Failed outer update") {
+            middle_data.failing_scenario = 1;
+            adapter.reset_counters();
+            try {
+                JobDispatch::batch_calculation(adapter, result_data, outer_data, main_core::utils::sequential,
+                                               no_logger());
+                FAIL("should have thrown here");
+            } catch (BatchCalculationError const& e) {
+                // all scenarios with the failing middle scenario, mapped to the flattened scenario index
+                IdxVector expected_failed_scenarios;
+                for (Idx outer = 0; outer != n_outer; ++outer) {
+                    for (Idx inner = 0; inner != n_inner; ++inner) {
+                        expected_failed_scenarios.push_back((outer * n_middle + 1) * n_inner + inner);
+                    }
+                }
+                CHECK(e.failed_scenarios() == expected_failed_scenarios);
+                CHECK(std::ranges::all_of(e.err_msgs(),
+                                          [](std::string const& msg) { return msg == "Apply update error"; }));
+            }
+            CHECK(adapter.get_calculate_counter() == n_outer * (n_middle - 1) * n_inner);
+        }
+    }
     SUBCASE("Test single_thread_job") {
         auto counter = std::make_shared<CallCounter>();
         auto adapter = JobAdapterMock{counter};
@@ -163,16 +232,6 @@ TEST_CASE("Test job dispatch logic") {
         Idx const n_scenarios = 9; // arbitrary non-zero value
         auto const update_data = MockUpdateDataset(has_data, n_scenarios);
         exceptions.resize(n_scenarios);
-        Idx start{};
-        Idx stride{};
-        Idx call_number{};
-
-        auto get_call_number = [](Idx start_, Idx stride_, Idx n_scenarios_) {
-            REQUIRE_MESSAGE(
-                stride_ > 0,
-                "Can't have stride of (less than) zero; this should be caught by a different job dispatch handling");
-            return (n_scenarios_ - start_ + stride_ - 1) / stride_;
-        };
 
         auto check_call_numbers = [](JobAdapterMock const& adapter_, Idx expected_calls) {
             CHECK(adapter_.get_setup_counter() == expected_calls);
@@ -184,52 +243,131 @@ TEST_CASE("Test job dispatch logic") {
         common::logging::NoMultiThreadedLogger no_log;
         auto single_job = JobDispatch::single_thread_job(adapter, result_data, update_data, exceptions, no_log);
 
-        adapter.reset_counters();
-        start = 0;
-        stride = 1;
-        call_number = get_call_number(start, stride, n_scenarios);
-        CAPTURE(call_number);
-        CHECK_NOTHROW(single_job(start, stride, n_scenarios));
-        check_call_numbers(adapter, call_number);
-
-        adapter.reset_counters();
-        start = 0;
-        stride = 4;
-        call_number = get_call_number(start, stride, n_scenarios);
-        CAPTURE(call_number);
-        CHECK_NOTHROW(single_job(start, stride, n_scenarios));
-        check_call_numbers(adapter, call_number);
-
-        adapter.reset_counters();
-        start = 3;
-        stride = 2;
-        call_number = get_call_number(start, stride, n_scenarios);
-        CAPTURE(call_number);
-        CHECK_NOTHROW(single_job(start, stride, n_scenarios));
-        check_call_numbers(adapter, call_number);
+        SUBCASE("Single thread claims all scenarios") {
+            for (Idx const n_thread : {Idx{1}, Idx{4}}) {
+                CAPTURE(n_thread);
+                adapter.reset_counters();
+                JobDispatch::ScenarioQueue scenario_queue{n_scenarios, n_thread};
+                CHECK_NOTHROW(single_job(scenario_queue));
+                check_call_numbers(adapter, n_scenarios);
+                CHECK(scenario_queue.next_chunk().empty());
+            }
+        }
+        SUBCASE("Partially claimed queue") {
+            adapter.reset_counters();
+            JobDispatch::ScenarioQueue scenario_queue{n_scenarios, n_scenarios};
+            REQUIRE(scenario_queue.chunk_size() == 1);
+            auto const claimed = scenario_queue.next_chunk();
+            CHECK_NOTHROW(single_job(scenario_queue));
+            check_call_numbers(adapter, n_scenarios - std::ssize(claimed));
+        }
+        SUBCASE("Exhausted queue") {
+            adapter.reset_counters();
+            JobDispatch::ScenarioQueue scenario_queue{n_scenarios, 1};
+            while (!scenario_queue.next_chunk().empty()) {
+                // drain the queue
+            }
+            CHECK_NOTHROW(single_job(scenario_queue));
+            check_call_numbers(adapter, 0);
+        }
+    }
+    SUBCASE("Test ScenarioQueue") {
+        auto drain = [](JobDispatch::ScenarioQueue& scenario_queue) {
+            std::vector<IdxRange> chunks;
+            for (auto chunk = scenario_queue.next_chunk(); !chunk.empty(); chunk = scenario_queue.next_chunk()) {
+                chunks.push_back(chunk);
+            }
+            return chunks;
+        };
+
+        SUBCASE("Chunks cover all scenarios exactly once and in order") {
+            for (Idx const n_scenarios : {Idx{1}, Idx{7}, Idx{64}, Idx{1001}}) {
+                for (Idx const n_thread : {Idx{1}, Idx{3}, Idx{8}}) {
+                    CAPTURE(n_scenarios);
+                    CAPTURE(n_thread);
+                    JobDispatch::ScenarioQueue scenario_queue{n_scenarios, n_thread};
+                    CHECK(scenario_queue.chunk_size() >= 1);
+                    CHECK(scenario_queue.chunk_size() <= std::max(Idx{1}, n_scenarios / n_thread));
+                    Idx expected_begin{0};
+                    for (auto const& chunk : drain(scenario_queue)) {
+                        CHECK(chunk.front() == expected_begin);
+                        CHECK(std::ssize(chunk) <= scenario_queue.chunk_size());
+                        expected_begin = chunk.back() + 1;
+                    }
+                    CHECK(expected_begin == n_scenarios);
+                    CHECK(scenario_queue.next_chunk().empty());
+                }
+            }
+        }
+        SUBCASE("No scenarios") {
+            JobDispatch::ScenarioQueue scenario_queue{0, 4};
+            CHECK(scenario_queue.next_chunk().empty());
+        }
+        SUBCASE("Static round-robin") {
+            Idx const n_scenarios = 10;
+            Idx const n_thread = 3;
+            JobDispatch::ScenarioQueue scenario_queue{n_scenarios, n_thread,
+                                                      JobDispatch::BatchScheduling::static_round_robin};
+            CHECK(scenario_queue.chunk_size() == 1);
+            for (Idx thread_number = 0; thread_number < n_thread; ++thread_number) {
+                CAPTURE(thread_number);
+                auto thread_scenarios = scenario_queue.thread_scenarios();
+                IdxVector scenarios;
+                for (auto chunk = thread_scenarios.next_chunk(); !chunk.empty();
+                     chunk = thread_scenarios.next_chunk()) {
+                    scenarios.insert(scenarios.end(), chunk.begin(), chunk.end());
+                }
+                IdxVector expected;
+                for (Idx scenario_idx = thread_number; scenario_idx < n_scenarios; scenario_idx += n_thread) {
+                    expected.push_back(scenario_idx);
+                }
+                CHECK(scenarios == expected);
+            }
+        }
+        SUBCASE("Concurrent claims") {
+            Idx const n_scenarios = 997; // arbitrary prime
+            Idx const n_thread = 4;
+            JobDispatch::ScenarioQueue scenario_queue{n_scenarios, n_thread};
+            std::vector<std::atomic<Idx>> claim_counts(n_scenarios);
+            {
+                std::vector<std::jthread> threads;
+                for (Idx thread_number = 0; thread_number < n_thread; ++thread_number) {
+                    threads.emplace_back([&scenario_queue, &claim_counts] {
+                        for (auto chunk = scenario_queue.next_chunk(); !chunk.empty();
+                             chunk = scenario_queue.next_chunk()) {
+                            for (Idx const scenario_idx : chunk) {
+                                ++claim_counts[scenario_idx];
+                            }
+                        }
+                    });
+                }
+            }
+            CHECK(std::ranges::all_of(claim_counts, [](std::atomic<Idx> const& count) { return count == 1; }));
+        }
     }
     SUBCASE("Test job_dispatch") {
-        struct JobArguments {
-            Idx start;
-            Idx stride;
-            Idx n_scenarios;
+        std::atomic<Idx> n_calls{0};
+        std::vector<std::atomic<Idx>> claim_counts;
+        auto single_job = [&n_calls, &claim_counts](JobDispatch::ScenarioQueue& scenario_queue) {
+            ++n_calls;
+            auto thread_scenarios = scenario_queue.thread_scenarios();
+            for (auto chunk = thread_scenarios.next_chunk(); !chunk.empty(); chunk = thread_scenarios.next_chunk()) {
+                for (Idx const scenario_idx : chunk) {
+                    ++claim_counts[scenario_idx];
+                }
+            }
         };
-        std::vector<JobArguments> calls;
-        std::mutex calls_mutex;
-        auto single_job = [&calls, &calls_mutex](Idx start, Idx stride, Idx n_scenarios) {
-            std::scoped_lock<std::mutex> const lock(calls_mutex);
-            calls.emplace_back(start, stride, n_scenarios);
+        auto all_claimed_once = [&claim_counts] {
+            return std::ranges::all_of(claim_counts, [](std::atomic<Idx> const& count) { return count == 1; });
         };
 
         SUBCASE("Sequential") {
             Idx const n_scenarios = 10; // arbitrary non-zero value
             Idx const threading = main_core::utils::sequential;
-            calls.clear();
+            claim_counts = std::vector<std::atomic<Idx>>(n_scenarios);
             JobDispatch::job_dispatch(single_job, n_scenarios, threading);
-            CHECK(calls.size() == 1);
-            CHECK(calls.front().start == 0);
-            CHECK(calls.front().stride == 1);
-            CHECK(calls.front().n_scenarios == 10);
+            CHECK(n_calls == 1);
+            CHECK(all_claimed_once());
         }
 
         SUBCASE("Multi-threaded") {
@@ -240,37 +378,48 @@ TEST_CASE("Test job dispatch logic") {
 
             SUBCASE("More scenarios than hardware threads") {
                 Idx const n_scenarios = hardware_thread + 1; // larger than hardware threads
-                calls.clear();
+                claim_counts = std::vector<std::atomic<Idx>>(n_scenarios);
                 CAPTURE(hardware_thread);
                 CHECK(hardware_thread == JobDispatch::n_threads(n_scenarios, threading));
                 JobDispatch::job_dispatch(single_job, n_scenarios, threading);
-                CHECK(calls.size() == hardware_thread);
-                auto const n_threads = static_cast<Idx>(calls.size());
-                CHECK(std::ranges::all_of(std::views::iota(Idx{0}, n_threads), [&calls](Idx i) {
-                    return std::ranges::any_of(calls, [i](JobArguments const& call) { return call.start == i; });
-                }));
-                CHECK(std::ranges::all_of(calls,
-                                          [n_threads](JobArguments const& call) { return call.stride == n_threads; }));
-                CHECK(std::ranges::all_of(
-                    calls, [n_scenarios](JobArguments const& call) { return call.n_scenarios == n_scenarios; }));
+                CHECK(n_calls == hardware_thread);
+                CHECK(all_claimed_once());
             }
             SUBCASE("Less scenarios than hardware threads") {
                 Idx const n_scenarios = std::max(Idx{0}, hardware_thread - 1);
                 CAPTURE(n_scenarios);
-                calls.clear();
+                claim_counts = std::vector<std::atomic<Idx>>(n_scenarios);
                 CAPTURE(hardware_thread);
                 CHECK(n_scenarios == JobDispatch::n_threads(n_scenarios, threading));
                 JobDispatch::job_dispatch(single_job, n_scenarios, threading);
-                CHECK(calls.size() == n_scenarios);
-                auto const n_threads = static_cast<Idx>(calls.size());
-                CHECK(std::ranges::all_of(std::views::iota(0, n_threads), [&calls](Idx i) {
-                    return std::ranges::any_of(calls, [i](JobArguments const& call) { return call.start == i; });
-                }));
-                CHECK(std::ranges::all_of(calls,
-                                          [n_threads](JobArguments const& call) { return call.stride == n_threads; }));
-                CHECK(std::ranges::all_of(
-                    calls, [n_scenarios](JobArguments const& call) { return call.n_scenarios == n_scenarios; }));
+                CHECK(n_calls == n_scenarios);
+                CHECK(all_claimed_once());
+            }
+        }
+
+        SUBCASE("Thread pool") {
+            Idx const n_scenarios = 10; // arbitrary non-zero value
+            JobThreadPool thread_pool{3};
+            claim_counts = std::vector<std::atomic<Idx>>(n_scenarios);
+
+            SUBCASE("Limited by the number of workers") {
+                JobDispatch::job_dispatch(single_job, n_scenarios, 0, &thread_pool);
+                CHECK(n_calls == 3);
+            }
+            SUBCASE("Limited by the threading") {
+                JobDispatch::job_dispatch(single_job, n_scenarios, 2, &thread_pool);
+                CHECK(n_calls == 2);
+            }
+            SUBCASE("Sequential") {
+                JobDispatch::job_dispatch(single_job, n_scenarios, main_core::utils::sequential, &thread_pool);
+                CHECK(n_calls == 1);
+            }
+            SUBCASE("Static round-robin") {
+                JobDispatch::job_dispatch(single_job, n_scenarios, 0, &thread_pool,
+                                          JobDispatch::BatchScheduling::static_round_robin);
+                CHECK(n_calls == 3);
             }
+            CHECK(all_claimed_once());
         }
     }
     SUBCASE("Test n_threads") {
@@ -303,6 +452,12 @@ TEST_CASE("Test job dispatch logic") {
                 CHECK(JobDispatch::n_threads(n_scenarios, 0) == n_scenarios);
             }
         }
+        SUBCASE("Available threads") {
+            CHECK(JobDispatch::n_threads(n_scenarios, 0, 1) == 1);
+            CHECK(JobDispatch::n_threads(n_scenarios, 0, 4) == 4);
+            CHECK(JobDispatch::n_threads(n_scenarios, 0, n_scenarios + 1) == n_scenarios);
+            CHECK(JobDispatch::n_threads(n_scenarios, 3, 1) == 3);
+        }
     }
     SUBCASE("Test call_with") {
         // These call counters are local as are unrelated to the adapter mock
@@ -432,4 +587,63 @@ TEST_CASE("Test job dispatch logic") {
         }
     }
 }
+TEST_CASE("Test job worker pool") {
+    SUBCASE("JobThreadPool") {
+        JobThreadPool thread_pool{4};
+        CHECK(thread_pool.n_workers() == 4);
+
+        SUBCASE("Runs the job on the requested number of workers") {
+            for (Idx const n_workers : {1, 2, 4}) {
+                std::atomic<Idx> n_calls{0};
+                thread_pool.run(n_workers, [&n_calls] { ++n_calls; });
+                CHECK(n_calls == n_workers);
+            }
+        }
+        SUBCASE("Workers are kept between jobs") {
+            std::atomic<Idx> n_calls{0};
+            for (Idx job = 0; job != 100; ++job) {
+                thread_pool.run(thread_pool.n_workers(), [&n_calls] { ++n_calls; });
+            }
+            CHECK(n_calls == 100 * thread_pool.n_workers());
+        }
+        SUBCASE("Rethrows the exception of a worker") {
+            std::atomic<Idx> n_calls{0};
+            CHECK_THROWS_AS(thread_pool.run(3,
+                                            [&n_calls] {
+                                                if (++n_calls == 2) {
+                                                    throw SomeTestException{"Worker error"};
+                                                }
+                                            }),
+                            SomeTestException);
+            CHECK(n_calls == 3);
+
+            // the workers are still available
+            thread_pool.run(2, [&n_calls] { ++n_calls; });
+            CHECK(n_calls == 5);
+        }
+    }
+
+    SUBCASE("ModelReplicas") {
+        struct MockModel {
+            Idx value;
+        };
+        ModelReplicas<MockModel> replicas;
+        MockModel const base_model{1};
+
+        auto replica = replicas.take(base_model);
+        REQUIRE(replica != nullptr);
+        CHECK(replica->value == 1);
+        auto const* const replica_address = replica.get();
+
+        replica->value = 2;
+        replicas.give_back(std::move(replica));
+        auto reused_replica = replicas.take(base_model);
+        CHECK(reused_replica.get() == replica_address);
+
+        replicas.give_back(std::move(reused_replica));
+        replicas.clear();
+        CHECK(replicas.take(base_model)->value == 1);
+    }
+}
+
 } // namespace power_grid_model
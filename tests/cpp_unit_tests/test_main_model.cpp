@@ -0,0 +1,458 @@
+// SPDX-FileCopyrightText: Contributors to the Power Grid Model project <powergridmodel@lfenergy.org>
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include <power_grid_model/auxiliary/dataset.hpp>
+#include <power_grid_model/auxiliary/input.hpp>
+#include <power_grid_model/auxiliary/meta_data_gen.hpp>
+#include <power_grid_model/auxiliary/output.hpp>
+#include <power_grid_model/calculation_parameters.hpp>
+#include <power_grid_model/common/common.hpp>
+#include <power_grid_model/common/exception.hpp>
+#include <power_grid_model/common/logging.hpp>
+#include <power_grid_model/common/multi_threaded_logging.hpp>
+#include <power_grid_model/main_model.hpp>
+#include <power_grid_model/main_model_fwd.hpp>
+#include <power_grid_model/math_solver/math_solver.hpp>
+#include <power_grid_model/math_solver/math_solver_dispatch.hpp>
+
+#include <doctest/doctest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <format>
+#include <memory>
+#include <numeric>
+#include <string_view>
+#include <vector>
+
+namespace power_grid_model {
+namespace {
+
+// one node with one source, the node voltage is the reference voltage of the source
+struct SingleNodeInput {
+    std::vector<ID> node_id{1};
+    std::vector<double> node_u_rated;
+    std::vector<ID> source_id{2};
+    std::vector<ID> source_node{1};
+    std::vector<IntS> source_status{1};
+    std::vector<double> source_u_ref{1.0};
+
+    ConstDataset dataset() const {
+        ConstDataset input_dataset{false, 1, "input", meta_data::meta_data_gen::meta_data};
+        input_dataset.add_buffer("node", 1, 1, nullptr, nullptr);
+        input_dataset.add_attribute_buffer("node", "id", node_id.data());
+        input_dataset.add_attribute_buffer("node", "u_rated", node_u_rated.data());
+        input_dataset.add_buffer("source", 1, 1, nullptr, nullptr);
+        input_dataset.add_attribute_buffer("source", "id", source_id.data());
+        input_dataset.add_attribute_buffer("source", "node", source_node.data());
+        input_dataset.add_attribute_buffer("source", "status", source_status.data());
+        input_dataset.add_attribute_buffer("source", "u_ref", source_u_ref.data());
+        return input_dataset;
+    }
+};
+// records the events in the order in which they are logged
+class EventRecorder : public Logger {
+  public:
+    void log(LogEvent tag) override { events_.push_back(tag); }
+    void log(LogEvent tag, std::string_view /*message*/) override { events_.push_back(tag); }
+    void log(LogEvent tag, double /*value*/) override { events_.push_back(tag); }
+    void log(LogEvent tag, Idx /*value*/) override { events_.push_back(tag); }
+
+    std::vector<LogEvent> const& events() const { return events_; }
+    void merge_into(EventRecorder& destination) const {
+        destination.events_.insert(destination.events_.end(), events_.begin(), events_.end());
+    }
+
+  private:
+    std::vector<LogEvent> events_;
+};
+
+// forwards to the math solver and records the flows that are requested from the power flow
+template <symmetry_tag sym> class OutputRequestRecorder final : public math_solver::MathSolverBase<sym> {
+  public:
+    explicit OutputRequestRecorder(std::shared_ptr<MathModelTopology const> const& topo_ptr) : solver_{topo_ptr} {}
+
+    static std::vector<SolverOutputRequest>& power_flow_requests() {
+        static std::vector<SolverOutputRequest> requests;
+        return requests;
+    }
+
+    OutputRequestRecorder* clone() const final { return new OutputRequestRecorder{*this}; } // NOSONAR(S5025)
+
+    SolverOutput<sym> run_power_flow(PowerFlowInput<sym> const& input, double err_tol, Idx max_iter, bool cache_run,
+                                     Logger& log, CalculationMethod calculation_method, YBus<sym> const& y_bus,
+                                     PowerFlowInitialization initialization,
+                                     SolverOutputRequest const& output_request) final {
+        power_flow_requests().push_back(output_request);
+        return solver_.run_power_flow(input, err_tol, max_iter, cache_run, log, calculation_method, y_bus,
+                                      initialization, output_request);
+    }
+    SolverOutput<sym> run_state_estimation(StateEstimationInput<sym> const& input, double err_tol, Idx max_iter,
+                                           Logger& log, CalculationMethod calculation_method, YBus<sym> const& y_bus,
+                                           SolverOutputRequest const& output_request) final {
+        return solver_.run_state_estimation(input, err_tol, max_iter, log, calculation_method, y_bus, output_request);
+    }
+    void check_observability(StateEstimationInput<sym> const& input, Logger& log, YBus<sym> const& y_bus) final {
+        solver_.check_observability(input, log, y_bus);
+    }
+    ShortCircuitSolverOutput<sym> run_short_circuit(ShortCircuitInput const& input, Logger& log,
+                                                    CalculationMethod calculation_method, YBus<sym> const& y_bus,
+                                                    SolverOutputRequest const& output_request) final {
+        return solver_.run_short_circuit(input, log, calculation_method, y_bus, output_request);
+    }
+    ShortCircuitSolverOutput<sym> prepare_short_circuit_sweep(ShortCircuitInput const& input, Logger& log,
+                                                              CalculationMethod calculation_method,
+                                                              YBus<sym> const& y_bus,
+                                                              SolverOutputRequest const& output_request) final {
+        return solver_.prepare_short_circuit_sweep(input, log, calculation_method, y_bus, output_request);
+    }
+    void run_short_circuit_sweep(ShortCircuitInput const& input, YBus<sym> const& y_bus,
+                                 SolverOutputRequest const& output_request,
+                                 math_solver::ShortCircuitSweepOutputFn<sym> const& fault_output_fn) final {
+        solver_.run_short_circuit_sweep(input, y_bus, output_request, fault_output_fn);
+    }
+    void clear_solver() final { solver_.clear_solver(); }
+
+  private:
+    MathSolver<sym> solver_;
+};
+} // namespace
+
+TEST_CASE("Test main model - worker pool") {
+    constexpr Idx n_scenarios = 4;
+
+    SingleNodeInput const input_100{.node_u_rated = {100.0}};
+    SingleNodeInput const input_200{.node_u_rated = {200.0}};
+
+    std::vector<ID> const update_source_id(n_scenarios, 2);
+    std::vector<double> const update_source_u_ref{0.9, 1.0, 1.1, 1.2};
+    ConstDataset update_dataset{true, n_scenarios, "update", meta_data::meta_data_gen::meta_data};
+    update_dataset.add_buffer("source", 1, n_scenarios, nullptr, nullptr);
+    update_dataset.add_attribute_buffer("source", "id", update_source_id.data());
+    update_dataset.add_attribute_buffer("source", "u_ref", update_source_u_ref.data());
+
+    std::vector<double> node_u(n_scenarios);
+    MutableDataset result_dataset{true, n_scenarios, "sym_output", meta_data::meta_data_gen::meta_data};
+    result_dataset.add_buffer("node", 1, n_scenarios, nullptr, nullptr);
+    result_dataset.add_attribute_buffer("node", "u", node_u.data());
+
+    MathSolverDispatcher const math_solver_dispatcher{math_solver::math_solver_tag<MathSolver>{}};
+    MainModel model{50.0, input_100.dataset(), math_solver_dispatcher};
+    MainModel const other_model{50.0, input_200.dataset(), math_solver_dispatcher};
+    model.set_worker_pool(2);
+
+    MainModelOptions options{};
+    options.threading = 2;
+
+    auto const check_node_u = [&](double u_rated) {
+        node_u.assign(n_scenarios, nan);
+        model.calculate(options, result_dataset, update_dataset);
+        for (Idx scenario = 0; scenario != n_scenarios; ++scenario) {
+            CAPTURE(scenario);
+            CHECK(node_u[scenario] == doctest::Approx(update_source_u_ref[scenario] * u_rated));
+        }
+    };
+
+    // the second batch reuses the copies of the model kept in the worker pool
+    check_node_u(100.0);
+    check_node_u(100.0);
+
+    SUBCASE("Copy assignment discards the copies of the previous model") {
+        model = other_model;
+        check_node_u(200.0);
+    }
+}
+
+TEST_CASE("Test main model - subgrids in parallel") {
+    // two electrically isolated subgrids, each with a node and a source
+    std::vector<NodeInput> const node_input{{.id = 1, .u_rated = 10.0e3}, {.id = 2, .u_rated = 20.0e3}};
+    std::vector<SourceInput> const source_input{{.id = 3, .node = 1, .status = 1, .u_ref = 1.05},
+                                                {.id = 4, .node = 2, .status = 1, .u_ref = 0.95}};
+    ConstDataset input_dataset{false, 1, "input", meta_data::meta_data_gen::meta_data};
+    input_dataset.add_buffer("node", 2, 2, nullptr, node_input.data());
+    input_dataset.add_buffer("source", 2, 2, nullptr, source_input.data());
+
+    std::vector<SymNodeOutput> node_output(node_input.size());
+    MutableDataset result_dataset{false, 1, "sym_output", meta_data::meta_data_gen::meta_data};
+    result_dataset.add_buffer("node", 2, 2, nullptr, node_output.data());
+    ConstDataset const no_update_dataset{false, 1, "update", meta_data::meta_data_gen::meta_data};
+
+    common::logging::MultiThreadedLoggerImpl<EventRecorder> recorder;
+    MathSolverDispatcher const math_solver_dispatcher{math_solver::math_solver_tag<MathSolver>{}};
+    MainModel model{50.0, input_dataset, math_solver_dispatcher, 0, recorder};
+    model.calculate(MainModelOptions{.threading = 2}, result_dataset, no_update_dataset);
+
+    CHECK(node_output[0].u == doctest::Approx(10.5e3));
+    CHECK(node_output[1].u == doctest::Approx(19.0e3));
+
+    // each thread logs into its own child logger, so the events of a subgrid are kept in the order of logging
+    auto const& events = recorder.get().events();
+    CHECK(std::ranges::count(events, LogEvent::math_solver) == 2);
+    for (auto it = std::ranges::find(events, LogEvent::math_solver); it != events.end();
+         it = std::ranges::find(it + 1, events.end(), LogEvent::math_solver)) {
+        REQUIRE(it != events.begin());
+        CHECK(*(it - 1) == LogEvent::calculate_math_result);
+    }
+}
+
+TEST_CASE("Test main model - columnar cached update") {
+    // the same source is updated many times within the first scenario, the last update is effective
+    // the second scenario does not change the source, so the model should be restored to the input
+    constexpr Idx n_first_scenario = 3000;
+    std::vector<Idx> const indptr{0, n_first_scenario, n_first_scenario + 1};
+    std::vector<ID> const update_source_id(n_first_scenario + 1, 2);
+    std::vector<double> update_source_u_ref(n_first_scenario + 1, nan);
+    for (Idx idx = 0; idx != n_first_scenario; ++idx) {
+        update_source_u_ref[idx] = 0.8 + 0.4 * static_cast<double>(idx) / static_cast<double>(n_first_scenario - 1);
+    }
+    ConstDataset update_dataset{true, 2, "update", meta_data::meta_data_gen::meta_data};
+    update_dataset.add_buffer("source", -1, n_first_scenario + 1, indptr.data(), nullptr);
+    update_dataset.add_attribute_buffer("source", "id", update_source_id.data());
+    update_dataset.add_attribute_buffer("source", "u_ref", update_source_u_ref.data());
+
+    std::vector<double> node_u(2, nan);
+    MutableDataset result_dataset{true, 2, "sym_output", meta_data::meta_data_gen::meta_data};
+    result_dataset.add_buffer("node", 1, 2, nullptr, nullptr);
+    result_dataset.add_attribute_buffer("node", "u", node_u.data());
+
+    SingleNodeInput const input{.node_u_rated = {100.0}};
+    MathSolverDispatcher const math_solver_dispatcher{math_solver::math_solver_tag<MathSolver>{}};
+    MainModel model{50.0, input.dataset(), math_solver_dispatcher};
+
+    // the inverse of all updates of the first scenario is stored before any of them is applied
+    model.calculate(MainModelOptions{}, result_dataset, update_dataset);
+    CHECK(node_u[0] == doctest::Approx(120.0));
+    CHECK(node_u[1] == doctest::Approx(100.0));
+}
+
+TEST_CASE("Test main model - construction errors in one stage") {
+    // the loads and the line are constructed in the same stage, both refer to a node that is not constructed yet
+    // the error of the type that comes first in the type order is reported, also when constructed concurrently
+    auto const check_construction_error = [](Idx n_loads, Idx threading, ID line_from_node_id) {
+        std::vector<ID> const node_id{1};
+        std::vector<double> const node_u_rated{10.0e3};
+        std::vector<ID> const line_id{2};
+        std::vector<ID> const line_from_node{line_from_node_id};
+        std::vector<ID> const line_to_node{1};
+        std::vector<ID> load_id(n_loads);
+        std::iota(load_id.begin(), load_id.end(), ID{3});
+        std::vector<ID> load_node(n_loads, 1);
+        load_node.back() = 99;
+        std::vector<IntS> const load_status(n_loads, 1);
+        std::vector<IntS> const load_type(n_loads, IntS{0});
+
+        ConstDataset input_dataset{false, 1, "input", meta_data::meta_data_gen::meta_data};
+        input_dataset.add_buffer("node", 1, 1, nullptr, nullptr);
+        input_dataset.add_attribute_buffer("node", "id", node_id.data());
+        input_dataset.add_attribute_buffer("node", "u_rated", node_u_rated.data());
+        input_dataset.add_buffer("line", 1, 1, nullptr, nullptr);
+        input_dataset.add_attribute_buffer("line", "id", line_id.data());
+        input_dataset.add_attribute_buffer("line", "from_node", line_from_node.data());
+        input_dataset.add_attribute_buffer("line", "to_node", line_to_node.data());
+        input_dataset.add_buffer("sym_load", n_loads, n_loads, nullptr, nullptr);
+        input_dataset.add_attribute_buffer("sym_load", "id", load_id.data());
+        input_dataset.add_attribute_buffer("sym_load", "node", load_node.data());
+        input_dataset.add_attribute_buffer("sym_load", "status", load_status.data());
+        input_dataset.add_attribute_buffer("sym_load", "type", load_type.data());
+
+        MathSolverDispatcher const math_solver_dispatcher{math_solver::math_solver_tag<MathSolver>{}};
+        common::logging::NoMultiThreadedLogger no_logger;
+        CHECK_THROWS_WITH_AS(MainModel(50.0, input_dataset, math_solver_dispatcher, 0, no_logger, threading),
+                             std::format("The id cannot be found: {}\n", line_from_node_id), IDNotFound);
+    };
+
+    // above the number of components of a stage from which the component types are constructed concurrently
+    constexpr Idx n_concurrent_loads = 20000;
+
+    SUBCASE("Node does not exist") {
+        check_construction_error(10, MainModel::Options::sequential, 98);
+        check_construction_error(n_concurrent_loads, MainModel::Options::sequential, 98);
+        check_construction_error(n_concurrent_loads, 2, 98);
+    }
+    SUBCASE("Node refers to a component of a later type") {
+        // the ids of the loads are registered in advance, but the loads are not constructed before the line
+        check_construction_error(10, MainModel::Options::sequential, 3);
+        check_construction_error(n_concurrent_loads, 2, 3);
+    }
+}
+
+TEST_CASE("Test main model - requested output") {
+    // source - node 1 - line 11 - node 2 with a load and a shunt
+    // node 1 - three winding transformer 14 - nodes 3 and 4, with a load at node 4
+    // the power sensors measure the line and the shunt
+    std::vector<NodeInput> const node_input{{.id = 1, .u_rated = 10.5e3},
+                                            {.id = 2, .u_rated = 10.5e3},
+                                            {.id = 3, .u_rated = 10.5e3},
+                                            {.id = 4, .u_rated = 10.5e3}};
+    std::vector<SourceInput> const source_input{{.id = 10, .node = 1, .status = 1, .u_ref = 1.05}};
+    std::vector<LineInput> const line_input{{.id = 11,
+                                             .from_node = 1,
+                                             .to_node = 2,
+                                             .from_status = 1,
+                                             .to_status = 1,
+                                             .r1 = 0.5,
+                                             .x1 = 0.4,
+                                             .c1 = 1e-6,
+                                             .tan1 = 0.0,
+                                             .i_n = 500.0}};
+    std::vector<SymLoadGenInput> const sym_load_input{
+        {.id = 12, .node = 2, .status = 1, .type = LoadGenType::const_pq, .p_specified = 1e6, .q_specified = 2e5},
+        {.id = 15, .node = 4, .status = 1, .type = LoadGenType::const_pq, .p_specified = 5e5, .q_specified = 1e5}};
+    std::vector<ShuntInput> const shunt_input{{.id = 13, .node = 2, .status = 1, .g1 = 1e-3, .b1 = 2e-3}};
+    std::vector<ThreeWindingTransformerInput> const three_winding_transformer_input{
+        {.id = 14,
+         .node_1 = 1,
+         .node_2 = 3,
+         .node_3 = 4,
+         .status_1 = 1,
+         .status_2 = 1,
+         .status_3 = 1,
+         .u1 = 10.5e3,
+         .u2 = 10.5e3,
+         .u3 = 10.5e3,
+         .sn_1 = 2e6,
+         .sn_2 = 1e6,
+         .sn_3 = 1e6,
+         .uk_12 = 0.09,
+         .uk_13 = 0.06,
+         .uk_23 = 0.03,
+         .pk_12 = 2e4,
+         .pk_13 = 1.5e4,
+         .pk_23 = 1e4,
+         .i0 = 0.01,
+         .p0 = 1e3,
+         .winding_1 = WindingType::wye_n,
+         .winding_2 = WindingType::wye_n,
+         .winding_3 = WindingType::wye_n,
+         .clock_12 = 0,
+         .clock_13 = 0,
+         .tap_side = Branch3Side::side_1,
+         .tap_pos = 0,
+         .tap_min = -2,
+         .tap_max = 2,
+         .tap_nom = 0,
+         .tap_size = 100.0}};
+    std::vector<SymPowerSensorInput> const sym_power_sensor_input{
+        {.id = 16,
+         .measured_object = 11,
+         .measured_terminal_type = MeasuredTerminalType::branch_from,
+         .power_sigma = 1e3,
+         .p_measured = 1.1e6,
+         .q_measured = 3e5},
+        {.id = 17,
+         .measured_object = 13,
+         .measured_terminal_type = MeasuredTerminalType::shunt,
+         .power_sigma = 1e3,
+         .p_measured = 1e5,
+         .q_measured = -2e5}};
+
+    ConstDataset input_dataset{false, 1, "input", meta_data::meta_data_gen::meta_data};
+    auto const add_input = [&input_dataset](std::string_view component, auto const& input) {
+        auto const size = std::ssize(input);
+        input_dataset.add_buffer(component, size, size, nullptr, input.data());
+    };
+    add_input("node", node_input);
+    add_input("source", source_input);
+    add_input("line", line_input);
+    add_input("sym_load", sym_load_input);
+    add_input("shunt", shunt_input);
+    add_input("three_winding_transformer", three_winding_transformer_input);
+    add_input("sym_power_sensor", sym_power_sensor_input);
+
+    MathSolverDispatcher const math_solver_dispatcher{math_solver::math_solver_tag<OutputRequestRecorder>{}};
+    MainModel model{50.0, input_dataset, math_solver_dispatcher};
+    auto& requests = OutputRequestRecorder<symmetric_t>::power_flow_requests();
+
+    std::vector<SymNodeOutput> node_output(node_input.size());
+    std::vector<SymApplianceOutput> shunt_output(shunt_input.size());
+    std::vector<SymBranch3Output> three_winding_transformer_output(three_winding_transformer_input.size());
+    std::vector<SymPowerSensorOutput> sym_power_sensor_output(sym_power_sensor_input.size());
+    ConstDataset const no_update_dataset{false, 1, "update", meta_data::meta_data_gen::meta_data};
+    auto const calculate = [&model, &requests, &no_update_dataset](MutableDataset const& result_dataset) {
+        requests.clear();
+        model.calculate(MainModelOptions{}, result_dataset, no_update_dataset);
+        REQUIRE(requests.size() == 1);
+        return requests.front();
+    };
+    // the output of one component type, together with the node output
+    auto const calculate_with_node_output = [&calculate, &node_input](std::string_view component, auto& output) {
+        std::vector<SymNodeOutput> other_node_output(node_input.size());
+        MutableDataset result_dataset{false, 1, "sym_output", meta_data::meta_data_gen::meta_data};
+        result_dataset.add_buffer("node", std::ssize(other_node_output), std::ssize(other_node_output), nullptr,
+                                  other_node_output.data());
+        result_dataset.add_buffer(component, std::ssize(output), std::ssize(output), nullptr, output.data());
+        return calculate(result_dataset);
+    };
+
+    // reference with the output of all components
+    std::vector<SymBranchOutput> line_output(line_input.size());
+    std::vector<SymApplianceOutput> sym_load_output(sym_load_input.size());
+    MutableDataset reference_dataset{false, 1, "sym_output", meta_data::meta_data_gen::meta_data};
+    reference_dataset.add_buffer("node", 4, 4, nullptr, node_output.data());
+    reference_dataset.add_buffer("line", 1, 1, nullptr, line_output.data());
+    reference_dataset.add_buffer("sym_load", 2, 2, nullptr, sym_load_output.data());
+    reference_dataset.add_buffer("shunt", 1, 1, nullptr, shunt_output.data());
+    reference_dataset.add_buffer("three_winding_transformer", 1, 1, nullptr, three_winding_transformer_output.data());
+    reference_dataset.add_buffer("sym_power_sensor", 2, 2, nullptr, sym_power_sensor_output.data());
+    auto const reference_request = calculate(reference_dataset);
+    CHECK(reference_request.branch_flow);
+    CHECK(reference_request.shunt_flow);
+    auto const reference_node_output = node_output;
+    auto const reference_shunt_output = shunt_output;
+    auto const reference_three_winding_transformer_output = three_winding_transformer_output;
+    auto const reference_sym_power_sensor_output = sym_power_sensor_output;
+    REQUIRE(std::isfinite(reference_shunt_output[0].p));
+    REQUIRE(std::isfinite(reference_three_winding_transformer_output[0].p_1));
+
+    SUBCASE("Node output only") {
+        node_output.assign(node_input.size(), SymNodeOutput{});
+        MutableDataset result_dataset{false, 1, "sym_output", meta_data::meta_data_gen::meta_data};
+        result_dataset.add_buffer("node", 4, 4, nullptr, node_output.data());
+        auto const request = calculate(result_dataset);
+        CHECK_FALSE(request.branch_flow);
+        CHECK_FALSE(request.shunt_flow);
+        for (size_t idx = 0; idx != node_output.size(); ++idx) {
+            CHECK(node_output[idx].u == doctest::Approx(reference_node_output[idx].u));
+            CHECK(node_output[idx].u_angle == doctest::Approx(reference_node_output[idx].u_angle));
+        }
+    }
+
+    SUBCASE("Power sensor output") {
+        sym_power_sensor_output.assign(sym_power_sensor_input.size(), SymPowerSensorOutput{});
+        auto const request = calculate_with_node_output("sym_power_sensor", sym_power_sensor_output);
+        CHECK(request.branch_flow);
+        CHECK(request.shunt_flow);
+        for (size_t idx = 0; idx != sym_power_sensor_output.size(); ++idx) {
+            CHECK(sym_power_sensor_output[idx].p_residual ==
+                  doctest::Approx(reference_sym_power_sensor_output[idx].p_residual));
+            CHECK(sym_power_sensor_output[idx].q_residual ==
+                  doctest::Approx(reference_sym_power_sensor_output[idx].q_residual));
+        }
+    }
+
+    SUBCASE("Three winding transformer output") {
+        three_winding_transformer_output.assign(three_winding_transformer_input.size(), SymBranch3Output{});
+        auto const request = calculate_with_node_output("three_winding_transformer", three_winding_transformer_output);
+        CHECK(request.branch_flow);
+        CHECK_FALSE(request.shunt_flow);
+        auto const& output = three_winding_transformer_output[0];
+        auto const& reference = reference_three_winding_transformer_output[0];
+        CHECK(output.p_1 == doctest::Approx(reference.p_1));
+        CHECK(output.q_2 == doctest::Approx(reference.q_2));
+        CHECK(output.i_3 == doctest::Approx(reference.i_3));
+        CHECK(output.loading == doctest::Approx(reference.loading));
+    }
+
+    SUBCASE("Shunt output") {
+        shunt_output.assign(shunt_input.size(), SymApplianceOutput{});
+        auto const request = calculate_with_node_output("shunt", shunt_output);
+        CHECK_FALSE(request.branch_flow);
+        CHECK(request.shunt_flow);
+        CHECK(shunt_output[0].p == doctest::Approx(reference_shunt_output[0].p));
+        CHECK(shunt_output[0].q == doctest::Approx(reference_shunt_output[0].q));
+        CHECK(shunt_output[0].i == doctest::Approx(reference_shunt_output[0].i));
+    }
+}
+
+} // namespace power_grid_model
@@ -5,17 +5,56 @@
 #include <power_grid_model/sparse_ordering.hpp>
 
 #include <power_grid_model/common/common.hpp>
+#include <power_grid_model/common/enum.hpp>
 
 #include <doctest/doctest.h>
 
+#include <algorithm>
 #include <chrono>
 #include <iostream>
 #include <map>
+#include <numeric>
+#include <set>
 #include <utility>
 #include <vector>
 
 namespace {
 using power_grid_model::Idx;
+
+// fill-ins of the explicit elimination of the graph in the given order, as (smallest, largest) pairs
+std::set<std::pair<Idx, Idx>> eliminate(std::map<Idx, std::vector<Idx>> const& graph, std::vector<Idx> const& alpha) {
+    std::map<Idx, std::set<Idx>> adjacency;
+    for (auto const& [k, adjacent] : graph) {
+        adjacency[k];
+        for (Idx const e : adjacent) {
+            adjacency[k].insert(e);
+            adjacency[e].insert(k);
+        }
+    }
+    std::set<std::pair<Idx, Idx>> fills;
+    for (Idx const u : alpha) {
+        auto const neighbours = adjacency[u];
+        for (Idx const v : neighbours) {
+            adjacency[v].erase(u);
+            for (Idx const w : neighbours) {
+                if (v < w && adjacency[v].insert(w).second) {
+                    adjacency[w].insert(v);
+                    fills.emplace(v, w);
+                }
+            }
+        }
+        adjacency.erase(u);
+    }
+    return fills;
+}
+
+std::set<std::pair<Idx, Idx>> normalize(std::vector<std::pair<Idx, Idx>> const& fills) {
+    std::set<std::pair<Idx, Idx>> result;
+    for (auto const& [from, to] : fills) {
+        result.emplace(std::min(from, to), std::max(from, to));
+    }
+    return result;
+}
 } // namespace
 
 TEST_CASE("Test sparse ordering") {
@@ -33,4 +72,40 @@ TEST_CASE("Test sparse ordering") {
         CHECK(alpha == std::vector<Idx>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
         CHECK(fills == std::vector<std::pair<Idx, Idx>>{{3, 5}, {4, 5}, {5, 8}, {5, 6}, {5, 7}});
     }
+
+    SUBCASE("approximate_minimum_degree_ordering") {
+        std::map<Idx, std::vector<Idx>> const graph{{0, {3, 5}}, {1, {4, 5, 8}}, {2, {4, 5, 6}}, {3, {6, 7}},
+                                                    {4, {6, 8}}, {6, {7, 8, 9}}, {7, {8, 9}},    {8, {9}}};
+
+        auto const [alpha, fills] = power_grid_model::approximate_minimum_degree_ordering(graph);
+
+        CHECK(alpha == std::vector<Idx>{0, 5, 9, 7, 3, 1, 2, 6, 8, 4});
+        CHECK(fills == std::vector<std::pair<Idx, Idx>>{{5, 3}, {3, 1}, {3, 2}, {3, 8}, {1, 6}, {1, 2}, {2, 8}});
+        CHECK(normalize(fills) == eliminate(graph, alpha));
+    }
+
+    SUBCASE("approximate_minimum_degree_ordering on a meshed grid") {
+        constexpr Idx n_side = 6;
+        std::map<Idx, std::vector<Idx>> graph;
+        for (Idx row = 0; row < n_side; ++row) {
+            for (Idx col = 0; col < n_side; ++col) {
+                Idx const node = row * n_side + col;
+                if (row + 1 < n_side) {
+                    graph[node].push_back(node + n_side);
+                }
+                if (col + 1 < n_side) {
+                    graph[node].push_back(node + 1);
+                }
+            }
+        }
+
+        auto const [alpha, fills] = power_grid_model::sparse_ordering(
+            graph, power_grid_model::SparseOrderingMethod::approximate_minimum_degree);
+
+        std::vector<Idx> all_nodes(n_side * n_side);
+        std::iota(all_nodes.begin(), all_nodes.end(), Idx{0});
+        CHECK(std::ranges::is_permutation(alpha, all_nodes));
+        CHECK(normalize(fills).size() == fills.size());
+        CHECK(normalize(fills) == eliminate(graph, alpha));
+    }
 }
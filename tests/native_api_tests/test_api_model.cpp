@@ -6,10 +6,12 @@
 
 #include <power_grid_model_cpp/basics.hpp>
 #include <power_grid_model_cpp/buffer.hpp>
+#include <power_grid_model_cpp/calculation_info.hpp>
 #include <power_grid_model_cpp/dataset.hpp>
 #include <power_grid_model_cpp/handle.hpp>
 #include <power_grid_model_cpp/model.hpp>
 #include <power_grid_model_cpp/options.hpp>
+#include <power_grid_model_cpp/tracer.hpp>
 
 #include <power_grid_model_c/basics.h>
 #include <power_grid_model_c/dataset_definitions.h>
@@ -18,8 +20,14 @@
 
 #include <algorithm>
 #include <array>
+#include <cmath>
 #include <cstdint>
 #include <exception> // NOLINT(misc-include-cleaner)
+#include <filesystem>
+#include <fstream>
+#include <ios>
+#include <iterator>
+#include <limits>
 #include <map>
 #include <string>
 #include <string_view>
@@ -280,6 +288,69 @@ TEST_CASE("API Model") {
         }
     }
 
+    SUBCASE("Topology snapshot") {
+        std::vector<char> const snapshot = model.save_topology_snapshot();
+        REQUIRE(!snapshot.empty());
+        CHECK(model.get_topology_snapshot_size() == std::ssize(snapshot));
+
+        SUBCASE("Same grid") {
+            Model restored_model{50.0, input_dataset};
+            restored_model.load_topology_snapshot(snapshot);
+            restored_model.calculate(options, single_output_dataset);
+            node_output.get_value(PGM_def_sym_output_node_u, node_result_u.data(), -1);
+            node_output.get_value(PGM_def_sym_output_node_u_pu, node_result_u_pu.data(), -1);
+            CHECK(node_result_u[0] == doctest::Approx(50.0));
+            CHECK(node_result_u_pu[0] == doctest::Approx(0.5));
+        }
+
+        SUBCASE("Different grid") {
+            std::vector<ID> const other_node_id{1, 2};
+            std::vector<double> const other_node_u_rated{10.0e3, 10.0e3};
+            DatasetConst other_input_dataset{"input", false, 1};
+            other_input_dataset.add_buffer("node", std::ssize(other_node_id), std::ssize(other_node_id), nullptr,
+                                           nullptr);
+            other_input_dataset.add_attribute_buffer("node", "id", other_node_id.data());
+            other_input_dataset.add_attribute_buffer("node", "u_rated", other_node_u_rated.data());
+
+            Model other_model{50.0, other_input_dataset};
+            CHECK_THROWS_AS(other_model.load_topology_snapshot(snapshot), PowerGridSerializationError);
+        }
+
+        SUBCASE("Corrupted snapshot") {
+            std::vector<char> const truncated{snapshot.begin(), snapshot.end() - 1};
+            CHECK_THROWS_AS(model.load_topology_snapshot(truncated), PowerGridSerializationError);
+        }
+
+        SUBCASE("Different sparse ordering method") {
+            Model restored_model{50.0, input_dataset};
+            options.set_sparse_ordering(PGM_sparse_ordering_approximate_minimum_degree);
+            restored_model.calculate(options, single_output_dataset);
+            CHECK_THROWS_AS(restored_model.load_topology_snapshot(snapshot), PowerGridSerializationError);
+        }
+
+        SUBCASE("Buffer too small") {
+            std::vector<char> buffer(snapshot.size() - 1);
+            CHECK_THROWS_AS(model.save_topology_snapshot(buffer.data(), std::ssize(buffer)),
+                            PowerGridSerializationError);
+        }
+
+        SUBCASE("File") {
+            auto const snapshot_path =
+                std::filesystem::temp_directory_path() / "power_grid_model_native_api_test_topology_snapshot.bin";
+            model.save_topology_snapshot_to_file(snapshot_path.string());
+            std::ifstream snapshot_file{snapshot_path, std::ios::binary};
+            std::vector<char> const file_snapshot{std::istreambuf_iterator<char>{snapshot_file},
+                                                  std::istreambuf_iterator<char>{}};
+            snapshot_file.close();
+            std::filesystem::remove(snapshot_path);
+            CHECK(file_snapshot == snapshot);
+
+            CHECK_THROWS_AS(model.save_topology_snapshot_to_file(
+                                (snapshot_path / "non_existing_directory" / "snapshot.bin").string()),
+                            PowerGridSerializationError);
+        }
+    }
+
     SUBCASE("Test get indexer") {
         std::vector<ID> const node_id_2{1, 2, 3};
         std::vector<double> const node_u_rated_2{10.0e3, 10.0e3, 10.0e3};
@@ -343,6 +414,89 @@ TEST_CASE("API Model") {
         CHECK(batch_node_result_u_angle[3] == doctest::Approx(0.0));
     }
 
+    SUBCASE("Batch power flow with worker pool") {
+        auto check_batch_node_u = [&](double u_0, double u_1) {
+            node_batch_output.set_nan();
+            model.calculate(options, batch_output_dataset, batch_update_dataset);
+            node_batch_output.get_value(PGM_def_sym_output_node_u, batch_node_result_u.data(), -1);
+            CHECK(batch_node_result_u[0] == doctest::Approx(u_0));
+            CHECK(batch_node_result_u[1] == doctest::Approx(0.0));
+            CHECK(batch_node_result_u[2] == doctest::Approx(u_1));
+            CHECK(batch_node_result_u[3] == doctest::Approx(0.0));
+        };
+
+        for (Idx const threading : {-1, 0, 2}) {
+            CAPTURE(threading);
+            options.set_threading(threading);
+            model.set_worker_pool(2);
+
+            // the workers and the copies of the model are reused
+            check_batch_node_u(40.0, 70.0);
+            check_batch_node_u(40.0, 70.0);
+
+            // the copies of the model are discarded after an update
+            // u_ref = 0.5 p.u. is kept in the second scenario: u1 = 50.0 V - 30.0 V = 20.0 V
+            model.update(single_update_dataset);
+            check_batch_node_u(40.0, 20.0);
+
+            model.set_worker_pool(-1);
+            check_batch_node_u(40.0, 20.0);
+
+            model = Model{50.0, input_dataset};
+        }
+    }
+
+    SUBCASE("Batch power flow with calculation info") {
+        CalculationInfo info{};
+        model.set_calculation_info(&info);
+        options.set_threading(2);
+        model.calculate(options, batch_output_dataset, batch_update_dataset);
+
+        auto const entries = info.entries();
+        CHECK(std::ranges::any_of(entries, [](CalculationInfo::Entry const& entry) {
+            return CalculationInfo::event_name(entry.event) == "math_calculation" && entry.value > 0.0;
+        }));
+
+        auto const scenario_entries = info.scenario_entries();
+        REQUIRE_FALSE(scenario_entries.empty());
+        CHECK(scenario_entries.front().scenario == 0);
+        CHECK(scenario_entries.back().scenario == 1);
+        for (Idx const scenario : {0, 1}) {
+            CAPTURE(scenario);
+            CHECK(std::ranges::any_of(scenario_entries, [scenario](CalculationInfo::ScenarioEntry const& entry) {
+                return entry.scenario == scenario &&
+                       CalculationInfo::event_name(entry.event) == "total_single_calculation_in_thread";
+            }));
+        }
+
+        // no more information is collected after detaching
+        info.clear();
+        model.set_calculation_info(nullptr);
+        model.calculate(options, batch_output_dataset, batch_update_dataset);
+        CHECK(info.entries().empty());
+        CHECK(info.scenario_entries().empty());
+    }
+
+    SUBCASE("Batch power flow with tracer") {
+        Tracer tracer{};
+        model.set_tracer(&tracer);
+        options.set_threading(2);
+        model.calculate(options, batch_output_dataset, batch_update_dataset);
+        model.set_tracer(nullptr);
+
+        CHECK(tracer.n_events() > 0);
+        CHECK(tracer.n_dropped_events() == 0);
+        auto const trace_path = std::filesystem::temp_directory_path() / "power_grid_model_native_api_test_trace.json";
+        CHECK_NOTHROW(tracer.write_chrome_trace(trace_path.string()));
+        CHECK(std::filesystem::file_size(trace_path) > 0);
+        std::filesystem::remove(trace_path);
+        CHECK_THROWS_AS(tracer.write_chrome_trace((trace_path / "non_existing_directory" / "trace.json").string()),
+                        PowerGridSerializationError);
+
+        tracer.clear();
+        CHECK(tracer.n_events() == 0);
+    }
+
     SUBCASE("Input error handling") {
         SUBCASE("Construction error") {
             auto const bad_load_id_state_json = R"json({
@@ -463,6 +617,44 @@ TEST_CASE("API Model") {
             options.set_tap_changing_strategy(PGM_tap_changing_strategy_min_voltage_tap);
             CHECK_NOTHROW(model.calculate(options, single_output_dataset));
         }
+
+        SUBCASE("Invalid power flow initialization error") {
+            auto const bad_pf_initialization_lambda = [&options, &model, &single_output_dataset]() {
+                options.set_pf_initialization(-128);
+                model.calculate(options, single_output_dataset);
+            };
+            check_throws_with(bad_pf_initialization_lambda, PGM_regular_error,
+                              "get_pf_initialization is not implemented for"s);
+        }
+
+        SUBCASE("Power flow warm start") {
+            options.set_pf_initialization(PGM_pf_initialization_warm_start);
+            CHECK_NOTHROW(model.calculate(options, single_output_dataset));
+            CHECK_NOTHROW(model.calculate(options, single_output_dataset));
+        }
+
+        SUBCASE("Invalid sparse ordering error") {
+            auto const bad_sparse_ordering_lambda = [&options, &model, &single_output_dataset]() {
+                options.set_sparse_ordering(-128);
+                model.calculate(options, single_output_dataset);
+            };
+            check_throws_with(bad_sparse_ordering_lambda, PGM_regular_error,
+                              "get_sparse_ordering is not implemented for"s);
+        }
+
+        SUBCASE("Sparse ordering") {
+            // the topology is rebuilt when the ordering changes
+            for (Idx const sparse_ordering : {PGM_sparse_ordering_approximate_minimum_degree,
+                                              PGM_sparse_ordering_approximate_minimum_degree,
+                                              PGM_sparse_ordering_minimum_degree}) {
+                CAPTURE(sparse_ordering);
+                options.set_sparse_ordering(sparse_ordering);
+                node_output.set_nan();
+                model.calculate(options, single_output_dataset);
+                node_output.get_value(PGM_def_sym_output_node_u, node_result_u.data(), -1);
+                CHECK(node_result_u[0] == doctest::Approx(50.0));
+            }
+        }
     }
 
     SUBCASE("Calculation error") {
@@ -1080,4 +1272,322 @@ TEST_CASE("API Model") {
     }
 }
 
+TEST_CASE("API Model - batch tap changes with iterative current") {
+    using namespace std::string_literals;
+
+    // source_1 -- node_2 -- transformer_4 -- node_3 -- load_5
+    auto const owning_input_dataset = load_dataset(R"json({
+  "version": "1.0",
+  "type": "input",
+  "is_batch": false,
+  "attributes": {},
+  "data": {
+    "node": [
+      {"id": 2, "u_rated": 10000},
+      {"id": 3, "u_rated": 400}
+    ],
+    "source": [
+      {"id": 1, "node": 2, "status": 1, "u_ref": 1.0, "sk": 1e8, "rx_ratio": 0.1}
+    ],
+    "transformer": [
+      {"id": 4, "from_node": 2, "to_node": 3, "from_status": 1, "to_status": 1, "u1": 10000, "u2": 400,
+       "sn": 1e6, "uk": 0.1, "pk": 1e4, "i0": 0.01, "p0": 1e3, "winding_from": 1, "winding_to": 1, "clock": 0,
+       "tap_side": 0, "tap_pos": 0, "tap_min": -5, "tap_max": 5, "tap_nom": 0, "tap_size": 100}
+    ],
+    "sym_load": [
+      {"id": 5, "node": 3, "status": 1, "type": 0, "p_specified": 5e5, "q_specified": 1e5}
+    ]
+  }
+})json"s); // NOLINT(misc-include-cleaner) https://github.com/llvm/llvm-project/issues/98122
+
+    // every scenario changes the admittance of the grid through the tap position and the source impedance
+    auto const owning_update_dataset = load_dataset(R"json({
+  "version": "1.0",
+  "type": "update",
+  "is_batch": true,
+  "attributes": {},
+  "data": [
+    {"transformer": [{"id": 4, "tap_pos": -5}], "source": [{"id": 1, "sk": 1e8}]},
+    {"transformer": [{"id": 4, "tap_pos": 5}], "source": [{"id": 1, "sk": 1e8}]},
+    {"transformer": [{"id": 4, "tap_pos": -2}], "source": [{"id": 1, "sk": 1e7}]},
+    {"transformer": [{"id": 4, "tap_pos": 3}], "source": [{"id": 1, "sk": 1e7}]},
+    {"transformer": [{"id": 4, "tap_pos": 0}], "source": [{"id": 1, "sk": 1e8}]},
+    {"transformer": [{"id": 4, "tap_pos": 4}], "source": [{"id": 1, "sk": 1e7}]},
+    {"transformer": [{"id": 4, "tap_pos": -4}], "source": [{"id": 1, "sk": 1e8}]},
+    {"transformer": [{"id": 4, "tap_pos": 1}], "source": [{"id": 1, "sk": 1e7}]}
+  ]
+})json"s); // NOLINT(misc-include-cleaner) https://github.com/llvm/llvm-project/issues/98122
+    auto const& update_dataset = owning_update_dataset.dataset;
+    constexpr Idx n_scenarios = 8;
+    constexpr Idx n_nodes = 2;
+
+    Buffer node_batch_output{PGM_def_sym_output_node, n_scenarios * n_nodes};
+    DatasetMutable batch_output_dataset{"sym_output", true, n_scenarios};
+    batch_output_dataset.add_buffer("node", n_nodes, n_scenarios * n_nodes, nullptr, node_batch_output);
+
+    Model model{50.0, owning_input_dataset.dataset};
+    Options options{};
+    options.set_max_iter(100);
+
+    auto calculate_batch_node_u = [&] {
+        node_batch_output.set_nan();
+        model.calculate(options, batch_output_dataset, update_dataset);
+        std::vector<double> result(n_scenarios * n_nodes);
+        node_batch_output.get_value(PGM_def_sym_output_node_u_pu, result.data(), -1);
+        return result;
+    };
+
+    // reference: sequential newton-raphson, which factorizes the jacobian in every iteration
+    options.set_calculation_method(PGM_newton_raphson);
+    options.set_threading(-1);
+    auto const reference = calculate_batch_node_u();
+    CHECK(reference[1] != doctest::Approx(reference[3])); // the tap position has effect
+
+    // the prefactorized admittance matrix of the iterative current solver is copied into the threads,
+    // the change of the admittance in each scenario should still be detected
+    options.set_calculation_method(PGM_iterative_current);
+    for (Idx const n_workers : {0, 2}) {
+        CAPTURE(n_workers);
+        if (n_workers > 0) {
+            model.set_worker_pool(n_workers);
+        }
+        for (Idx const threading : {-1, 4}) {
+            CAPTURE(threading);
+            options.set_threading(threading);
+            for (Idx const repeat : {0, 1}) {
+                CAPTURE(repeat);
+                auto const result = calculate_batch_node_u();
+                for (Idx idx = 0; idx < n_scenarios * n_nodes; ++idx) {
+                    CAPTURE(idx);
+                    CHECK(result[idx] == doctest::Approx(reference[idx]));
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("API Model - short circuit sweep") {
+    using namespace std::string_literals;
+
+    // source_1 -- node_2 -- line_4 -- node_3
+    // node_2: fault_5 (three phase), fault_8 (inactive)
+    // node_3: fault_6 (single phase to ground), fault_7 (three phase, bolted)
+    auto const owning_input_dataset = load_dataset(R"json({
+  "version": "1.0",
+  "type": "input",
+  "is_batch": false,
+  "attributes": {},
+  "data": {
+    "node": [
+      {"id": 2, "u_rated": 10000},
+      {"id": 3, "u_rated": 10000}
+    ],
+    "source": [
+      {"id": 1, "node": 2, "status": 1, "u_ref": 1.0, "sk": 1e8, "rx_ratio": 0.1, "z01_ratio": 1.5}
+    ],
+    "line": [
+      {"id": 4, "from_node": 2, "to_node": 3, "from_status": 1, "to_status": 1, "r1": 0.5, "x1": 1.0, "c1": 1e-6,
+       "tan1": 0.0, "r0": 1.5, "x0": 3.0, "c0": 5e-7, "tan0": 0.0, "i_n": 1000}
+    ],
+    "fault": [
+      {"id": 5, "status": 1, "fault_type": 0, "fault_phase": 0, "fault_object": 2, "r_f": 0.1, "x_f": 0.1},
+      {"id": 6, "status": 1, "fault_type": 1, "fault_phase": 1, "fault_object": 3, "r_f": 0.5, "x_f": 0.0},
+      {"id": 7, "status": 1, "fault_type": 0, "fault_phase": 0, "fault_object": 3, "r_f": 0.0, "x_f": 0.0},
+      {"id": 8, "status": 0, "fault_type": 0, "fault_phase": 0, "fault_object": 2, "r_f": 0.0, "x_f": 0.0}
+    ]
+  }
+})json"s); // NOLINT(misc-include-cleaner) https://github.com/llvm/llvm-project/issues/98122
+
+    // reference: a batch in which only the fault of the scenario is active, the inactive fault is not swept
+    auto const owning_update_dataset = load_dataset(R"json({
+  "version": "1.0",
+  "type": "update",
+  "is_batch": true,
+  "attributes": {},
+  "data": [
+    {"fault": [{"id": 5, "status": 1}, {"id": 6, "status": 0}, {"id": 7, "status": 0}, {"id": 8, "status": 0}]},
+    {"fault": [{"id": 5, "status": 0}, {"id": 6, "status": 1}, {"id": 7, "status": 0}, {"id": 8, "status": 0}]},
+    {"fault": [{"id": 5, "status": 0}, {"id": 6, "status": 0}, {"id": 7, "status": 1}, {"id": 8, "status": 0}]},
+    {"fault": [{"id": 5, "status": 0}, {"id": 6, "status": 0}, {"id": 7, "status": 0}, {"id": 8, "status": 0}]}
+  ]
+})json"s); // NOLINT(misc-include-cleaner) https://github.com/llvm/llvm-project/issues/98122
+    constexpr Idx n_scenarios = 4;
+    constexpr Idx n_nodes = 2;
+    constexpr Idx n_faults = 4;
+    constexpr Idx n_phases = 3;
+
+    Buffer node_output{PGM_def_sc_output_node, n_scenarios * n_nodes};
+    Buffer line_output{PGM_def_sc_output_line, n_scenarios};
+    Buffer fault_output{PGM_def_sc_output_fault, n_scenarios * n_faults};
+    DatasetMutable output_dataset{"sc_output", true, n_scenarios};
+    output_dataset.add_buffer("node", n_nodes, n_scenarios * n_nodes, nullptr, node_output);
+    output_dataset.add_buffer("line", 1, n_scenarios, nullptr, line_output);
+    output_dataset.add_buffer("fault", n_faults, n_scenarios * n_faults, nullptr, fault_output);
+
+    Model model{50.0, owning_input_dataset.dataset};
+    Options options{};
+    options.set_calculation_type(PGM_short_circuit);
+    options.set_calculation_method(PGM_iec60909);
+
+    struct Result {
+        std::vector<double> node_u_pu = std::vector<double>(n_scenarios * n_nodes * n_phases);
+        std::vector<double> line_i_from = std::vector<double>(n_scenarios * n_phases);
+        std::vector<double> fault_i_f = std::vector<double>(n_scenarios * n_faults * n_phases);
+        std::vector<int8_t> fault_energized = std::vector<int8_t>(n_scenarios * n_faults);
+    };
+    auto const get_result = [&] {
+        Result result;
+        node_output.get_value(PGM_def_sc_output_node_u_pu, result.node_u_pu.data(), -1);
+        line_output.get_value(PGM_def_sc_output_line_i_from, result.line_i_from.data(), -1);
+        fault_output.get_value(PGM_def_sc_output_fault_i_f, result.fault_i_f.data(), -1);
+        fault_output.get_value(PGM_def_sc_output_fault_energized, result.fault_energized.data(), -1);
+        return result;
+    };
+    auto const check_close = [](std::vector<double> const& actual, std::vector<double> const& expected) {
+        REQUIRE(actual.size() == expected.size());
+        for (Idx idx = 0; idx < std::ssize(actual); ++idx) {
+            CAPTURE(idx);
+            CHECK(actual[idx] == doctest::Approx(expected[idx]));
+        }
+    };
+
+    model.calculate(options, output_dataset, owning_update_dataset.dataset);
+    auto const reference = get_result();
+    CHECK(reference.fault_i_f[0] > 0.0);                 // fault_5 in scenario 0
+    CHECK(reference.node_u_pu[n_phases] < 1.0);          // node_3 in scenario 0
+    CHECK(reference.fault_energized[n_faults + 1] == 1); // fault_6 in scenario 1
+    CHECK(reference.fault_energized[n_faults + 2] == 0); // fault_7 in scenario 1
+
+    for (Idx const threading : {-1, 0}) {
+        CAPTURE(threading);
+        options.set_threading(threading);
+        node_output.set_nan();
+        line_output.set_nan();
+        fault_output.set_nan();
+        model.calculate_short_circuit_sweep(options, output_dataset);
+        auto const result = get_result();
+        check_close(result.node_u_pu, reference.node_u_pu);
+        check_close(result.line_i_from, reference.line_i_from);
+        check_close(result.fault_i_f, reference.fault_i_f);
+        CHECK(result.fault_energized == reference.fault_energized);
+    }
+
+    SUBCASE("Wrong batch size") {
+        DatasetMutable wrong_output_dataset{"sc_output", true, n_scenarios - 1};
+        wrong_output_dataset.add_buffer("node", n_nodes, (n_scenarios - 1) * n_nodes, nullptr, node_output);
+        check_throws_with([&] { model.calculate_short_circuit_sweep(options, wrong_output_dataset); },
+                          PGM_regular_error,
+                          "Dataset error: The result data of a short circuit sweep should be a batch with one "
+                          "scenario per fault!"s);
+    }
+}
+
+TEST_CASE("API Model - observability check only") {
+    using namespace std::string_literals;
+
+    // source_4 -- node_1 -- line_3 -- node_2 -- load_5
+    // voltage sensor_6 at node_1, power sensor_7 at the from side of line_3
+    auto const owning_input_dataset = load_dataset(R"json({
+  "version": "1.0",
+  "type": "input",
+  "is_batch": false,
+  "attributes": {},
+  "data": {
+    "node": [
+      {"id": 1, "u_rated": 10000},
+      {"id": 2, "u_rated": 10000}
+    ],
+    "line": [
+      {"id": 3, "from_node": 1, "to_node": 2, "from_status": 1, "to_status": 1, "r1": 0.5, "x1": 1.0, "c1": 1e-6,
+       "tan1": 0.0, "i_n": 1000}
+    ],
+    "source": [
+      {"id": 4, "node": 1, "status": 1, "u_ref": 1.0}
+    ],
+    "sym_load": [
+      {"id": 5, "node": 2, "status": 1, "type": 0, "p_specified": 1e6, "q_specified": 1e5}
+    ],
+    "sym_voltage_sensor": [
+      {"id": 6, "measured_object": 1, "u_sigma": 1.0, "u_measured": 10000}
+    ],
+    "sym_power_sensor": [
+      {"id": 7, "measured_object": 3, "measured_terminal_type": 0, "power_sigma": 1000, "p_measured": 1e6,
+       "q_measured": 1e5}
+    ]
+  }
+})json"s); // NOLINT(misc-include-cleaner) https://github.com/llvm/llvm-project/issues/98122
+
+    // the power sensor with infinite sigma counts as not measured, so scenarios 1 and 3 are not observable
+    constexpr Idx n_scenarios = 4;
+    constexpr Idx n_nodes = 2;
+    std::vector<ID> const update_sensor_id(n_scenarios, 7);
+    std::vector<double> const update_power_sigma{1000.0, std::numeric_limits<double>::infinity(), 2000.0,
+                                                 std::numeric_limits<double>::infinity()};
+    Buffer update_sensor_buffer{PGM_def_update_sym_power_sensor, n_scenarios};
+    update_sensor_buffer.set_nan();
+    update_sensor_buffer.set_value(PGM_def_update_sym_power_sensor_id, update_sensor_id.data(), -1);
+    update_sensor_buffer.set_value(PGM_def_update_sym_power_sensor_power_sigma, update_power_sigma.data(), -1);
+    DatasetConst update_dataset{"update", true, n_scenarios};
+    update_dataset.add_buffer("sym_power_sensor", 1, n_scenarios, nullptr, update_sensor_buffer);
+
+    Buffer node_output{PGM_def_sym_output_node, n_scenarios * n_nodes};
+    DatasetMutable output_dataset{"sym_output", true, n_scenarios};
+    output_dataset.add_buffer("node", n_nodes, n_scenarios * n_nodes, nullptr, node_output);
+
+    Model model{50.0, owning_input_dataset.dataset};
+    Options options{};
+    options.set_calculation_type(PGM_state_estimation);
+
+    auto const check_not_observable_scenarios = [&] {
+        try {
+            model.calculate(options, output_dataset, update_dataset);
+            FAIL("Expected batch calculation error not thrown.");
+        } catch (PowerGridBatchError const& e) {
+            CHECK(e.error_code() == PGM_batch_error);
+            auto const& failed_scenarios = e.failed_scenarios();
+            REQUIRE(failed_scenarios.size() == 2);
+            CHECK(failed_scenarios[0].scenario == 1);
+            CHECK(failed_scenarios[1].scenario == 3);
+            for (auto const& failed_scenario : failed_scenarios) {
+                std::string const err_msg{failed_scenario.error_message};
+                CHECK(err_msg.find("Not enough measurements available for state estimation."s) != std::string::npos);
+            }
+        }
+    };
+    auto const get_node_u_pu = [&] {
+        std::vector<double> result(n_scenarios * n_nodes);
+        node_output.get_value(PGM_def_sym_output_node_u_pu, result.data(), -1);
+        return result;
+    };
+
+    SUBCASE("Observability check only") {
+        options.set_observability_check_only(1);
+        for (Idx const threading : {-1, 2}) {
+            CAPTURE(threading);
+            options.set_threading(threading);
+            node_output.set_nan();
+            check_not_observable_scenarios();
+            // nothing is solved, so the output is not written
+            for (double const u_pu : get_node_u_pu()) {
+                CHECK(std::isnan(u_pu));
+            }
+        }
+    }
+
+    SUBCASE("Full state estimation") {
+        node_output.set_nan();
+        check_not_observable_scenarios();
+        auto const u_pu = get_node_u_pu();
+        CHECK(u_pu[0] == doctest::Approx(1.0).epsilon(0.1));
+        CHECK(u_pu[2 * n_nodes] == doctest::Approx(1.0).epsilon(0.1));
+    }
+
+    SUBCASE("Only for state estimation") {
+        options.set_observability_check_only(1);
+        options.set_calculation_type(PGM_power_flow);
+        check_throws_with([&] { model.calculate(options, output_dataset, update_dataset); }, PGM_regular_error,
+                          "observability_check_only: 1"s);
+    }
+}
+
 } // namespace power_grid_model_cpp
@@ -12,6 +12,7 @@
 
 #include <doctest/doctest.h>
 
+#include <algorithm>
 #include <array>
 #include <cmath>
 #include <complex>
@@ -97,16 +98,26 @@ TEST_CASE("API Model Multi-Dimension") {
         batch_output_dataset.add_attribute_buffer("source", "i", i_source_result.data());
 
         // options
-        Options const options{};
+        Options options{};
 
-        // calculate
-        model.calculate(options, batch_output_dataset, batch_u_ref);
+        for (Idx const threading : {-1, 0, 2, 7}) {
+            CAPTURE(threading);
+            options.set_threading(threading);
+            std::ranges::fill(i_source_result, 0.0);
 
-        // check results
-        for (Idx idx = 0; idx < total_batch_size; ++idx) {
-            CHECK(i_source_result[idx] == doctest::Approx(i_source_ref[idx]));
+            // calculate
+            model.calculate(options, batch_output_dataset, batch_u_ref);
+
+            // check results
+            for (Idx idx = 0; idx < total_batch_size; ++idx) {
+                CHECK(i_source_result[idx] == doctest::Approx(i_source_ref[idx]));
+            }
         }
     }
+    SUBCASE("Output batch size should match the cartesian product") {
+        DatasetMutable batch_output_dataset{"sym_output", true, total_batch_size - 1};
+        CHECK_THROWS_AS(model.calculate(Options{}, batch_output_dataset, batch_u_ref), PowerGridRegularError);
+    }
     SUBCASE("Linked list item referring to itself is not allowed") {
         CHECK_THROWS_AS(batch_u_ref.set_next_cartesian_product_dimension(batch_u_ref), PowerGridRegularError);
     }
@@ -44,6 +44,8 @@ constexpr char const* json_data =
     R"({"version":"1.0","type":"input","is_batch":false,"attributes":{},"data":{"node":[{"id":5}],"source":[{"id":6},{"id":7}]}})";
 constexpr char const* complete_json_data =
     R"({"version":"1.0","type":"input","is_batch":false,"attributes":{"node": ["id", "u_rated"]},"data":{"node":[[5, 10500]],"source":[{"id":6, "node": 5, "status": 1, "u_ref": 1.0}]}})";
+constexpr char const* batch_update_json_data =
+    R"({"version":"1.0","type":"update","is_batch":true,"attributes":{},"data":[{"source":[{"id":6,"u_ref":0.9}]},{"source":[{"id":6,"u_ref":1.0},{"id":7,"u_ref":1.1}]},{},{"source":[{"id":7,"u_ref":1.2}]}]})";
 } // namespace
 
 TEST_CASE("API Serialization and Deserialization") {
@@ -265,6 +267,44 @@ TEST_CASE("API Serialization and Deserialization") {
         DatasetConst const input_dataset{dataset};
         Model const model{50.0, input_dataset};
     }
+
+    SUBCASE("Parallel deserializer") {
+        Idx const n_scenarios = 4;
+        Idx const n_sources = 4;
+
+        auto parse_batch = [&](Idx threading, std::vector<Idx>& indptr, std::vector<ID>& id,
+                               std::vector<double>& u_ref) {
+            Deserializer deserializer{batch_update_json_data, 0};
+            deserializer.set_threading(threading);
+            auto& dataset = deserializer.get_dataset();
+            auto const& info = dataset.get_info();
+            CHECK(info.batch_size() == n_scenarios);
+            CHECK(info.component_total_elements(0) == n_sources);
+            indptr.assign(n_scenarios + 1, -1);
+            id.assign(n_sources, 0);
+            u_ref.assign(n_sources, 0.0);
+            dataset.set_buffer("source", indptr.data(), nullptr);
+            dataset.set_attribute_buffer("source", "id", id.data());
+            dataset.set_attribute_buffer("source", "u_ref", u_ref.data());
+            deserializer.parse_to_buffer();
+        };
+
+        std::vector<Idx> sequential_indptr;
+        std::vector<ID> sequential_id;
+        std::vector<double> sequential_u_ref;
+        parse_batch(-1, sequential_indptr, sequential_id, sequential_u_ref);
+        CHECK(sequential_indptr == std::vector<Idx>{0, 1, 3, 3, 4});
+        CHECK(sequential_id == std::vector<ID>{6, 6, 7, 7});
+        CHECK(sequential_u_ref == std::vector<double>{0.9, 1.0, 1.1, 1.2});
+
+        std::vector<Idx> parallel_indptr;
+        std::vector<ID> parallel_id;
+        std::vector<double> parallel_u_ref;
+        parse_batch(2, parallel_indptr, parallel_id, parallel_u_ref);
+        CHECK(parallel_indptr == sequential_indptr);
+        CHECK(parallel_id == sequential_id);
+        CHECK(parallel_u_ref == sequential_u_ref);
+    }
 }
 
 TEST_CASE("API Serialization and Deserialization with float precision") {